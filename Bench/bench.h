@@ -0,0 +1,110 @@
+/*
+ * @file bench.h
+ * @brief 基准测试公共接口定义头文件
+ * @author ringtree
+ * @date 2025-09-02
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 基准测试程序 bench 由若干测试套件组成，通过命令行第一个参数选择：
+ *   bench <套件名> [最大规模] [--format=table|csv|json] [--out=文件]
+ * 不带参数运行时列出全部套件。
+ */
+#pragma once
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+/* include ---------------------------------------------------- */
+#include <stdio.h>
+
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 测试套件入口函数类型
+ */
+typedef int (*bench_fn)(int argc, char *argv[]);
+
+/**
+ * @brief 测试套件描述
+ */
+typedef struct bench_suite {
+  const char *name;  ///< 套件名称（命令行参数）
+  bench_fn run;      ///< 套件入口
+  const char *brief; ///< 套件说明
+} bench_suite;
+
+/**
+ * @brief 测试结果输出格式
+ */
+enum bench_format { BENCH_TABLE = 0x00, BENCH_CSV = 0x01, BENCH_JSON = 0x02 };
+
+/**
+ * @brief 测试结果输出器
+ *
+ * 结果写入 --out 指定的文件，未指定时写入原标准输出。
+ * 输出器打开期间标准输出被重定向到空设备，被测函数的打印不会混入结果。
+ */
+typedef struct bench_report {
+  FILE *out;                ///< 结果输出流
+  enum bench_format format; ///< 输出格式
+  uint32 rows;              ///< 已输出的结果条数
+  int savedStdout;          ///< 被重定向前的标准输出文件描述符
+} bench_report;
+
+d64 bench_now(void);
+
+uint32 bench_maxSize(int argc, char *argv[], const uint32 defaultMax);
+
+const char *bench_option(int argc, char *argv[], const char *name);
+
+uint16 bench_reportOpen(bench_report *const report, int argc, char *argv[],
+                        const char *suite);
+
+void bench_reportRow(bench_report *const report, const char *op,
+                     const char *dist, const uint32 n, const uint32 iters,
+                     const d64 seconds);
+
+void bench_reportClose(bench_report *const report);
+
+/**
+ * @defgroup 测试套件
+ * @brief 各测试套件入口，实现见 Bench 目录下对应文件
+ * @{
+ */
+
+int bench_build(int argc, char *argv[]);
+
+int bench_unrolled(int argc, char *argv[]);
+
+int bench_sort(int argc, char *argv[]);
+
+int bench_simd(int argc, char *argv[]);
+
+int bench_ops(int argc, char *argv[]);
+
+int bench_lfqueue(int argc, char *argv[]);
+
+int bench_clist(int argc, char *argv[]);
+
+int bench_skip(int argc, char *argv[]);
+
+int bench_vector(int argc, char *argv[]);
+
+int bench_dlist(int argc, char *argv[]);
+
+int bench_parallel(int argc, char *argv[]);
+
+int bench_writer(int argc, char *argv[]);
+
+int bench_file(int argc, char *argv[]);
+
+int bench_generic(int argc, char *argv[]);
+
+int bench_intrusive(int argc, char *argv[]);
+
+int bench_batch(int argc, char *argv[]);
+
+/** @} */ // 测试套件
+
+#endif /* !__BENCH_H__ */
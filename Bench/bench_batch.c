@@ -0,0 +1,124 @@
+/*
+ * @file bench_batch.c
+ * @brief 批量删除与逐个删除的对比
+ * @author ringtree
+ * @date 2025-10-07
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^3 至默认 10^5）测试，数据取 [0, 1000) 内的随机值：
+ * - SL_deleteIndex × k / SL_deleteIndices ：删除每隔100个位置的 k = n/100 个节点；
+ * - SL_deleteData × k / SL_deleteValues   ：删除 k = 16 个值的全部匹配项；
+ * - SL_removeIf / SL_removeIf(pool)       ：删除全部奇数，逐个 free() 与整串归还节点池。
+ * 逐个删除的总代价为O(n·k)，批量删除只遍历一次。结果以每元素耗时报告。
+ *
+ * 用法：bench batch [最大规模] [--format=table|csv|json] [--out=文件]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+
+/**
+ * @brief 逐个删除时使用的值个数
+ */
+#define BENCH_BATCH_VALUES 16
+
+/**
+ * @brief 判断数据是否为奇数
+ */
+static uint16 bench_batchOdd(const Elemtype data, void *const context) {
+  (void)context;
+  return (uint16)(data & 1);
+}
+
+/**
+ * @brief 以固定种子重建链表
+ */
+static void bench_batchFill(SL_link *const link, const uint32 n) {
+  uint32 state = 12345u;
+  SL_freeNodes(link);
+  for (uint32 i = 0; i < n; i++) {
+    state = state * 1664525u + 1013904223u;
+    SL_add(link, (Elemtype)((state >> 8) % 1000));
+  }
+}
+
+int bench_batch(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 100000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "batch"))
+    return 1;
+
+  uint32 *indices = (uint32 *)malloc(sizeof(uint32) * (maxSize / 100 + 1));
+  if (!indices) {
+    printf("内存分配失败 可能内存不足");
+    bench_reportClose(&report);
+    return 1;
+  }
+
+  Elemtype values[BENCH_BATCH_VALUES];
+  for (uint32 i = 0; i < BENCH_BATCH_VALUES; i++)
+    values[i] = (Elemtype)(i * 61 % 1000);
+
+  for (uint32 n = 1000; n <= maxSize; n *= 10) {
+    uint32 k = n / 100;
+    for (uint32 i = 0; i < k; i++)
+      indices[i] = i * 100;
+
+    SL_link *plain = SL_inifLink();
+    SL_link *pooled = SL_inifLinkPool(NULL);
+
+    // 按下标删除：从后往前逐个删除，保证下标不受前面删除的影响
+    bench_batchFill(plain, n);
+    d64 start = bench_now();
+    for (uint32 i = k; i > 0; i--)
+      SL_deleteIndex(plain, indices[i - 1]);
+    bench_reportRow(&report, "SL_deleteIndex x k", "every100", n, n,
+                    bench_now() - start);
+
+    bench_batchFill(plain, n);
+    start = bench_now();
+    SL_deleteIndices(plain, indices, k);
+    bench_reportRow(&report, "SL_deleteIndices", "every100", n, n,
+                    bench_now() - start);
+
+    // 按值删除
+    bench_batchFill(plain, n);
+    start = bench_now();
+    for (uint32 i = 0; i < BENCH_BATCH_VALUES; i++)
+      SL_tryDeleteData(plain, values[i], 0, NULL);
+    bench_reportRow(&report, "SL_deleteData x k", "random", n, n,
+                    bench_now() - start);
+
+    bench_batchFill(plain, n);
+    start = bench_now();
+    SL_deleteValues(plain, values, BENCH_BATCH_VALUES);
+    bench_reportRow(&report, "SL_deleteValues", "random", n, n,
+                    bench_now() - start);
+
+    // 按条件删除
+    bench_batchFill(plain, n);
+    start = bench_now();
+    SL_removeIf(plain, bench_batchOdd, NULL);
+    bench_reportRow(&report, "SL_removeIf", "random", n, n,
+                    bench_now() - start);
+
+    bench_batchFill(pooled, n);
+    start = bench_now();
+    SL_removeIf(pooled, bench_batchOdd, NULL);
+    bench_reportRow(&report, "SL_removeIf(pool)", "random", n, n,
+                    bench_now() - start);
+
+    SL_freeLinks(plain);
+    SL_freeLinks(pooled);
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  free(indices);
+  bench_reportClose(&report);
+  return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * @file bench_build.c
+ * @brief 建表耗时基准测试
+ * @author ringtree
+ * @date 2025-09-02
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^3 至默认 10^7）分别测试：
+ * - SL_add 逐个尾插（malloc 节点 / 私有节点池）；
+ * - SL_randLink 随机建表；
+ * - SL_fromArray 批量建表与 SL_toArray 批量导出。
+ * 尾插为O(1)时，每元素耗时（ns/elem）应基本保持不变。
+ *
+ * 用法：bench build [最大规模]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "other.h"
+
+/**
+ * @brief 测试 SL_add 逐个尾插建表
+ *
+ * @param link 空链表
+ * @param n 元素个数
+ * @return d64 耗时（秒）
+ */
+static d64 bench_add(SL_link *const link, const uint32 n) {
+  d64 start = bench_now();
+  for (uint32 i = 0; i < n; i++)
+    SL_add(link, (Elemtype)i);
+  return bench_now() - start;
+}
+
+int bench_build(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 10000000);
+
+  printf("%-10s %-14s %12s %12s\n", "n", "case", "seconds", "ns/elem");
+  for (uint32 n = 1000; n <= maxSize; n *= 10) {
+    SL_link *link = SL_inifLink();
+    d64 seconds = bench_add(link, n);
+    printf("%-10u %-14s %12.6f %12.2f\n", n, "add/malloc", seconds,
+           seconds * 1e9 / n);
+    SL_freeLinks(link);
+
+    link = SL_inifLinkPool(NULL);
+    seconds = bench_add(link, n);
+    printf("%-10u %-14s %12.6f %12.2f\n", n, "add/pool", seconds,
+           seconds * 1e9 / n);
+    SL_freeLinks(link);
+
+    link = SL_inifLink();
+    d64 start = bench_now();
+    SL_randLink(link, n, -1000, 1000);
+    seconds = bench_now() - start;
+    printf("%-10u %-14s %12.6f %12.2f\n", n, "randLink", seconds,
+           seconds * 1e9 / n);
+    SL_freeLinks(link);
+
+    Elemtype *array = (Elemtype *)malloc(sizeof(Elemtype) * n);
+    for (uint32 i = 0; i < n; i++)
+      array[i] = (Elemtype)i;
+    start = bench_now();
+    link = SL_fromArray(array, n);
+    seconds = bench_now() - start;
+    printf("%-10u %-14s %12.6f %12.2f\n", n, "fromArray", seconds,
+           seconds * 1e9 / n);
+
+    start = bench_now();
+    SL_toArray(link, array, n);
+    seconds = bench_now() - start;
+    printf("%-10u %-14s %12.6f %12.2f\n", n, "toArray", seconds,
+           seconds * 1e9 / n);
+    SL_freeLinks(link);
+    free(array);
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  return 0;
+}
@@ -0,0 +1,205 @@
+/*
+ * @file bench_clist.c
+ * @brief 并发有序链表在不同读写比例下的吞吐量对比
+ * @author ringtree
+ * @date 2025-09-25
+ * @version 1.0
+ *
+ * 键取值范围为 [0, BENCH_CL_KEYS)，测试前插入一半的键。
+ * 读比例取 90%、50%、10%，其余操作平分为插入与删除（集合规模大致不变），
+ * 线程数取 1, 2, 4, ..., 64，所有线程合计执行约 [总操作数] 次（默认 2*10^5）：
+ * - mutex    ：全局互斥锁保护的单向链表（SL_getIndex / SL_insert / SL_deleteIndex）；
+ * - coupling ：CL_COUPLING 手递手加锁；
+ * - lazy     ：CL_LAZY 惰性链表；
+ * - lockfree ：CL_LOCKFREE Harris-Michael 无锁链表。
+ * 结果为所有线程合计的每次操作纳秒数，n 列为线程数，dist 列为读比例。
+ *
+ * 用法：bench clist [总操作数] [--format=table|csv|json] [--out=文件]
+ */
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_clist.h"
+
+/**
+ * @brief 最大测试线程数
+ */
+#define BENCH_CL_MAX_THREADS 64
+
+/**
+ * @brief 键的取值个数
+ */
+#define BENCH_CL_KEYS 1024
+
+/**
+ * @brief 线程共享的测试状态
+ */
+typedef struct bench_clShared {
+  CL_list *list;         ///< 并发有序链表（mutex 测试时为NULL）
+  SL_link *link;         ///< 互斥锁保护的有序单向链表
+  pthread_mutex_t mutex; ///< 单向链表的互斥锁
+  uint32 ops;            ///< 每个线程的操作次数
+  uint32 readPercent;    ///< 读操作比例（百分比）
+  atomic_uint seed;      ///< 为各线程分配不同的随机种子
+} bench_clShared;
+
+/**
+ * @brief 线性同余随机数
+ */
+static uint32 bench_clRand(uint32 *const state) {
+  *state = *state * 1664525u + 1013904223u;
+  return *state >> 8;
+}
+
+/**
+ * @brief 在有序单向链表中插入不存在的键（调用者持有互斥锁）
+ */
+static void bench_linkInsert(SL_link *const link, const Elemtype key) {
+  uint32 index = 0;
+  SL_node *cur = link->headIndex;
+  while (cur && cur->data < key) {
+    cur = cur->next;
+    index++;
+  }
+  if (cur && cur->data == key)
+    return;
+  if (index >= link->length)
+    SL_add(link, key);
+  else
+    SL_insert(link, key, index);
+}
+
+/**
+ * @brief 互斥锁版本的工作线程
+ */
+static void *bench_mutexWorker(void *arg) {
+  bench_clShared *shared = (bench_clShared *)arg;
+  uint32 state = atomic_fetch_add(&shared->seed, 7919u);
+  volatile uint32 sink = 0;
+
+  for (uint32 i = 0; i < shared->ops; i++) {
+    uint32 r = bench_clRand(&state);
+    Elemtype key = (Elemtype)(r % BENCH_CL_KEYS);
+    uint32 op = (r / BENCH_CL_KEYS) % 100;
+
+    pthread_mutex_lock(&shared->mutex);
+    if (op < shared->readPercent) {
+      sink += SL_getIndex(shared->link, key) != UINT32_MAX;
+    } else if ((op - shared->readPercent) % 2 == 0) {
+      bench_linkInsert(shared->link, key);
+    } else {
+      uint32 index = SL_getIndex(shared->link, key);
+      if (index != UINT32_MAX)
+        SL_deleteIndex(shared->link, index);
+    }
+    pthread_mutex_unlock(&shared->mutex);
+  }
+  (void)sink;
+  return NULL;
+}
+
+/**
+ * @brief 并发有序链表版本的工作线程
+ */
+static void *bench_clistWorker(void *arg) {
+  bench_clShared *shared = (bench_clShared *)arg;
+  uint32 state = atomic_fetch_add(&shared->seed, 7919u);
+  SL_hpRecord *record = CL_attach(shared->list);
+  volatile uint32 sink = 0;
+
+  for (uint32 i = 0; i < shared->ops; i++) {
+    uint32 r = bench_clRand(&state);
+    Elemtype key = (Elemtype)(r % BENCH_CL_KEYS);
+    uint32 op = (r / BENCH_CL_KEYS) % 100;
+
+    if (op < shared->readPercent)
+      sink += CL_contains(shared->list, record, key);
+    else if ((op - shared->readPercent) % 2 == 0)
+      CL_insert(shared->list, record, key);
+    else
+      CL_deleteData(shared->list, record, key);
+  }
+  CL_detach(shared->list, record);
+  (void)sink;
+  return NULL;
+}
+
+/**
+ * @brief 启动 threads 个工作线程并计时
+ *
+ * @return d64 全部线程结束的耗时（秒）
+ */
+static d64 bench_runThreads(void *(*worker)(void *), bench_clShared *shared,
+                            const uint32 threads) {
+  pthread_t ids[BENCH_CL_MAX_THREADS];
+  uint32 started = 0;
+
+  d64 start = bench_now();
+  for (; started < threads; started++) {
+    if (pthread_create(&ids[started], NULL, worker, shared) != 0)
+      break;
+  }
+  for (uint32 t = 0; t < started; t++)
+    pthread_join(ids[t], NULL);
+  return bench_now() - start;
+}
+
+int bench_clist(int argc, char *argv[]) {
+  static const uint32 reads[] = {90, 50, 10};
+  static const struct {
+    const char *name;
+    enum CL_mode mode;
+  } modes[] = {{"coupling", CL_COUPLING},
+               {"lazy", CL_LAZY},
+               {"lockfree", CL_LOCKFREE}};
+  uint32 totalOps = bench_maxSize(argc, argv, 200000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "clist"))
+    return 1;
+
+  for (size_t r = 0; r < sizeof(reads) / sizeof(reads[0]); r++) {
+    char dist[16];
+    snprintf(dist, sizeof(dist), "read%u%%", reads[r]);
+
+    for (uint32 threads = 1; threads <= BENCH_CL_MAX_THREADS; threads *= 2) {
+      bench_clShared shared;
+      shared.readPercent = reads[r];
+      shared.ops = totalOps / threads ? totalOps / threads : 1;
+      uint32 ops = shared.ops * threads;
+
+      shared.list = NULL;
+      shared.link = SL_inifLink();
+      pthread_mutex_init(&shared.mutex, NULL);
+      for (Elemtype key = 0; key < BENCH_CL_KEYS; key += 2)
+        SL_add(shared.link, key);
+      atomic_init(&shared.seed, 12345u);
+      d64 seconds = bench_runThreads(bench_mutexWorker, &shared, threads);
+      bench_reportRow(&report, "mutex", dist, threads, ops, seconds);
+      pthread_mutex_destroy(&shared.mutex);
+      SL_freeLinks(shared.link);
+
+      for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        shared.list = CL_inifList(modes[m].mode);
+        if (!shared.list)
+          continue;
+        SL_hpRecord *record = CL_attach(shared.list);
+        for (Elemtype key = 0; key < BENCH_CL_KEYS; key += 2)
+          CL_insert(shared.list, record, key);
+        CL_detach(shared.list, record);
+
+        atomic_init(&shared.seed, 12345u);
+        seconds = bench_runThreads(bench_clistWorker, &shared, threads);
+        bench_reportRow(&report, modes[m].name, dist, threads, ops, seconds);
+        CL_freeList(shared.list);
+      }
+    }
+  }
+
+  bench_reportClose(&report);
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * @file bench_dlist.c
+ * @brief 双向链表与单向链表在双端队列式用法下的对比
+ * @author ringtree
+ * @date 2025-09-28
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^2 至默认 10^5）对比：
+ * - SL_delEnd + SL_add / DL_delEnd + DL_add               ：尾部出入栈；
+ * - SL_insertAfter + SL_deleteNode / DL_insertAfter + DL_deleteNode
+ *                                                         ：持有句柄删除（链表中部）；
+ * - SL_deleteIndex / DL_deleteIndex                       ：随机下标删除（随后补回一个元素）。
+ * 单向链表的操作为O(n)，按总扫描量约 BENCH_DLIST_BUDGET 个节点确定重复次数。
+ *
+ * 用法：bench dlist [最大规模] [--format=table|csv|json] [--out=文件]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "dl_link.h"
+
+/**
+ * @brief O(n) 操作的总扫描节点预算
+ */
+#define BENCH_DLIST_BUDGET 20000000u
+
+/**
+ * @brief 每项测试的最大重复次数
+ */
+#define BENCH_DLIST_MAX_ITERS 1000000u
+
+/**
+ * @brief 生成伪随机数 [0, bound)
+ */
+static uint32 bench_dlistRand(uint32 *const state, const uint32 bound) {
+  *state = *state * 1664525u + 1013904223u;
+  return (uint32)(((uint64)*state * bound) >> 32);
+}
+
+int bench_dlist(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 100000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "dlist"))
+    return 1;
+
+  for (uint32 n = 100; n <= maxSize; n *= 10) {
+    uint32 linear = BENCH_DLIST_BUDGET / n;
+    if (linear < 1)
+      linear = 1;
+    if (linear > BENCH_DLIST_MAX_ITERS)
+      linear = BENCH_DLIST_MAX_ITERS;
+    uint32 constant = BENCH_DLIST_MAX_ITERS;
+    uint32 state = 12345u;
+    volatile uint32 sink = 0;
+
+    SL_link *single = SL_inifLink();
+    DL_link *doubly = DL_inifLink();
+    for (uint32 i = 0; i < n; i++) {
+      Elemtype data = (Elemtype)bench_dlistRand(&state, 1000000);
+      SL_add(single, data);
+      DL_add(doubly, data);
+    }
+
+    d64 start = bench_now();
+    for (uint32 i = 0; i < linear; i++) {
+      sink += SL_delEnd(single);
+      SL_add(single, (Elemtype)i);
+    }
+    bench_reportRow(&report, "SL_delEnd+add", "random", n, linear,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < constant; i++) {
+      sink += DL_delEnd(doubly);
+      DL_add(doubly, (Elemtype)i);
+    }
+    bench_reportRow(&report, "DL_delEnd+add", "random", n, constant,
+                    bench_now() - start);
+
+    // 句柄删除：在链表中部插入新节点并立即按句柄删除
+    SL_node *middle = fast_slow_find(single, n / 2);
+    start = bench_now();
+    for (uint32 i = 0; i < linear; i++)
+      sink += SL_deleteNode(single, SL_insertAfter(single, middle, (Elemtype)i));
+    bench_reportRow(&report, "SL_deleteNode", "random", n, linear,
+                    bench_now() - start);
+
+    DL_node *handle = DL_getNode(doubly, n / 2);
+    start = bench_now();
+    for (uint32 i = 0; i < constant; i++)
+      sink += DL_deleteNode(doubly, DL_insertAfter(doubly, handle, (Elemtype)i));
+    bench_reportRow(&report, "DL_deleteNode", "random", n, constant,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < linear; i++) {
+      sink += SL_deleteIndex(single, bench_dlistRand(&state, n));
+      SL_add(single, (Elemtype)i);
+    }
+    bench_reportRow(&report, "SL_deleteIndex", "random", n, linear,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < linear; i++) {
+      sink += DL_deleteIndex(doubly, bench_dlistRand(&state, n));
+      DL_add(doubly, (Elemtype)i);
+    }
+    bench_reportRow(&report, "DL_deleteIndex", "random", n, linear,
+                    bench_now() - start);
+
+    SL_freeLinks(single);
+    DL_freeLinks(doubly);
+    (void)sink;
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  bench_reportClose(&report);
+  return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * @file bench_file.c
+ * @brief 二进制保存 / 内存映射加载与逐个插入重建的对比
+ * @author ringtree
+ * @date 2025-10-02
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^4 至默认 10^7）测试：
+ * - SL_add              ：逐个插入重建链表（原有的恢复方式）；
+ * - SL_save             ：保存为原始（raw）或差分变长整数（delta）格式；
+ * - SL_load/nodes       ：映射文件并生成节点链表；
+ * - SL_load/vector      ：映射文件并生成顺序存储链表。
+ * 数据为随机间隔的递增序列，dist 列为文件格式，结果以每元素耗时报告。
+ * 文件位于 /tmp 且刚写入，测得的是页缓存命中时的加载耗时。
+ *
+ * 用法：bench file [最大规模] [--format=table|csv|json] [--out=文件]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_file.h"
+
+int bench_file(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 10000000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "file"))
+    return 1;
+
+  char path[64];
+  snprintf(path, sizeof(path), "/tmp/bench_file_%d.bin", (int)getpid());
+
+  static const char *const formatNames[] = {"raw", "delta"};
+  for (uint32 n = 10000; n <= maxSize; n *= 10) {
+    uint32 state = 12345u;
+    Elemtype value = 0;
+    volatile uint32 sink = 0;
+
+    // 逐个插入重建
+    d64 start = bench_now();
+    SL_link *source = SL_inifLink();
+    for (uint32 i = 0; i < n; i++) {
+      state = state * 1664525u + 1013904223u;
+      value += (Elemtype)(state >> 24);
+      SL_add(source, value);
+    }
+    bench_reportRow(&report, "SL_add", "-", n, n, bench_now() - start);
+
+    for (uint32 f = SL_FILE_RAW; f <= SL_FILE_DELTA; f++) {
+      start = bench_now();
+      uint16 saved = SL_save(source, path, (enum SL_fileFormat)f);
+      bench_reportRow(&report, "SL_save", formatNames[f], n, n,
+                      bench_now() - start);
+      if (!saved)
+        continue;
+
+      start = bench_now();
+      SL_link *nodes = SL_load(path, SL_LOAD_NODES);
+      bench_reportRow(&report, "SL_load/nodes", formatNames[f], n, n,
+                      bench_now() - start);
+
+      start = bench_now();
+      SL_link *vector = SL_load(path, SL_LOAD_VECTOR);
+      bench_reportRow(&report, "SL_load/vector", formatNames[f], n, n,
+                      bench_now() - start);
+
+      if (nodes) {
+        sink += nodes->length;
+        SL_freeLinks(nodes);
+      }
+      if (vector) {
+        sink += vector->length;
+        SL_freeLinks(vector);
+      }
+    }
+
+    SL_freeLinks(source);
+    (void)sink;
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  remove(path);
+  bench_reportClose(&report);
+  return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * @file bench_generic.c
+ * @brief 泛型链表（sl_generic.h）与 SL_link 的排序、查找对比
+ * @author ringtree
+ * @date 2025-10-03
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^3 至默认 10^6）测试：
+ * - SL_sort_Merge / SL_count            ：int32 的 SL_link；
+ * - G32_sort_Merge / G32_count          ：DEFINE_SL_LIST 生成的 int32 链表；
+ * - G64_sort_Merge / GF64_sort_Merge    ：64 位整数与 double 链表，
+ *                                         比较函数在循环中内联展开。
+ * 排序结果以每元素耗时报告，查找以每次 count 的耗时报告。
+ *
+ * 用法：bench generic [最大规模] [--format=table|csv|json] [--out=文件]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_generic.h"
+
+DEFINE_SL_LIST(G32, int32, SL_GENERIC_CMP, SL_GENERIC_HASH)
+DEFINE_SL_LIST(G64, uint64, SL_GENERIC_CMP, SL_GENERIC_HASH)
+DEFINE_SL_LIST(GF64, d64, SL_GENERIC_CMP, SL_GENERIC_HASH)
+
+/**
+ * @brief 每个规模下 count 的调用次数
+ */
+#define BENCH_GENERIC_FINDS 20
+
+int bench_generic(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 1000000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "generic"))
+    return 1;
+
+  for (uint32 n = 1000; n <= maxSize; n *= 10) {
+    uint32 state = 12345u;
+    volatile uint32 sink = 0;
+
+    SL_link *plain = SL_inifLink();
+    G32_link *g32 = G32_inifLink();
+    G64_link *g64 = G64_inifLink();
+    GF64_link *gf64 = GF64_inifLink();
+    for (uint32 i = 0; i < n; i++) {
+      state = state * 1664525u + 1013904223u;
+      SL_add(plain, (Elemtype)(state >> 1));
+      G32_add(g32, (int32)(state >> 1));
+      G64_add(g64, ((uint64)state << 32) | i);
+      GF64_add(gf64, (d64)state / 7.0);
+    }
+
+    d64 start = bench_now();
+    for (uint32 i = 0; i < BENCH_GENERIC_FINDS; i++)
+      sink += SL_count(plain, (Elemtype)i);
+    bench_reportRow(&report, "SL_count", "int32", n, BENCH_GENERIC_FINDS,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < BENCH_GENERIC_FINDS; i++)
+      sink += G32_count(g32, (int32)i);
+    bench_reportRow(&report, "G32_count", "int32", n, BENCH_GENERIC_FINDS,
+                    bench_now() - start);
+
+    start = bench_now();
+    SL_sort_Merge(plain, ASC);
+    bench_reportRow(&report, "SL_sort_Merge", "int32", n, n,
+                    bench_now() - start);
+
+    start = bench_now();
+    G32_sort_Merge(g32, ASC);
+    bench_reportRow(&report, "G32_sort_Merge", "int32", n, n,
+                    bench_now() - start);
+
+    start = bench_now();
+    G64_sort_Merge(g64, ASC);
+    bench_reportRow(&report, "G64_sort_Merge", "uint64", n, n,
+                    bench_now() - start);
+
+    start = bench_now();
+    GF64_sort_Merge(gf64, ASC);
+    bench_reportRow(&report, "GF64_sort_Merge", "d64", n, n,
+                    bench_now() - start);
+
+    SL_freeLinks(plain);
+    G32_freeLinks(g32);
+    G64_freeLinks(g64);
+    GF64_freeLinks(gf64);
+    (void)sink;
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  bench_reportClose(&report);
+  return 0;
+}
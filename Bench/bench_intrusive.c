@@ -0,0 +1,133 @@
+/*
+ * @file bench_intrusive.c
+ * @brief 侵入式链表与 SL_link 的建表、排序、约瑟夫环对比
+ * @author ringtree
+ * @date 2025-10-04
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^3 至默认 10^6）测试：
+ * - SL_add / IL_add                            ：逐个分配节点与串联预分配对象；
+ * - SL_delHead / IL_delHead                    ：逐个释放节点与摘下对象；
+ * - SL_sort_Merge / IL_sort_Merge              ：归并排序（IL 通过比较回调）；
+ * - SL_josephusSurvivor / IL_josephusSurvivor  ：报数间隔为3的约瑟夫环。
+ * 对象来自一次性分配的数组，模拟调用者自己的对象池。结果以每元素耗时报告。
+ *
+ * 用法：bench intrusive [最大规模] [--format=table|csv|json] [--out=文件]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_intrusive.h"
+
+/**
+ * @brief 测试用的调用者对象
+ */
+typedef struct bench_object {
+  Elemtype key; ///< 排序键
+  uint32 id;    ///< 对象编号
+  IL_hook hook; ///< 链接字段
+} bench_object;
+
+/**
+ * @brief 按 key 比较两个对象
+ */
+static int32 bench_objectCompare(const IL_hook *const a, const IL_hook *const b,
+                                 void *const context) {
+  (void)context;
+  Elemtype x = IL_CONTAINER_OF(a, bench_object, hook)->key;
+  Elemtype y = IL_CONTAINER_OF(b, bench_object, hook)->key;
+  return (x > y) - (x < y);
+}
+
+int bench_intrusive(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 1000000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "intrusive"))
+    return 1;
+
+  bench_object *objects =
+      (bench_object *)malloc(sizeof(bench_object) * maxSize);
+  if (!objects) {
+    printf("内存分配失败 可能内存不足");
+    bench_reportClose(&report);
+    return 1;
+  }
+
+  for (uint32 n = 1000; n <= maxSize; n *= 10) {
+    uint32 state = 12345u;
+    volatile uint32 sink = 0;
+    for (uint32 i = 0; i < n; i++) {
+      state = state * 1664525u + 1013904223u;
+      objects[i].key = (Elemtype)(state >> 1);
+      objects[i].id = i;
+    }
+
+    SL_link *plain = SL_inifLink();
+    IL_link *intrusive = IL_inifLink();
+
+    d64 start = bench_now();
+    for (uint32 i = 0; i < n; i++)
+      SL_add(plain, objects[i].key);
+    bench_reportRow(&report, "SL_add", "random", n, n, bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < n; i++)
+      IL_add(intrusive, &objects[i].hook);
+    bench_reportRow(&report, "IL_add", "random", n, n, bench_now() - start);
+
+    start = bench_now();
+    SL_sort_Merge(plain, ASC);
+    bench_reportRow(&report, "SL_sort_Merge", "random", n, n,
+                    bench_now() - start);
+
+    start = bench_now();
+    IL_sort_Merge(intrusive, bench_objectCompare, NULL, ASC);
+    bench_reportRow(&report, "IL_sort_Merge", "random", n, n,
+                    bench_now() - start);
+
+    start = bench_now();
+    sink += SL_josephusSurvivor(plain, 3);
+    bench_reportRow(&report, "SL_josephusSurvivor", "random", n, n,
+                    bench_now() - start);
+
+    start = bench_now();
+    sink += IL_ENTRY(IL_josephusSurvivor(intrusive, 3, NULL, NULL),
+                     bench_object, hook)->id;
+    bench_reportRow(&report, "IL_josephusSurvivor", "random", n, n,
+                    bench_now() - start);
+
+    // 重新建表后测试逐个删除
+    SL_freeNodes(plain);
+    IL_clear(intrusive);
+    for (uint32 i = 0; i < n; i++) {
+      SL_add(plain, objects[i].key);
+      IL_add(intrusive, &objects[i].hook);
+    }
+
+    start = bench_now();
+    while (plain->length)
+      sink += SL_delHead(plain);
+    bench_reportRow(&report, "SL_delHead", "random", n, n,
+                    bench_now() - start);
+
+    start = bench_now();
+    while (intrusive->length)
+      sink += IL_CONTAINER_OF(IL_delHead(intrusive), bench_object, hook)->id;
+    bench_reportRow(&report, "IL_delHead", "random", n, n,
+                    bench_now() - start);
+
+    SL_freeLinks(plain);
+    IL_freeLinks(intrusive);
+    (void)sink;
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  free(objects);
+  bench_reportClose(&report);
+  return 0;
+}
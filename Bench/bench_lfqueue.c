@@ -0,0 +1,137 @@
+/*
+ * @file bench_lfqueue.c
+ * @brief 无锁队列与互斥锁保护的单向链表在多线程竞争下的对比
+ * @author ringtree
+ * @date 2025-09-24
+ * @version 1.0
+ *
+ * 线程数取 1, 2, 4, ..., 64，每个线程交替执行一次入队和一次出队，
+ * 所有线程合计执行约 [总操作数] 次（默认 2*10^6）：
+ * - mutex   ：全局 pthread_mutex 保护的 SL_add / SL_delHead；
+ * - lfqueue ：LQ_add / LQ_delHead。
+ * 结果为所有线程合计的每次操作纳秒数（吞吐量的倒数），
+ * 线程数超过 CPU 核数时结果主要反映抢占下的行为。
+ *
+ * 用法：bench lfqueue [总操作数] [--format=table|csv|json] [--out=文件]
+ */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_lfqueue.h"
+
+/**
+ * @brief 最大测试线程数
+ */
+#define BENCH_LQ_MAX_THREADS 64
+
+/**
+ * @brief 测试前预先放入队列的元素个数
+ */
+#define BENCH_LQ_PREFILL 1024
+
+/**
+ * @brief 线程共享的测试状态
+ */
+typedef struct bench_lqShared {
+  SL_lfQueue *queue;     ///< 无锁队列
+  SL_link *link;         ///< 互斥锁保护的单向链表
+  pthread_mutex_t mutex; ///< 单向链表的互斥锁
+  uint32 pairs;          ///< 每个线程的入队/出队次数
+} bench_lqShared;
+
+/**
+ * @brief 互斥锁版本的工作线程
+ */
+static void *bench_mutexWorker(void *arg) {
+  bench_lqShared *shared = (bench_lqShared *)arg;
+  for (uint32 i = 0; i < shared->pairs; i++) {
+    pthread_mutex_lock(&shared->mutex);
+    SL_add(shared->link, (Elemtype)i);
+    pthread_mutex_unlock(&shared->mutex);
+
+    pthread_mutex_lock(&shared->mutex);
+    SL_delHead(shared->link);
+    pthread_mutex_unlock(&shared->mutex);
+  }
+  return NULL;
+}
+
+/**
+ * @brief 无锁队列版本的工作线程
+ */
+static void *bench_lfqueueWorker(void *arg) {
+  bench_lqShared *shared = (bench_lqShared *)arg;
+  SL_hpRecord *record = LQ_attach(shared->queue);
+  Elemtype data = 0;
+  for (uint32 i = 0; i < shared->pairs; i++) {
+    LQ_add(shared->queue, record, (Elemtype)i);
+    LQ_delHead(shared->queue, record, &data);
+  }
+  LQ_detach(shared->queue, record);
+  return NULL;
+}
+
+/**
+ * @brief 启动 threads 个工作线程并计时
+ *
+ * @return d64 全部线程结束的耗时（秒）
+ */
+static d64 bench_runThreads(void *(*worker)(void *), bench_lqShared *shared,
+                            const uint32 threads) {
+  pthread_t ids[BENCH_LQ_MAX_THREADS];
+  uint32 started = 0;
+
+  d64 start = bench_now();
+  for (; started < threads; started++) {
+    if (pthread_create(&ids[started], NULL, worker, shared) != 0)
+      break;
+  }
+  for (uint32 t = 0; t < started; t++)
+    pthread_join(ids[t], NULL);
+  return bench_now() - start;
+}
+
+int bench_lfqueue(int argc, char *argv[]) {
+  uint32 totalOps = bench_maxSize(argc, argv, 2000000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "lfqueue"))
+    return 1;
+
+  for (uint32 threads = 1; threads <= BENCH_LQ_MAX_THREADS; threads *= 2) {
+    char dist[16];
+    snprintf(dist, sizeof(dist), "threads=%u", threads);
+
+    bench_lqShared shared;
+    shared.pairs = totalOps / 2 / threads;
+    if (shared.pairs == 0)
+      shared.pairs = 1;
+    uint32 ops = shared.pairs * 2 * threads;
+
+    shared.link = SL_inifLink();
+    pthread_mutex_init(&shared.mutex, NULL);
+    for (uint32 i = 0; i < BENCH_LQ_PREFILL; i++)
+      SL_add(shared.link, (Elemtype)i);
+    d64 seconds = bench_runThreads(bench_mutexWorker, &shared, threads);
+    bench_reportRow(&report, "mutex", dist, threads, ops, seconds);
+    pthread_mutex_destroy(&shared.mutex);
+    SL_freeLinks(shared.link);
+
+    shared.queue = LQ_inifQueue();
+    if (!shared.queue)
+      break;
+    SL_hpRecord *record = LQ_attach(shared.queue);
+    for (uint32 i = 0; i < BENCH_LQ_PREFILL; i++)
+      LQ_add(shared.queue, record, (Elemtype)i);
+    LQ_detach(shared.queue, record);
+    seconds = bench_runThreads(bench_lfqueueWorker, &shared, threads);
+    bench_reportRow(&report, "lfqueue", dist, threads, ops, seconds);
+    LQ_freeQueue(shared.queue);
+  }
+
+  bench_reportClose(&report);
+  return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * @file bench_main.c
+ * @brief 基准测试程序入口
+ * @author ringtree
+ * @date 2025-09-02
+ * @version 1.0
+ *
+ * 根据命令行参数分发到对应的测试套件。
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+/**
+ * @brief 测试套件注册表
+ */
+static const bench_suite suites[] = {
+    {"build", bench_build, "SL_add / SL_randLink 建表耗时（验证线性增长）"},
+    {"unrolled", bench_unrolled, "展开链表与单向链表扫描性能对比"},
+    {"sort", bench_sort, "插入排序与归并排序在不同有序程度下的对比"},
+    {"simd", bench_simd, "连续快照向量化扫描与逐节点扫描对比"},
+    {"ops", bench_ops, "data_struct.h 全部操作 × 规模 × 数据分布（支持 CSV/JSON）"},
+    {"lfqueue", bench_lfqueue, "无锁队列与互斥锁链表在 1~64 线程竞争下的吞吐量"},
+    {"clist", bench_clist, "并发有序链表三种同步策略在不同读写比例下的吞吐量"},
+    {"skip", bench_skip, "跳表索引的O(log n)查找、插入、删除与逐节点遍历对比"},
+    {"vector", bench_vector, "顺序存储后端与节点链表在各规模下的交叉点"},
+    {"dlist", bench_dlist, "双向链表O(1)尾删与句柄删除和单向链表对比"},
+    {"parallel", bench_parallel, "线程池分段并行统计、归约与窃取调度的扩展性"},
+    {"writer", bench_writer, "缓冲快速整数输出与逐元素 printf 的吞吐量对比"},
+    {"file", bench_file, "二进制保存与内存映射加载和逐个插入重建对比"},
+    {"generic", bench_generic, "DEFINE_SL_LIST 泛型链表与 SL_link 的排序、查找对比"},
+    {"intrusive", bench_intrusive, "侵入式链表零分配串联与 SL_link 的建表、排序对比"},
+    {"batch", bench_batch, "批量删除下标、值、条件与逐个删除的单次遍历对比"},
+};
+
+/**
+ * @brief 获取当前时间
+ *
+ * @return d64 以秒为单位的当前时间
+ */
+d64 bench_now(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (d64)ts.tv_sec + (d64)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief 解析套件参数中的最大规模
+ *
+ * 套件参数中第一个纯数字参数作为最大元素个数，否则使用默认值。
+ *
+ * @param argc 套件参数个数（argv[0] 为套件名）
+ * @param argv 套件参数
+ * @param defaultMax 默认最大规模
+ * @return uint32 最大元素个数
+ */
+uint32 bench_maxSize(int argc, char *argv[], const uint32 defaultMax) {
+  for (int i = 1; i < argc; i++) {
+    char *end = NULL;
+    unsigned long value = strtoul(argv[i], &end, 10);
+    if (value && *end == '\0')
+      return (uint32)value;
+  }
+  return defaultMax;
+}
+
+/**
+ * @brief 查找 --name=value 形式的套件参数
+ *
+ * @param argc 套件参数个数
+ * @param argv 套件参数
+ * @param name 参数名（不含 --）
+ * @return const char* 参数值，未指定时返回NULL
+ */
+const char *bench_option(int argc, char *argv[], const char *name) {
+  size_t length = strlen(name);
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--", 2) == 0 &&
+        strncmp(argv[i] + 2, name, length) == 0 && argv[i][2 + length] == '=')
+      return argv[i] + 3 + length;
+  }
+  return NULL;
+}
+
+int main(int argc, char *argv[]) {
+  const size_t count = sizeof(suites) / sizeof(suites[0]);
+
+  if (argc > 1) {
+    for (size_t i = 0; i < count; i++) {
+      if (strcmp(argv[1], suites[i].name) == 0)
+        return suites[i].run(argc - 1, argv + 1);
+    }
+    printf("未知的测试套件：%s\n", argv[1]);
+  }
+
+  printf("用法：bench <套件名> [最大规模] [--format=table|csv|json] "
+         "[--out=文件]\n");
+  for (size_t i = 0; i < count; i++)
+    printf("  %-12s %s\n", suites[i].name, suites[i].brief);
+
+  return argc > 1;
+}
@@ -0,0 +1,461 @@
+/*
+ * @file bench_ops.c
+ * @brief data_struct.h 全部操作的基准测试
+ * @author ringtree
+ * @date 2025-09-20
+ * @version 1.0
+ *
+ * 对 data_struct.h（及 sl_distinct.h）中导出的每个 SL_* 函数，在 10^2 至默认 10^7 的规模、
+ * 以下五种数据分布上计时：
+ * - uniform  ：[-10^6, 10^6] 均匀随机；
+ * - sorted   ：uniform 升序排列；
+ * - reverse  ：uniform 降序排列；
+ * - dups     ：只有 16 种取值；
+ * - randlink ：由 SL_randLink(link, n, -1000, 1000) 生成。
+ *
+ * 结果单位为每次操作的纳秒数；建表、导出、释放等批量操作按每个元素计。
+ * O(n) 的单次操作按总扫描量约 BENCH_OPS_BUDGET 个节点确定重复次数，
+ * O(n²) 的操作（插入排序）只在 n <= BENCH_OPS_QUADRATIC_MAX 时测试。
+ *
+ * 用法：bench ops [最大规模] [--format=table|csv|json] [--out=文件]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "other.h"
+#include "sl_distinct.h"
+
+/**
+ * @brief O(n) 单次操作的总扫描节点预算
+ */
+#define BENCH_OPS_BUDGET 20000000u
+
+/**
+ * @brief O(n) 单次操作的最大重复次数
+ */
+#define BENCH_OPS_MAX_ITERS 1000u
+
+/**
+ * @brief O(n²) 操作参与测试的最大规模
+ */
+#define BENCH_OPS_QUADRATIC_MAX 10000u
+
+/**
+ * @brief 测试上下文
+ */
+typedef struct bench_ctx {
+  bench_report *report;   ///< 结果输出器
+  const char *dist;       ///< 数据分布名称
+  uint32 n;               ///< 链表规模
+  const Elemtype *values; ///< 链表初始数据
+  uint32 seed;            ///< 随机下标生成器状态
+} bench_ctx;
+
+/**
+ * @brief 生成伪随机下标 [0, bound)
+ */
+static uint32 bench_rand(bench_ctx *const ctx, const uint32 bound) {
+  ctx->seed = ctx->seed * 1664525u + 1013904223u;
+  return (uint32)(((uint64)ctx->seed * bound) >> 32);
+}
+
+/**
+ * @brief 计算 O(n) 单次操作的重复次数
+ */
+static uint32 bench_iters(const uint32 n) {
+  uint32 iters = BENCH_OPS_BUDGET / (n ? n : 1);
+  if (iters < 1)
+    iters = 1;
+  return iters > BENCH_OPS_MAX_ITERS ? BENCH_OPS_MAX_ITERS : iters;
+}
+
+/**
+ * @brief 按上下文数据逐个尾插构建 malloc 模式链表（不计时）
+ */
+static SL_link *bench_makeLink(const bench_ctx *const ctx) {
+  SL_link *link = SL_inifLink();
+  for (uint32 i = 0; i < ctx->n; i++)
+    SL_add(link, ctx->values[i]);
+  return link;
+}
+
+/**
+ * @brief 按分布生成测试数据
+ *
+ * @return Elemtype* 长度为 n 的数据数组，需调用者释放
+ */
+static Elemtype *bench_makeValues(const char *dist, const uint32 n) {
+  Elemtype *values = (Elemtype *)malloc(sizeof(Elemtype) * (n ? n : 1));
+
+  if (strcmp(dist, "randlink") == 0) {
+    SL_link *link = SL_inifLink();
+    SL_randLink(link, n, -1000, 1000);
+    SL_toArray(link, values, n);
+    SL_freeLinks(link);
+    return values;
+  }
+
+  for (uint32 i = 0; i < n; i++) {
+    values[i] = strcmp(dist, "dups") == 0
+                    ? rand() % 16
+                    : (Elemtype)(((uint32)rand() * 2654435761u) % 2000001u) -
+                          1000000;
+  }
+
+  if (strcmp(dist, "sorted") == 0 || strcmp(dist, "reverse") == 0) {
+    SL_link *link = SL_fromArray(values, n);
+    SL_sort_Radix(link, strcmp(dist, "sorted") == 0 ? ASC : DESC);
+    SL_toArray(link, values, n);
+    SL_freeLinks(link);
+  }
+
+  return values;
+}
+
+/**
+ * @brief 记录一条结果
+ */
+static void bench_row(bench_ctx *const ctx, const char *op, const uint32 iters,
+                      const d64 seconds) {
+  bench_reportRow(ctx->report, op, ctx->dist, ctx->n, iters, seconds);
+}
+
+/**
+ * @brief 空回调（SL_forEachMatch 测试用）
+ */
+static uint16 bench_visitNothing(SL_node *const node, const uint32 index,
+                                 void *const context) {
+  (void)node;
+  (void)index;
+  (void)context;
+  return 0;
+}
+
+/**
+ * @brief 创建与释放类操作
+ */
+static void bench_opsLifecycle(bench_ctx *const ctx) {
+  SL_link *links[BENCH_OPS_MAX_ITERS];
+
+  d64 start = bench_now();
+  for (uint32 i = 0; i < BENCH_OPS_MAX_ITERS; i++)
+    links[i] = SL_inifLink();
+  bench_row(ctx, "SL_inifLink", BENCH_OPS_MAX_ITERS, bench_now() - start);
+  for (uint32 i = 0; i < BENCH_OPS_MAX_ITERS; i++)
+    SL_freeLinks(links[i]);
+
+  start = bench_now();
+  for (uint32 i = 0; i < BENCH_OPS_MAX_ITERS; i++)
+    links[i] = SL_inifLinkPool(NULL);
+  bench_row(ctx, "SL_inifLinkPool", BENCH_OPS_MAX_ITERS, bench_now() - start);
+  for (uint32 i = 0; i < BENCH_OPS_MAX_ITERS; i++)
+    SL_freeLinks(links[i]);
+
+  SL_link *link = bench_makeLink(ctx);
+  start = bench_now();
+  SL_freeNodes(link);
+  bench_row(ctx, "SL_freeNodes", ctx->n, bench_now() - start);
+  SL_freeLinks(link);
+
+  link = bench_makeLink(ctx);
+  start = bench_now();
+  SL_freeLinks(link);
+  bench_row(ctx, "SL_freeLinks", ctx->n, bench_now() - start);
+}
+
+/**
+ * @brief 插入类操作
+ */
+static void bench_opsInsert(bench_ctx *const ctx) {
+  uint32 n = ctx->n;
+
+  SL_link *link = SL_inifLink();
+  d64 start = bench_now();
+  for (uint32 i = 0; i < n; i++)
+    SL_insertHead(link, ctx->values[i]);
+  bench_row(ctx, "SL_insertHead", n, bench_now() - start);
+  SL_freeLinks(link);
+
+  link = SL_inifLink();
+  start = bench_now();
+  for (uint32 i = 0; i < n; i++)
+    SL_add(link, ctx->values[i]);
+  bench_row(ctx, "SL_add", n, bench_now() - start);
+  SL_freeLinks(link);
+
+  link = SL_inifLink();
+  const Elemtype *v = ctx->values;
+  start = bench_now();
+  for (uint32 i = 0; i + 8 <= n; i += 8)
+    SL_extind(link, 8, v[i], v[i + 1], v[i + 2], v[i + 3], v[i + 4], v[i + 5],
+              v[i + 6], v[i + 7]);
+  bench_row(ctx, "SL_extind", n / 8 * 8, bench_now() - start);
+  SL_freeLinks(link);
+
+  start = bench_now();
+  link = SL_fromArray(ctx->values, n);
+  bench_row(ctx, "SL_fromArray", n, bench_now() - start);
+  SL_freeLinks(link);
+
+  link = SL_inifLink();
+  start = bench_now();
+  SL_appendArray(link, ctx->values, n);
+  bench_row(ctx, "SL_appendArray", n, bench_now() - start);
+  SL_freeLinks(link);
+
+  link = bench_makeLink(ctx);
+  uint32 iters = bench_iters(n);
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    SL_insert(link, ctx->values[i % n], bench_rand(ctx, link->length));
+  bench_row(ctx, "SL_insert", iters, bench_now() - start);
+  SL_freeLinks(link);
+}
+
+/**
+ * @brief 查找类操作
+ */
+static void bench_opsFind(bench_ctx *const ctx) {
+  uint32 n = ctx->n;
+  uint32 iters = bench_iters(n);
+  SL_link *link = bench_makeLink(ctx);
+  volatile uint32 sink = 0;
+  uint32 count = 0;
+
+  d64 start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    sink += SL_count(link, ctx->values[bench_rand(ctx, n)]);
+  bench_row(ctx, "SL_count", iters, bench_now() - start);
+
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++) {
+    SL_node **nodes = SL_find(link, ctx->values[bench_rand(ctx, n)], &count);
+    sink += count;
+    free(nodes);
+  }
+  bench_row(ctx, "SL_find", iters, bench_now() - start);
+
+  SL_node *buffer[64];
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    sink += SL_findInto(link, ctx->values[bench_rand(ctx, n)], buffer, 64);
+  bench_row(ctx, "SL_findInto", iters, bench_now() - start);
+
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    sink += SL_forEachMatch(link, ctx->values[bench_rand(ctx, n)],
+                            bench_visitNothing, NULL);
+  bench_row(ctx, "SL_forEachMatch", iters, bench_now() - start);
+
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    sink += SL_getIndex(link, ctx->values[bench_rand(ctx, n)]);
+  bench_row(ctx, "SL_getIndex", iters, bench_now() - start);
+
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    sink += (fast_slow_find(link, 1 + bench_rand(ctx, n)) != NULL);
+  bench_row(ctx, "fast_slow_find", iters, bench_now() - start);
+
+  // 第二个链表：前半段数据不同，后半段与 link 相同
+  SL_link *other = SL_inifLink();
+  for (uint32 i = 0; i < n; i++)
+    SL_add(other, i < n / 2 ? ctx->values[i] + 1 : ctx->values[i]);
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    sink += (same_suffix(link, other, &count) != NULL);
+  bench_row(ctx, "same_suffix", iters, bench_now() - start);
+  SL_freeLinks(other);
+
+  Elemtype *array = (Elemtype *)malloc(sizeof(Elemtype) * n);
+  start = bench_now();
+  SL_toArray(link, array, n);
+  bench_row(ctx, "SL_toArray", n, bench_now() - start);
+  free(array);
+
+  if (n <= 1000000) {
+    start = bench_now();
+    SL_traverseLink(link);
+    bench_row(ctx, "SL_traverseLink", n, bench_now() - start);
+  }
+
+  start = bench_now();
+  SL_get_set(link);
+  bench_row(ctx, "SL_get_set", n, bench_now() - start);
+
+  start = bench_now();
+  SL_link *distinct = SL_distinct(link, DISTINCT_RAW);
+  bench_row(ctx, "SL_distinct", n, bench_now() - start);
+  SL_freeLinks(distinct);
+
+  static const struct {
+    const char *name;
+    enum distinctMethod method;
+  } methods[] = {{"SL_distinctArray/bitset", DISTINCT_BITSET},
+                 {"SL_distinctArray/hash", DISTINCT_HASH},
+                 {"SL_distinctArray/sort", DISTINCT_SORT}};
+  for (size_t m = 0; m < sizeof(methods) / sizeof(methods[0]); m++) {
+    uint32 count = 0;
+    start = bench_now();
+    Elemtype *values =
+        SL_distinctArray(link, DISTINCT_RAW, methods[m].method, &count);
+    bench_row(ctx, methods[m].name, n, bench_now() - start);
+    sink += count;
+    free(values);
+  }
+
+  SL_freeLinks(link);
+  (void)sink;
+}
+
+/**
+ * @brief 修改类操作（排序、反转、约瑟夫环）
+ */
+static void bench_opsModify(bench_ctx *const ctx) {
+  uint32 n = ctx->n;
+  static const struct {
+    const char *name;
+    void (*sort)(SL_link *const, enum sort);
+    uint16 quadratic;
+  } sorts[] = {{"SL_sort_Insertion", SL_sort_Insertion, 1},
+               {"SL_sort_Merge", SL_sort_Merge, 0},
+               {"SL_sort_Radix", SL_sort_Radix, 0}};
+
+  for (size_t s = 0; s < sizeof(sorts) / sizeof(sorts[0]); s++) {
+    if (sorts[s].quadratic && n > BENCH_OPS_QUADRATIC_MAX)
+      continue;
+    SL_link *link = bench_makeLink(ctx);
+    d64 start = bench_now();
+    sorts[s].sort(link, ASC);
+    bench_row(ctx, sorts[s].name, 1, bench_now() - start);
+    SL_freeLinks(link);
+  }
+
+  SL_link *link = bench_makeLink(ctx);
+  uint32 iters = bench_iters(n);
+  d64 start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    SL_reverse(link);
+  bench_row(ctx, "SL_reverse", iters, bench_now() - start);
+  SL_freeLinks(link);
+
+  link = bench_makeLink(ctx);
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    SL_josephusPeek(link, 3);
+  bench_row(ctx, "SL_josephusPeek", iters, bench_now() - start);
+
+  start = bench_now();
+  SL_josephusSurvivor(link, 3);
+  bench_row(ctx, "SL_josephusSurvivor", 1, bench_now() - start);
+  SL_freeLinks(link);
+
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    SL_josephusIndex(n, 3);
+  bench_row(ctx, "SL_josephusIndex", iters, bench_now() - start);
+
+  uint32 *order = (uint32 *)malloc(sizeof(uint32) * n);
+  if (order) {
+    start = bench_now();
+    SL_josephusOrder(n, 3, order);
+    bench_row(ctx, "SL_josephusOrder", 1, bench_now() - start);
+    free(order);
+  }
+}
+
+/**
+ * @brief 删除类操作
+ */
+static void bench_opsDelete(bench_ctx *const ctx) {
+  uint32 n = ctx->n;
+  uint32 iters = bench_iters(n);
+  if (iters > n / 2)
+    iters = n / 2 ? n / 2 : 1;
+
+  SL_link *link = bench_makeLink(ctx);
+  d64 start = bench_now();
+  for (uint32 i = 0; i < n; i++)
+    SL_delHead(link);
+  bench_row(ctx, "SL_delHead", n, bench_now() - start);
+  SL_freeLinks(link);
+
+  link = bench_makeLink(ctx);
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    SL_delEnd(link);
+  bench_row(ctx, "SL_delEnd", iters, bench_now() - start);
+  SL_freeLinks(link);
+
+  // 预先取出互不相同的中间节点句柄
+  link = bench_makeLink(ctx);
+  SL_node **handles = (SL_node **)malloc(sizeof(SL_node *) * iters);
+  SL_node *cur = link->headIndex;
+  uint32 stride = n / iters;
+  for (uint32 i = 0, k = 0; cur && k < iters; cur = cur->next, i++) {
+    if (i % stride == stride / 2)
+      handles[k++] = cur;
+  }
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    SL_deleteNode(link, handles[i]);
+  bench_row(ctx, "SL_deleteNode", iters, bench_now() - start);
+  free(handles);
+  SL_freeLinks(link);
+
+  link = bench_makeLink(ctx);
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    SL_deleteIndex(link, bench_rand(ctx, link->length));
+  bench_row(ctx, "SL_deleteIndex", iters, bench_now() - start);
+  SL_freeLinks(link);
+
+  link = bench_makeLink(ctx);
+  start = bench_now();
+  for (uint32 i = 0; i < iters; i++)
+    SL_deleteData(link, ctx->values[bench_rand(ctx, n)], 1);
+  bench_row(ctx, "SL_deleteData", iters, bench_now() - start);
+  SL_freeLinks(link);
+
+  link = bench_makeLink(ctx);
+  start = bench_now();
+  SL_deleteData(link, ctx->values[0], 0);
+  bench_row(ctx, "SL_deleteData/all", 1, bench_now() - start);
+  SL_freeLinks(link);
+}
+
+int bench_ops(int argc, char *argv[]) {
+  static const char *dists[] = {"uniform", "sorted", "reverse", "dups",
+                                "randlink"};
+  uint32 maxSize = bench_maxSize(argc, argv, 10000000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "ops"))
+    return 1;
+
+  srand(2025);
+  for (uint32 n = 100; n <= maxSize; n *= 10) {
+    for (size_t d = 0; d < sizeof(dists) / sizeof(dists[0]); d++) {
+      bench_ctx ctx = {&report, dists[d], n, NULL, 12345u};
+      Elemtype *values = bench_makeValues(dists[d], n);
+      ctx.values = values;
+
+      bench_opsLifecycle(&ctx);
+      bench_opsInsert(&ctx);
+      bench_opsFind(&ctx);
+      bench_opsModify(&ctx);
+      bench_opsDelete(&ctx);
+
+      free(values);
+    }
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  bench_reportClose(&report);
+  return 0;
+}
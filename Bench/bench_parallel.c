@@ -0,0 +1,120 @@
+/*
+ * @file bench_parallel.c
+ * @brief 并行分段归约与单线程遍历的对比
+ * @author ringtree
+ * @date 2025-09-30
+ * @version 1.0
+ *
+ * 在 [链表长度] 个元素（默认 10^7，节点池分配）的链表上，线程数取 1, 2, 4, 8, 16：
+ * - SL_count                        ：单线程基准（threads=1 行）；
+ * - PL_inifSplit                    ：一次遍历建立分段表（按每个元素计）；
+ * - PL_count / PL_reduce            ：PL_STATIC 调度；
+ * - PL_count/steal                  ：PL_STEALING 调度；
+ * - PL_countIf/skewed               ：前 1/8 元素的谓词代价约为其余元素的 64 倍，
+ *                                     分别以两种调度运行，体现窃取的收益。
+ * 结果为每个元素的纳秒数，线程数超过 CPU 核数时不再有加速。
+ *
+ * 用法：bench parallel [链表长度] [--format=table|csv|json] [--out=文件]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_parallel.h"
+
+/**
+ * @brief 最大测试线程数
+ */
+#define BENCH_PL_MAX_THREADS 16
+
+/**
+ * @brief 每项测试的重复次数
+ */
+#define BENCH_PL_ITERS 5u
+
+/**
+ * @brief 代价不均的谓词：负数（位于链表前 1/8）需要额外计算
+ */
+static uint16 bench_skewed(const Elemtype data, void *const context) {
+  (void)context;
+  if (data >= 0)
+    return data & 1;
+
+  uint32 x = (uint32)data;
+  for (uint32 i = 0; i < 64; i++)
+    x = x * 1664525u + 1013904223u;
+  return x & 1;
+}
+
+int bench_parallel(int argc, char *argv[]) {
+  uint32 n = bench_maxSize(argc, argv, 10000000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "parallel"))
+    return 1;
+
+  SL_link *link = SL_inifLinkPool(NULL);
+  uint32 state = 12345u;
+  for (uint32 i = 0; i < n; i++) {
+    state = state * 1664525u + 1013904223u;
+    Elemtype data = (Elemtype)(state >> 12);
+    SL_add(link, i < n / 8 ? -data - 1 : data);
+  }
+  volatile uint32 sink = 0;
+  uint32 work = n * BENCH_PL_ITERS;
+
+  d64 start = bench_now();
+  for (uint32 i = 0; i < BENCH_PL_ITERS; i++)
+    sink += SL_count(link, (Elemtype)i);
+  bench_reportRow(&report, "SL_count", "threads=1", n, work,
+                  bench_now() - start);
+
+  for (uint32 threads = 1; threads <= BENCH_PL_MAX_THREADS; threads *= 2) {
+    char dist[32];
+    snprintf(dist, sizeof(dist), "threads=%u", threads);
+    PL_pool *pool = PL_inifPool(threads);
+    if (!pool)
+      break;
+
+    start = bench_now();
+    PL_split *split = PL_inifSplit(link, threads * PL_SEGMENTS_PER_THREAD);
+    bench_reportRow(&report, "PL_inifSplit", dist, n, n, bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < BENCH_PL_ITERS; i++)
+      sink += PL_count(pool, split, PL_STATIC, (Elemtype)i);
+    bench_reportRow(&report, "PL_count", dist, n, work, bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < BENCH_PL_ITERS; i++)
+      sink += PL_count(pool, split, PL_STEALING, (Elemtype)i);
+    bench_reportRow(&report, "PL_count/steal", dist, n, work,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < BENCH_PL_ITERS; i++)
+      sink += PL_reduce(pool, split, PL_STATIC).count;
+    bench_reportRow(&report, "PL_reduce", dist, n, work, bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < BENCH_PL_ITERS; i++)
+      sink += PL_countIf(pool, split, PL_STATIC, bench_skewed, NULL);
+    bench_reportRow(&report, "PL_countIf/skewed", dist, n, work,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < BENCH_PL_ITERS; i++)
+      sink += PL_countIf(pool, split, PL_STEALING, bench_skewed, NULL);
+    bench_reportRow(&report, "PL_countIf/skewed+steal", dist, n, work,
+                    bench_now() - start);
+
+    PL_freeSplit(split);
+    PL_freePool(pool);
+  }
+
+  SL_freeLinks(link);
+  (void)sink;
+  bench_reportClose(&report);
+  return 0;
+}
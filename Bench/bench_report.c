@@ -0,0 +1,157 @@
+/*
+ * @file bench_report.c
+ * @brief 基准测试结果输出
+ * @author ringtree
+ * @date 2025-09-20
+ * @version 1.0
+ *
+ * 以表格、CSV 或 JSON 格式输出测试结果，JSON 格式与 Google Benchmark 的
+ * --benchmark_format=json 输出保持相同的顶层结构（context + benchmarks），
+ * 便于用现有工具比较不同版本之间的性能回归。
+ */
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define bench_dup _dup
+#define bench_dup2 _dup2
+#define bench_fdopen _fdopen
+#define bench_open _open
+#define bench_close _close
+#define BENCH_NULL_DEVICE "NUL"
+#else
+#include <unistd.h>
+#define bench_dup dup
+#define bench_dup2 dup2
+#define bench_fdopen fdopen
+#define bench_open open
+#define bench_close close
+#define BENCH_NULL_DEVICE "/dev/null"
+#endif
+
+#include "bench.h"
+#include "data_struct.h"
+
+/**
+ * @brief 打开结果输出器
+ *
+ * 解析 --format 与 --out 参数，写出格式头部，并把标准输出重定向到空设备。
+ *
+ * @param report 输出器
+ * @param argc 套件参数个数
+ * @param argv 套件参数
+ * @param suite 套件名称（写入 JSON context）
+ * @return uint16 成功返回1，输出文件无法打开返回0
+ */
+uint16 bench_reportOpen(bench_report *const report, int argc, char *argv[],
+                        const char *suite) {
+  const char *format = bench_option(argc, argv, "format");
+  const char *path = bench_option(argc, argv, "out");
+
+  report->format = BENCH_TABLE;
+  if (format && strcmp(format, "csv") == 0)
+    report->format = BENCH_CSV;
+  else if (format && strcmp(format, "json") == 0)
+    report->format = BENCH_JSON;
+  report->rows = 0;
+
+  fflush(stdout);
+  report->out = path ? fopen(path, "w")
+                     : bench_fdopen(bench_dup(fileno(stdout)), "w");
+  if (!report->out) {
+    printf("无法打开结果输出：%s\n", path ? path : "stdout");
+    return 0;
+  }
+
+  // 屏蔽被测函数自身的打印
+  report->savedStdout = bench_dup(fileno(stdout));
+  int nul = bench_open(BENCH_NULL_DEVICE, O_WRONLY);
+  if (nul >= 0) {
+    bench_dup2(nul, fileno(stdout));
+    bench_close(nul);
+  }
+
+  char date[32];
+  time_t now = time(NULL);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+  switch (report->format) {
+  case BENCH_CSV:
+    fprintf(report->out, "name,op,dist,n,iterations,seconds,ns_per_op\n");
+    break;
+  case BENCH_JSON:
+    fprintf(report->out,
+            "{\n  \"context\": {\n    \"date\": \"%s\",\n"
+            "    \"suite\": \"%s\",\n    \"elemtype_bytes\": %u\n  },\n"
+            "  \"benchmarks\": [",
+            date, suite, (uint32)sizeof(Elemtype));
+    break;
+  default:
+    fprintf(report->out, "# %s %s\n%-22s %-10s %10s %10s %14s\n", suite, date,
+            "op", "dist", "n", "iters", "ns/op");
+    break;
+  }
+
+  return 1;
+}
+
+/**
+ * @brief 输出一条测试结果
+ *
+ * @param report 输出器
+ * @param op 操作名称
+ * @param dist 数据分布名称
+ * @param n 链表规模
+ * @param iters 操作执行次数
+ * @param seconds 总耗时（秒）
+ */
+void bench_reportRow(bench_report *const report, const char *op,
+                     const char *dist, const uint32 n, const uint32 iters,
+                     const d64 seconds) {
+  d64 perOp = iters ? seconds * 1e9 / iters : 0.0;
+
+  switch (report->format) {
+  case BENCH_CSV:
+    fprintf(report->out, "%s/%s/%u,%s,%s,%u,%u,%.9f,%.2f\n", op, dist, n, op,
+            dist, n, iters, seconds, perOp);
+    break;
+  case BENCH_JSON:
+    fprintf(report->out,
+            "%s\n    {\"name\": \"%s/%s/%u\", \"op\": \"%s\", \"dist\": \"%s\", "
+            "\"n\": %u, \"iterations\": %u, \"real_time\": %.2f, "
+            "\"time_unit\": \"ns\"}",
+            report->rows ? "," : "", op, dist, n, op, dist, n, iters, perOp);
+    break;
+  default:
+    fprintf(report->out, "%-22s %-10s %10u %10u %14.2f\n", op, dist, n, iters,
+            perOp);
+    break;
+  }
+
+  report->rows++;
+  fflush(report->out);
+}
+
+/**
+ * @brief 关闭结果输出器并恢复标准输出
+ *
+ * @param report 输出器
+ */
+void bench_reportClose(bench_report *const report) {
+  if (report->format == BENCH_JSON)
+    fprintf(report->out, "\n  ]\n}\n");
+  fclose(report->out);
+
+  fflush(stdout);
+  if (report->savedStdout >= 0) {
+    bench_dup2(report->savedStdout, fileno(stdout));
+    bench_close(report->savedStdout);
+  }
+}
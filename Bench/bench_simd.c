@@ -0,0 +1,108 @@
+/*
+ * @file bench_simd.c
+ * @brief 连续快照向量化扫描与逐节点扫描性能对比
+ * @author ringtree
+ * @date 2025-09-16
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^4 至默认 10^7）对比链表逐节点扫描与快照
+ * 向量化内核的吞吐量（百万元素/秒），并单独给出快照重建耗时：
+ * - count    ：SL_count / SL_snapCount；
+ * - getIndex ：SL_getIndex / SL_snapGetIndex（查找不存在的值）；
+ * - absRange ：逐节点求绝对值范围 / SL_snapAbsRange；
+ * - sum      ：逐节点求和 / SL_snapSum。
+ *
+ * 用法：bench simd [最大规模]
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_simd.h"
+
+/**
+ * @brief 每项测试重复次数（取总耗时）
+ */
+#define BENCH_SIMD_REPEAT 5
+
+/**
+ * @brief 打印一行对比结果
+ */
+static void bench_simdRow(const uint32 n, const char *name, const d64 link,
+                          const d64 snap) {
+  d64 items = (d64)n * BENCH_SIMD_REPEAT / 1e6;
+  printf("%-10u %-10s %14.1f %14.1f %9.1fx\n", n, name, items / link,
+         items / snap, link / snap);
+}
+
+int bench_simd(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 10000000);
+  volatile int64 sink = 0;
+
+  printf("指令集：%s\n", SL_simdLevel());
+  printf("%-10s %-10s %14s %14s %10s\n", "n", "op", "link(M/s)", "snap(M/s)",
+         "speedup");
+  for (uint32 n = 10000; n <= maxSize; n *= 10) {
+    SL_link *link = SL_inifLink();
+    for (uint32 i = 0; i < n; i++)
+      SL_add(link, (Elemtype)(rand() % 2001) - 1000);
+
+    d64 start = bench_now();
+    SL_snapshot *snap = SL_inifSnapshot(link);
+    printf("%-10u %-10s %14.6f s\n", n, "refresh", bench_now() - start);
+
+    d64 t0 = bench_now();
+    for (int r = 0; r < BENCH_SIMD_REPEAT; r++)
+      sink += SL_count(link, 7);
+    d64 t1 = bench_now();
+    for (int r = 0; r < BENCH_SIMD_REPEAT; r++)
+      sink += SL_snapCount(snap, 7);
+    bench_simdRow(n, "count", t1 - t0, bench_now() - t1);
+
+    t0 = bench_now();
+    for (int r = 0; r < BENCH_SIMD_REPEAT; r++)
+      sink += SL_getIndex(link, 5000);
+    t1 = bench_now();
+    for (int r = 0; r < BENCH_SIMD_REPEAT; r++)
+      sink += SL_snapGetIndex(snap, 5000);
+    bench_simdRow(n, "getIndex", t1 - t0, bench_now() - t1);
+
+    t0 = bench_now();
+    for (int r = 0; r < BENCH_SIMD_REPEAT; r++) {
+      uint32 lo = UINT32_MAX, hi = 0;
+      for (SL_node *cur = link->headIndex; cur; cur = cur->next) {
+        uint32 a = cur->data < 0 ? 0u - (uint32)cur->data : (uint32)cur->data;
+        lo = a < lo ? a : lo;
+        hi = a > hi ? a : hi;
+      }
+      sink += lo + hi;
+    }
+    t1 = bench_now();
+    for (int r = 0; r < BENCH_SIMD_REPEAT; r++) {
+      uint32 lo = 0, hi = 0;
+      SL_snapAbsRange(snap, &lo, &hi);
+      sink += lo + hi;
+    }
+    bench_simdRow(n, "absRange", t1 - t0, bench_now() - t1);
+
+    t0 = bench_now();
+    for (int r = 0; r < BENCH_SIMD_REPEAT; r++)
+      for (SL_node *cur = link->headIndex; cur; cur = cur->next)
+        sink += cur->data;
+    t1 = bench_now();
+    for (int r = 0; r < BENCH_SIMD_REPEAT; r++)
+      sink += SL_snapSum(snap);
+    bench_simdRow(n, "sum", t1 - t0, bench_now() - t1);
+
+    SL_freeSnapshot(snap);
+    SL_freeLinks(link);
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  (void)sink;
+  return 0;
+}
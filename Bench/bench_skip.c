@@ -0,0 +1,129 @@
+/*
+ * @file bench_skip.c
+ * @brief 跳表索引与逐节点遍历的对比
+ * @author ringtree
+ * @date 2025-09-26
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^3 至默认 10^6）在升序链表上对比：
+ * - SL_getIndex / SK_getIndex        ：按值查找；
+ * - fast_slow_find / SK_getNode      ：按（倒数）下标访问；
+ * - SL_insert / SK_insert            ：随机下标插入；
+ * - SL_deleteIndex / SK_deleteIndex  ：随机下标删除；
+ * - SK_refresh                       ：链表被外部修改后的重建（按每个元素计）。
+ * 逐节点遍历的操作按总扫描量约 BENCH_SKIP_BUDGET 个节点确定重复次数。
+ *
+ * 用法：bench skip [最大规模] [--format=table|csv|json] [--out=文件]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_skip.h"
+
+/**
+ * @brief O(n) 操作的总扫描节点预算
+ */
+#define BENCH_SKIP_BUDGET 20000000u
+
+/**
+ * @brief 每项测试的最大重复次数
+ */
+#define BENCH_SKIP_MAX_ITERS 100000u
+
+/**
+ * @brief 生成伪随机数 [0, bound)
+ */
+static uint32 bench_skipRand(uint32 *const state, const uint32 bound) {
+  *state = *state * 1664525u + 1013904223u;
+  return (uint32)(((uint64)*state * bound) >> 32);
+}
+
+int bench_skip(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 1000000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "skip"))
+    return 1;
+
+  for (uint32 n = 1000; n <= maxSize; n *= 10) {
+    uint32 linear = BENCH_SKIP_BUDGET / n;
+    if (linear < 1)
+      linear = 1;
+    if (linear > BENCH_SKIP_MAX_ITERS)
+      linear = BENCH_SKIP_MAX_ITERS;
+    uint32 logIters = BENCH_SKIP_MAX_ITERS;
+    uint32 state = 12345u;
+    volatile uint32 sink = 0;
+
+    // 升序数据：偶数 0, 2, 4, ...，查找时一半命中
+    SL_link *link = SL_inifLinkPool(NULL);
+    for (uint32 i = 0; i < n; i++)
+      SL_add(link, (Elemtype)(i * 2));
+    SK_index *skip = SK_inifIndex(link);
+
+    d64 start = bench_now();
+    for (uint32 i = 0; i < linear; i++)
+      sink += SL_getIndex(link, (Elemtype)bench_skipRand(&state, 2 * n));
+    bench_reportRow(&report, "SL_getIndex", "sorted", n, linear,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < logIters; i++)
+      sink += SK_getIndex(skip, (Elemtype)bench_skipRand(&state, 2 * n));
+    bench_reportRow(&report, "SK_getIndex", "sorted", n, logIters,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < linear; i++)
+      sink += fast_slow_find(link, 1 + bench_skipRand(&state, n)) != NULL;
+    bench_reportRow(&report, "fast_slow_find", "sorted", n, linear,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < logIters; i++)
+      sink += SK_getNode(skip, bench_skipRand(&state, n)) != NULL;
+    bench_reportRow(&report, "SK_getNode", "sorted", n, logIters,
+                    bench_now() - start);
+
+    // 插入、删除成对进行，保持链表规模不变
+    start = bench_now();
+    for (uint32 i = 0; i < linear; i++)
+      SL_insert(link, 1, bench_skipRand(&state, n));
+    bench_reportRow(&report, "SL_insert", "sorted", n, linear,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < linear; i++)
+      SL_deleteIndex(link, bench_skipRand(&state, n));
+    bench_reportRow(&report, "SL_deleteIndex", "sorted", n, linear,
+                    bench_now() - start);
+
+    start = bench_now();
+    SK_refresh(skip); // 上面的 SL_* 修改使索引过期
+    bench_reportRow(&report, "SK_refresh", "sorted", n, n, bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < logIters; i++)
+      SK_insert(skip, 1, bench_skipRand(&state, n));
+    bench_reportRow(&report, "SK_insert", "sorted", n, logIters,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 i = 0; i < logIters; i++)
+      SK_deleteIndex(skip, bench_skipRand(&state, n));
+    bench_reportRow(&report, "SK_deleteIndex", "sorted", n, logIters,
+                    bench_now() - start);
+
+    SK_freeIndex(skip);
+    SL_freeLinks(link);
+    (void)sink;
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  bench_reportClose(&report);
+  return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * @file bench_sort.c
+ * @brief 链表排序算法性能对比
+ * @author ringtree
+ * @date 2025-09-08
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^3 至默认 10^7）对比 SL_sort_Insertion、
+ * SL_sort_Merge 与 SL_sort_Radix 在不同有序程度输入下的耗时：
+ * - random  ：完全随机；
+ * - sorted  ：已升序；
+ * - reverse ：已降序；
+ * - nearly  ：升序后随机交换 1% 的元素；
+ * - dups    ：只有 16 种取值的大量重复数据。
+ * 插入排序为O(n²)，规模超过 SL_BENCH_INSERTION_MAX 时跳过（输出 -）。
+ *
+ * 用法：bench sort [最大规模]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+
+/**
+ * @brief 插入排序参与测试的最大规模
+ */
+#define SL_BENCH_INSERTION_MAX 100000
+
+/**
+ * @brief 按指定有序程度生成测试数据
+ *
+ * @param array 输出数组
+ * @param n 元素个数
+ * @param kind 数据分布名称
+ */
+static void bench_fillSort(Elemtype *const array, const uint32 n,
+                           const char kind) {
+  for (uint32 i = 0; i < n; i++) {
+    switch (kind) {
+    case 's': array[i] = (Elemtype)i; break;
+    case 'r': array[i] = (Elemtype)(n - i); break;
+    case 'n': array[i] = (Elemtype)i; break;
+    case 'd': array[i] = rand() % 16; break;
+    default: array[i] = rand(); break;
+    }
+  }
+
+  if (kind == 'n') { // 随机交换 1% 的元素
+    for (uint32 k = 0; k < n / 100; k++) {
+      uint32 i = (uint32)rand() % n;
+      uint32 j = (uint32)rand() % n;
+      Elemtype temp = array[i];
+      array[i] = array[j];
+      array[j] = temp;
+    }
+  }
+}
+
+/**
+ * @brief 用指定排序函数对数组构建的链表计时
+ *
+ * @return d64 排序耗时（秒）
+ */
+static d64 bench_timeSort(void (*sortFn)(SL_link *const, enum sort),
+                          const Elemtype *const array, const uint32 n) {
+  SL_link *link = SL_fromArray(array, n);
+  d64 start = bench_now();
+  sortFn(link, ASC);
+  d64 seconds = bench_now() - start;
+  SL_freeLinks(link);
+  return seconds;
+}
+
+int bench_sort(int argc, char *argv[]) {
+  static const struct {
+    char kind;
+    const char *name;
+  } dists[] = {{'x', "random"}, {'s', "sorted"}, {'r', "reverse"},
+               {'n', "nearly"}, {'d', "dups"}};
+  uint32 maxSize = bench_maxSize(argc, argv, 10000000);
+
+  srand(2025);
+  printf("%-10s %-10s %14s %14s %14s\n", "n", "input", "insertion(s)",
+         "merge(s)", "radix(s)");
+  for (uint32 n = 1000; n <= maxSize; n *= 10) {
+    Elemtype *array = (Elemtype *)malloc(sizeof(Elemtype) * n);
+    for (size_t d = 0; d < sizeof(dists) / sizeof(dists[0]); d++) {
+      bench_fillSort(array, n, dists[d].kind);
+      d64 merge = bench_timeSort(SL_sort_Merge, array, n);
+      d64 radix = bench_timeSort(SL_sort_Radix, array, n);
+      if (n <= SL_BENCH_INSERTION_MAX) {
+        d64 insertion = bench_timeSort(SL_sort_Insertion, array, n);
+        printf("%-10u %-10s %14.6f %14.6f %14.6f\n", n, dists[d].name,
+               insertion, merge, radix);
+      } else {
+        printf("%-10u %-10s %14s %14.6f %14.6f\n", n, dists[d].name, "-",
+               merge, radix);
+      }
+    }
+    free(array);
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * @file bench_unrolled.c
+ * @brief 展开链表与单向链表扫描性能对比
+ * @author ringtree
+ * @date 2025-09-05
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^6 至默认 10^7，可通过参数指定到 10^8）对比：
+ * - SL_count / UL_count 全表计数；
+ * - SL_getIndex / UL_getIndex 查找不存在的值（同样扫描全表）。
+ * 单向链表分别测试节点顺序排布（按分配顺序）和随机排布（打乱 next 顺序）
+ * 两种内存布局，后者更接近长期增删后的真实情况。
+ *
+ * 用法：bench unrolled [最大规模]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_unrolled.h"
+
+/**
+ * @brief 打乱单向链表节点的连接顺序（不移动节点内存）
+ *
+ * @param link 单向链表
+ */
+static void bench_shuffleLinks(SL_link *const link) {
+  uint32 n = link->length;
+  SL_node **nodes = (SL_node **)malloc(sizeof(SL_node *) * n);
+  SL_node *cur = link->headIndex;
+  for (uint32 i = 0; i < n; i++, cur = cur->next)
+    nodes[i] = cur;
+
+  srand(12345);
+  for (uint32 i = n - 1; i > 0; i--) {
+    uint32 j = (uint32)(((uint64)rand() * RAND_MAX + rand()) % (i + 1));
+    SL_node *temp = nodes[i];
+    nodes[i] = nodes[j];
+    nodes[j] = temp;
+  }
+
+  for (uint32 i = 0; i + 1 < n; i++)
+    nodes[i]->next = nodes[i + 1];
+  nodes[n - 1]->next = NULL;
+  link->headIndex = nodes[0];
+  link->endIndex = nodes[n - 1];
+  free(nodes);
+}
+
+/**
+ * @brief 测试单向链表的两种扫描操作并打印结果
+ */
+static void bench_scanLink(SL_link *const link, const uint32 n,
+                           const char *name, d64 *outSeconds) {
+  d64 start = bench_now();
+  volatile uint32 sink = SL_count(link, 7);
+  outSeconds[0] = bench_now() - start;
+
+  start = bench_now();
+  sink = SL_getIndex(link, -1);
+  outSeconds[1] = bench_now() - start;
+  (void)sink;
+
+  printf("%-10u %-14s %12.6f %12.6f\n", n, name, outSeconds[0], outSeconds[1]);
+}
+
+int bench_unrolled(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 10000000);
+
+  printf("%-10s %-14s %12s %12s\n", "n", "case", "count(s)", "getIndex(s)");
+  for (uint32 n = 1000000; n <= maxSize; n *= 10) {
+    d64 seq[2], shuffled[2], unrolled[2];
+
+    SL_link *link = SL_inifLink();
+    SL_unrolled *list = UL_inifLink();
+    for (uint32 i = 0; i < n; i++) {
+      SL_add(link, (Elemtype)(i % 1000));
+      UL_add(list, (Elemtype)(i % 1000));
+    }
+
+    bench_scanLink(link, n, "SL/seq", seq);
+    bench_shuffleLinks(link);
+    bench_scanLink(link, n, "SL/shuffled", shuffled);
+    SL_freeLinks(link);
+
+    d64 start = bench_now();
+    volatile uint32 sink = UL_count(list, 7);
+    unrolled[0] = bench_now() - start;
+    start = bench_now();
+    sink = UL_getIndex(list, -1);
+    unrolled[1] = bench_now() - start;
+    (void)sink;
+    printf("%-10u %-14s %12.6f %12.6f\n", n, "UL", unrolled[0], unrolled[1]);
+    printf("%-10u %-14s %11.1fx %11.1fx\n", n, "speedup/seq",
+           seq[0] / unrolled[0], seq[1] / unrolled[1]);
+    printf("%-10u %-14s %11.1fx %11.1fx\n", n, "speedup/shuf",
+           shuffled[0] / unrolled[0], shuffled[1] / unrolled[1]);
+    UL_freeLinks(list);
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  return 0;
+}
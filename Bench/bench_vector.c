@@ -0,0 +1,159 @@
+/*
+ * @file bench_vector.c
+ * @brief 顺序存储后端与节点链表的交叉点测试
+ * @author ringtree
+ * @date 2025-09-27
+ * @version 1.0
+ *
+ * 以 4 倍递增的规模（16 至默认 2^20）分别在三种后端上运行同一组 SL_* 调用：
+ * - node   ：SL_inifLink()，逐节点 malloc；
+ * - pool   ：SL_inifLinkPool(NULL)，slab 节点池；
+ * - vector ：SL_inifLinkVector(0)，连续数组。
+ * 测试项为尾部追加、SL_count 全表扫描、随机下标插入/删除、头尾删除与归并排序，
+ * 按 dist 列（后端名）对比同一操作的耗时即可找到两种存储的交叉点。
+ *
+ * 用法：bench vector [最大规模] [--format=table|csv|json] [--out=文件]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "data_struct.h"
+
+/**
+ * @brief O(n) 操作的总处理元素预算
+ */
+#define BENCH_VECTOR_BUDGET 20000000u
+
+/**
+ * @brief 每项测试的最大重复次数
+ */
+#define BENCH_VECTOR_MAX_ITERS 100000u
+
+/**
+ * @brief 被测后端数量
+ */
+#define BENCH_VECTOR_BACKENDS 3
+
+static const char *const backendNames[BENCH_VECTOR_BACKENDS] = {"node", "pool",
+                                                                "vector"};
+
+/**
+ * @brief 生成伪随机数 [0, bound)
+ */
+static uint32 bench_vectorRand(uint32 *const state, const uint32 bound) {
+  *state = *state * 1664525u + 1013904223u;
+  return (uint32)(((uint64)*state * bound) >> 32);
+}
+
+/**
+ * @brief 按后端编号创建空链表
+ */
+static SL_link *bench_vectorCreate(const uint32 backend) {
+  switch (backend) {
+  case 0:
+    return SL_inifLink();
+  case 1:
+    return SL_inifLinkPool(NULL);
+  default:
+    return SL_inifLinkVector(0);
+  }
+}
+
+/**
+ * @brief 按顺序追加 n 个伪随机数据
+ */
+static void bench_vectorFill(SL_link *const link, const uint32 n,
+                             uint32 *const state) {
+  for (uint32 i = 0; i < n; i++)
+    SL_add(link, (Elemtype)bench_vectorRand(state, 1000000));
+}
+
+int bench_vector(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 1u << 20);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "vector"))
+    return 1;
+
+  for (uint32 n = 16; n <= maxSize; n *= 4) {
+    uint32 linear = BENCH_VECTOR_BUDGET / n;
+    if (linear < 1)
+      linear = 1;
+    if (linear > BENCH_VECTOR_MAX_ITERS)
+      linear = BENCH_VECTOR_MAX_ITERS;
+    uint32 sortIters = linear / 16 ? linear / 16 : 1;
+
+    for (uint32 backend = 0; backend < BENCH_VECTOR_BACKENDS; backend++) {
+      const char *dist = backendNames[backend];
+      uint32 state = 12345u;
+      volatile uint32 sink = 0;
+
+      // 追加：每次重建，计入节点或数组的分配开销
+      uint32 rounds = linear / 8 ? linear / 8 : 1;
+      d64 start = bench_now();
+      for (uint32 r = 0; r < rounds; r++) {
+        SL_link *link = bench_vectorCreate(backend);
+        bench_vectorFill(link, n, &state);
+        sink += link->length;
+        SL_freeLinks(link);
+      }
+      bench_reportRow(&report, "SL_add", dist, n, rounds,
+                      bench_now() - start);
+
+      SL_link *link = bench_vectorCreate(backend);
+      bench_vectorFill(link, n, &state);
+
+      start = bench_now();
+      for (uint32 i = 0; i < linear; i++)
+        sink += SL_count(link, (Elemtype)i);
+      bench_reportRow(&report, "SL_count", dist, n, linear,
+                      bench_now() - start);
+
+      // 插入、删除成对进行，保持链表规模不变
+      start = bench_now();
+      for (uint32 i = 0; i < linear; i++)
+        SL_insert(link, (Elemtype)i, bench_vectorRand(&state, n));
+      bench_reportRow(&report, "SL_insert", dist, n, linear,
+                      bench_now() - start);
+
+      start = bench_now();
+      for (uint32 i = 0; i < linear; i++)
+        sink += SL_deleteIndex(link, bench_vectorRand(&state, n));
+      bench_reportRow(&report, "SL_deleteIndex", dist, n, linear,
+                      bench_now() - start);
+
+      start = bench_now();
+      for (uint32 i = 0; i < BENCH_VECTOR_MAX_ITERS; i++) {
+        sink += SL_delHead(link);
+        SL_insertHead(link, (Elemtype)i);
+      }
+      bench_reportRow(&report, "SL_delHead+insertHead", dist, n,
+                      BENCH_VECTOR_MAX_ITERS, bench_now() - start);
+
+      // 节点链表的 SL_delEnd 需要O(n)找到前驱
+      start = bench_now();
+      for (uint32 i = 0; i < linear; i++) {
+        sink += SL_delEnd(link);
+        SL_add(link, (Elemtype)i);
+      }
+      bench_reportRow(&report, "SL_delEnd+add", dist, n, linear,
+                      bench_now() - start);
+
+      start = bench_now();
+      for (uint32 i = 0; i < sortIters; i++)
+        SL_sort_Merge(link, i & 1 ? ASC : DESC);
+      bench_reportRow(&report, "SL_sort_Merge", dist, n, sortIters,
+                      bench_now() - start);
+
+      SL_freeLinks(link);
+      (void)sink;
+    }
+
+    if (n > maxSize / 4) // 防止 n *= 4 溢出
+      break;
+  }
+
+  bench_reportClose(&report);
+  return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * @file bench_writer.c
+ * @brief 缓冲输出器与逐元素 printf 输出的对比
+ * @author ringtree
+ * @date 2025-10-01
+ * @version 1.0
+ *
+ * 以 10 倍递增的规模（10^3 至默认 10^6）对比按 SL_traverseLink 格式输出链表：
+ * - fprintf         ：原 SL_traverseLink 的逐元素 fprintf("%d\t") 写法；
+ * - SW_memory       ：SW_writeLink 写入调用者缓冲区（纯格式化开销）；
+ * - SW_file         ：SW_writeLink 经 FILE* 写入 /dev/null；
+ * - SW_fd           ：SW_writeLink 经文件描述符写入 /dev/null；
+ * - SW_vector       ：顺序存储链表经文件描述符写入 /dev/null。
+ * 数据为 [0, 10^6) 的随机数，平均每个元素约 7 字节，
+ * 每元素 7ns 左右即达到 1 GB/s 的目标吞吐量。结果以每元素耗时报告。
+ *
+ * 用法：bench writer [最大规模] [--format=table|csv|json] [--out=文件]
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "data_struct.h"
+#include "sl_writer.h"
+
+/**
+ * @brief 每项测试输出的总元素预算
+ */
+#define BENCH_WRITER_BUDGET 10000000u
+
+/**
+ * @brief 原 SL_traverseLink 的逐元素输出
+ */
+static void bench_writerPrintf(FILE *const file, SL_link *const link) {
+  uint16 number = 0;
+  for (SL_node *cur = link->headIndex; cur; cur = cur->next, number++) {
+    if (number == 20) {
+      number = 0;
+      fprintf(file, "\n");
+    }
+    fprintf(file, "%d\t", cur->data);
+  }
+  fprintf(file, "\n");
+}
+
+int bench_writer(int argc, char *argv[]) {
+  uint32 maxSize = bench_maxSize(argc, argv, 1000000);
+  bench_report report;
+
+  if (!bench_reportOpen(&report, argc, argv, "writer"))
+    return 1;
+
+  FILE *null = fopen("/dev/null", "w");
+  int fd = open("/dev/null", O_WRONLY);
+  // 内存缓冲区按最长格式一次容纳整条链表
+  char *buffer = (char *)malloc((size_t)maxSize * (SW_MAX_DIGITS + 2) + 1);
+  if (!(null && fd >= 0 && buffer)) {
+    printf("错误：无法打开 /dev/null 或分配缓冲区\n");
+    if (null)
+      fclose(null);
+    if (fd >= 0)
+      close(fd);
+    free(buffer);
+    bench_reportClose(&report);
+    return 1;
+  }
+
+  for (uint32 n = 1000; n <= maxSize; n *= 10) {
+    uint32 reps = BENCH_WRITER_BUDGET / n;
+    if (reps < 1)
+      reps = 1;
+    uint32 total = reps * n;
+    uint32 state = 12345u;
+    volatile uint64 sink = 0;
+
+    SL_link *link = SL_inifLink();
+    SL_link *vector = SL_inifLinkVector(n);
+    for (uint32 i = 0; i < n; i++) {
+      state = state * 1664525u + 1013904223u;
+      Elemtype data = (Elemtype)(((uint64)state * 1000000u) >> 32);
+      SL_add(link, data);
+      SL_add(vector, data);
+    }
+
+    d64 start = bench_now();
+    for (uint32 r = 0; r < reps; r++)
+      bench_writerPrintf(null, link);
+    fflush(null);
+    bench_reportRow(&report, "fprintf", "random", n, total,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 r = 0; r < reps; r++) {
+      SW_writer *writer =
+          SW_inifWriter(buffer, maxSize * (SW_MAX_DIGITS + 2) + 1);
+      sink += SW_writeLink(writer, link, NULL);
+      sink += writer->used;
+      SW_freeWriter(writer);
+    }
+    bench_reportRow(&report, "SW_memory", "random", n, total,
+                    bench_now() - start);
+
+    SW_writer *writer = SW_inifWriterFile(null, 0);
+    start = bench_now();
+    for (uint32 r = 0; r < reps; r++)
+      sink += SW_writeLink(writer, link, NULL);
+    SW_flush(writer);
+    fflush(null);
+    bench_reportRow(&report, "SW_file", "random", n, total,
+                    bench_now() - start);
+    SW_freeWriter(writer);
+
+    writer = SW_inifWriterFd(fd, 0);
+    start = bench_now();
+    for (uint32 r = 0; r < reps; r++)
+      sink += SW_writeLink(writer, link, NULL);
+    SW_flush(writer);
+    bench_reportRow(&report, "SW_fd", "random", n, total,
+                    bench_now() - start);
+
+    start = bench_now();
+    for (uint32 r = 0; r < reps; r++)
+      sink += SW_writeLink(writer, vector, NULL);
+    SW_flush(writer);
+    bench_reportRow(&report, "SW_vector", "random", n, total,
+                    bench_now() - start);
+    SW_freeWriter(writer);
+
+    SL_freeLinks(link);
+    SL_freeLinks(vector);
+    (void)sink;
+
+    if (n > maxSize / 10) // 防止 n *= 10 溢出
+      break;
+  }
+
+  fclose(null);
+  close(fd);
+  free(buffer);
+  bench_reportClose(&report);
+  return 0;
+}
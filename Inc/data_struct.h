@@ -51,6 +51,12 @@ typedef int32 Elemtype;
 
 typedef struct SL_node SL_node;
 
+typedef struct SL_pool SL_pool; ///< 节点池，定义见 sl_pool.h
+
+typedef struct SL_index SL_index; ///< 值哈希索引，定义见 sl_index.h
+
+typedef struct SL_vector SL_vector; ///< 顺序存储后端，定义见 sl_vector.h
+
 /**
  * @brief 链表节点结构体
  *
@@ -70,14 +76,64 @@ typedef struct SL_linkedList {
   SL_node *headIndex; ///< 指向链表头节点的指针
   SL_node *endIndex;  ///< 指向链表尾节点的指针
   uint32 length;      ///< 链表长度（节点数量）
+  SL_pool *pool;      ///< 节点池，为NULL时节点直接使用malloc()/free()
+  uint16 ownPool;     ///< 节点池是否为链表私有（私有池随链表一起释放）
+  SL_index *index;    ///< 值哈希索引，为NULL时不维护索引
+  uint32 version;     ///< 修改版本号，每次插入、删除、排序、反转后递增
+  SL_vector *vector;  ///< 顺序存储后端，非NULL时数据存放在连续数组中且不使用节点
 } SL_link;
 
+/**
+ * @brief 节点访问回调函数类型
+ *
+ * @param node 当前节点
+ * @param index 节点索引（从0开始计数）
+ * @param context 用户上下文
+ * @return uint16 返回0继续遍历，返回非0停止遍历
+ */
+typedef uint16 (*SL_visitFn)(SL_node *const node, const uint32 index,
+                             void *const context);
+
+/**
+ * @brief 数据条件函数类型（SL_removeIf / SL_retainIf）
+ *
+ * @param data 节点数据
+ * @param context 用户上下文
+ * @return uint16 满足条件返回非0
+ */
+typedef uint16 (*SL_predicateFn)(const Elemtype data, void *const context);
+
+/**
+ * @brief 状态码接口（SL_try*）的返回值
+ *
+ * SL_try* 函数在任何路径上都不产生输出（包括节点池、顺序存储、哈希索引的
+ * 扩容失败），失败原因经返回值、结果经输出参数返回，
+ * 不再使用与数据 -1 冲突的 UINT32_MAX 作为失败值。
+ * 同名的原接口调用对应的 SL_try* 函数，失败时经 SL_log()（sl_log.h）报告。
+ */
+enum SL_status {
+  SL_OK = 0x00,       ///< 成功
+  SL_ERR_NULL,        ///< 链表或参数指针为NULL
+  SL_ERR_EMPTY,       ///< 链表为空
+  SL_ERR_RANGE,       ///< 索引越界
+  SL_ERR_NOT_FOUND,   ///< 未找到目标数据或节点
+  SL_ERR_NO_MEMORY,   ///< 内存分配失败
+  SL_ERR_UNSUPPORTED, ///< 顺序存储链表不支持节点指针接口
+  SL_ERR_CORRUPT      ///< 链表结构损坏
+};
+
 /**
  * @brief 链表相关操作函数声明
  */
 
 SL_link *SL_inifLink(void);
 
+SL_link *SL_inifLinkPool(SL_pool *const pool);
+
+SL_link *SL_inifLinkVector(const uint32 capacity);
+
+const char *SL_statusString(const enum SL_status status);
+
 /** @} */ // 链表初始化操作
 
 /**
@@ -88,13 +144,29 @@ SL_link *SL_inifLink(void);
 
 void SL_insertHead(SL_link *const linkedList, const Elemtype inputData);
 
+enum SL_status SL_tryInsertHead(SL_link *const linkedList,
+                                const Elemtype inputData);
+
 void SL_add(SL_link *const linkedList, const Elemtype inputData);
 
+enum SL_status SL_tryAdd(SL_link *const linkedList, const Elemtype inputData);
+
 void SL_extind(SL_link *const linkedList, const uint32 count, ...);
 
 void SL_insert(SL_link *const linkedList, const Elemtype inputData,
                const uint32 index);
 
+enum SL_status SL_tryInsert(SL_link *const linkedList, const Elemtype inputData,
+                            const uint32 index);
+
+SL_node *SL_insertAfter(SL_link *const linkedList, SL_node *const prev,
+                        const Elemtype inputData);
+
+SL_link *SL_fromArray(const Elemtype *const array, const uint32 count);
+
+uint32 SL_appendArray(SL_link *const linkedList, const Elemtype *const array,
+                      const uint32 count);
+
 /** @} */ // 链表插入操作
 
 /**
@@ -108,12 +180,28 @@ uint32 SL_count(SL_link *const linkedList, const Elemtype findData);
 SL_node **SL_find(SL_link *const linkedList, const Elemtype findData,
                   uint32 *outCount);
 
+uint32 SL_findInto(SL_link *const linkedList, const Elemtype findData,
+                   SL_node **const outNodes, const uint32 capacity);
+
+uint32 SL_forEachMatch(SL_link *const linkedList, const Elemtype findData,
+                       SL_visitFn visit, void *const context);
+
 uint32 SL_getIndex(SL_link *const linkedList, const Elemtype findData);
 
+enum SL_status SL_tryGetIndex(SL_link *const linkedList,
+                              const Elemtype findData, uint32 *const outIndex);
+
 void *SL_get_set(SL_link *const linked);
 
 uint32 SL_josephusSurvivor(SL_link *const link, uint32 n);
 
+uint32 SL_josephusIndex(const uint32 count, const uint32 n);
+
+uint32 SL_josephusPeek(SL_link *const link, const uint32 n);
+
+uint32 SL_josephusOrder(const uint32 count, const uint32 n,
+                        uint32 *const outOrder);
+
 /** @} */ // 链表查找操作
 
 /**
@@ -124,6 +212,10 @@ uint32 SL_josephusSurvivor(SL_link *const link, uint32 n);
 
 void SL_sort_Insertion(SL_link *const linkedList, enum sort way);
 
+void SL_sort_Merge(SL_link *const linkedList, enum sort way);
+
+void SL_sort_Radix(SL_link *const linkedList, enum sort way);
+
 uint16 SL_reverse(SL_link *const linked);
 
 /** @} */ // 单向链表修改操作
@@ -136,15 +228,50 @@ uint16 SL_reverse(SL_link *const linked);
 
 Elemtype SL_delHead(SL_link *const linkedList);
 
+enum SL_status SL_tryDelHead(SL_link *const linkedList,
+                             Elemtype *const outData);
+
 Elemtype SL_delEnd(SL_link *const linkedList);
 
+enum SL_status SL_tryDelEnd(SL_link *const linkedList,
+                            Elemtype *const outData);
+
 Elemtype SL_deleteNode(SL_link *const linkedList, SL_node *const node);
 
+enum SL_status SL_tryDeleteNode(SL_link *const linkedList, SL_node *const node,
+                                Elemtype *const outData);
+
+Elemtype SL_deleteAfter(SL_link *const linkedList, SL_node *const prev);
+
+enum SL_status SL_tryDeleteAfter(SL_link *const linkedList,
+                                 SL_node *const prev,
+                                 Elemtype *const outData);
+
 Elemtype SL_deleteIndex(SL_link *const linkedList, uint32 index);
 
+enum SL_status SL_tryDeleteIndex(SL_link *const linkedList, const uint32 index,
+                                 Elemtype *const outData);
+
 Elemtype SL_deleteData(SL_link *const linkedList, const Elemtype targetData,
                        uint32 deleteCount);
 
+enum SL_status SL_tryDeleteData(SL_link *const linkedList,
+                                const Elemtype targetData,
+                                const uint32 deleteCount,
+                                uint32 *const outDeleted);
+
+uint32 SL_deleteIndices(SL_link *const linkedList, const uint32 *const indices,
+                        const uint32 count);
+
+uint32 SL_deleteValues(SL_link *const linkedList, const Elemtype *const values,
+                       const uint32 count);
+
+uint32 SL_removeIf(SL_link *const linkedList, SL_predicateFn predicate,
+                   void *const context);
+
+uint32 SL_retainIf(SL_link *const linkedList, SL_predicateFn predicate,
+                   void *const context);
+
 /** @} */ // 链表删除操作
 
 /**
@@ -155,6 +282,9 @@ Elemtype SL_deleteData(SL_link *const linkedList, const Elemtype targetData,
 
 uint32 SL_traverseLink(SL_link *const linkedList);
 
+uint32 SL_toArray(SL_link *const linkedList, Elemtype *const outArray,
+                  const uint32 capacity);
+
 /** @} */ // 链表遍历操作
 
 /**
@@ -0,0 +1,175 @@
+/*
+ * @file dl_link.h
+ * @brief 双向链表模块接口定义头文件
+ * @author ringtree
+ * @date 2025-09-28
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 双向链表的节点同时保存前驱与后继指针，因此：
+ * - 删除尾节点（DL_delEnd）与按节点指针删除（DL_deleteNode）均为O(1)；
+ * - 按下标访问、插入、删除时从较近的一端开始遍历，最多走 length / 2 步；
+ * - 可以把 DL_node* 当作句柄长期持有，配合 DL_insertAfter / DL_insertBefore /
+ *   DL_deleteNode 实现双端队列与按句柄删除。
+ *
+ * 接口命名与语义与 data_struct.h 中的 SL_* 函数一一对应，
+ * 数据类型 Elemtype 与排序方式 enum sort 也沿用 data_struct.h 的定义。
+ */
+#pragma once
+#ifndef __DL_LINK_H__
+#define __DL_LINK_H__
+
+/* include ---------------------------------------------------- */
+#include "data_struct.h"
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @defgroup 双向链表模块
+ * @brief 双向链表数据结构及其操作
+ * @{
+ */
+
+/**
+ * @brief 双向链表节点结构体
+ */
+typedef struct DL_node {
+  Elemtype data;        ///< 节点数据
+  struct DL_node *prev; ///< 指向前一个节点的指针
+  struct DL_node *next; ///< 指向下一个节点的指针
+} DL_node;
+
+/**
+ * @brief 双向链表结构体
+ */
+typedef struct DL_linkedList {
+  DL_node *headIndex; ///< 指向链表头节点的指针
+  DL_node *endIndex;  ///< 指向链表尾节点的指针
+  uint32 length;      ///< 链表长度（节点数量）
+} DL_link;
+
+DL_link *DL_inifLink(void);
+
+/**
+ * @defgroup 双向链表插入操作
+ * @brief 双向链表节点插入相关函数
+ * @{
+ */
+
+void DL_insertHead(DL_link *const linkedList, const Elemtype inputData);
+
+void DL_add(DL_link *const linkedList, const Elemtype inputData);
+
+void DL_extind(DL_link *const linkedList, const uint32 count, ...);
+
+void DL_insert(DL_link *const linkedList, const Elemtype inputData,
+               const uint32 index);
+
+DL_node *DL_insertAfter(DL_link *const linkedList, DL_node *const prev,
+                        const Elemtype inputData);
+
+DL_node *DL_insertBefore(DL_link *const linkedList, DL_node *const next,
+                         const Elemtype inputData);
+
+DL_link *DL_fromArray(const Elemtype *const array, const uint32 count);
+
+uint32 DL_appendArray(DL_link *const linkedList, const Elemtype *const array,
+                      const uint32 count);
+
+/** @} */ // 双向链表插入操作
+
+/**
+ * @defgroup 双向链表查找操作
+ * @brief 双向链表节点查找相关函数
+ * @{
+ */
+
+uint32 DL_count(DL_link *const linkedList, const Elemtype findData);
+
+DL_node **DL_find(DL_link *const linkedList, const Elemtype findData,
+                  uint32 *outCount);
+
+uint32 DL_getIndex(DL_link *const linkedList, const Elemtype findData);
+
+DL_node *DL_getNode(DL_link *const linkedList, const uint32 index);
+
+uint32 DL_josephusSurvivor(DL_link *const link, uint32 n);
+
+/** @} */ // 双向链表查找操作
+
+/**
+ * @defgroup 双向链表修改操作
+ * @brief 双向链表修改相关函数
+ * @{
+ */
+
+void DL_sort_Insertion(DL_link *const linkedList, enum sort way);
+
+void DL_sort_Merge(DL_link *const linkedList, enum sort way);
+
+void DL_sort_Radix(DL_link *const linkedList, enum sort way);
+
+uint16 DL_reverse(DL_link *const linked);
+
+/** @} */ // 双向链表修改操作
+
+/**
+ * @defgroup 双向链表删除操作
+ * @brief 双向链表节点删除相关函数
+ * @{
+ */
+
+Elemtype DL_delHead(DL_link *const linkedList);
+
+Elemtype DL_delEnd(DL_link *const linkedList);
+
+Elemtype DL_deleteNode(DL_link *const linkedList, DL_node *const node);
+
+Elemtype DL_deleteIndex(DL_link *const linkedList, const uint32 index);
+
+Elemtype DL_deleteData(DL_link *const linkedList, const Elemtype targetData,
+                       const uint32 deleteCount);
+
+/** @} */ // 双向链表删除操作
+
+/**
+ * @defgroup 双向链表遍历操作
+ * @brief 双向链表遍历相关函数
+ * @{
+ */
+
+uint32 DL_traverseLink(DL_link *const linkedList);
+
+uint32 DL_traverseReverse(DL_link *const linkedList);
+
+uint32 DL_toArray(DL_link *const linkedList, Elemtype *const outArray,
+                  const uint32 capacity);
+
+/** @} */ // 双向链表遍历操作
+
+/**
+ * @defgroup 双向链表释放操作
+ * @brief 释放双向链表所占内存
+ * @{
+ */
+
+void DL_freeNodes(DL_link *const linkedList);
+
+void DL_freeLinks(DL_link *linkedList);
+
+/** @} */ // 双向链表释放操作
+
+/**
+ * @defgroup 双向链表其它操作
+ * @brief 双向链表其它操作相关函数
+ * @{
+ */
+
+DL_node *DL_sameSuffix(DL_link *const link1, DL_link *const link2,
+                       uint32 *const count);
+
+/** @} */ // 双向链表其它操作
+
+/** @} */ // 双向链表模块
+
+#endif /* !__DL_LINK_H__ */
@@ -1,6 +1,8 @@
 #ifndef __OTHER_H__
 #define __OTHER_H__
 
+#include <stddef.h>
+
 #include "data_struct.h"
 
 #define RAND_INT(min, max) (rand() % (max - min + 1) + min) 
@@ -12,4 +14,8 @@ void SL_randLink(
   const int32 max
 );
 
+void *SL_alignedAlloc(const size_t size, const size_t alignment);
+
+void SL_alignedFree(void *ptr);
+
 #endif // !__OTHER_H__
\ No newline at end of file
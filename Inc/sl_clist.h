@@ -0,0 +1,85 @@
+/*
+ * @file sl_clist.h
+ * @brief 并发有序链表（有序集合）接口定义头文件
+ * @author ringtree
+ * @date 2025-09-25
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 提供三种同步策略，创建时选定：
+ * - CL_COUPLING ：手递手加锁（lock coupling），遍历时始终持有前驱与当前节点的锁；
+ * - CL_LAZY     ：惰性链表，遍历不加锁，修改时只锁前驱与当前节点并校验，
+ *                 删除先置逻辑删除标记再摘链；
+ * - CL_LOCKFREE ：Harris-Michael 无锁链表，以 next 指针最低位作为删除标记。
+ * CL_LAZY 与 CL_LOCKFREE 摘除的节点通过风险指针（sl_hazard.h）延迟回收。
+ *
+ * 使用说明：
+ * - 链表按升序保存互不相同的值，CL_insert() / CL_deleteData() / CL_contains()
+ *   分别对应 SL_insert() / SL_deleteData() / SL_getIndex()；
+ * - 每个访问链表的线程先调用 CL_attach() 取得线程记录，
+ *   之后的操作都传入该记录，线程退出前调用 CL_detach()。
+ */
+#pragma once
+#ifndef __SL_CLIST_H__
+#define __SL_CLIST_H__
+
+/* include ---------------------------------------------------- */
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "data_struct.h"
+#include "sl_hazard.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 并发有序链表的同步策略
+ */
+enum CL_mode { CL_COUPLING = 0x00, CL_LAZY = 0x01, CL_LOCKFREE = 0x02 };
+
+/**
+ * @defgroup 并发有序链表
+ * @brief 支持多线程并发读写的有序集合
+ * @{
+ */
+
+/**
+ * @brief 并发有序链表节点
+ */
+typedef struct CL_node {
+  Elemtype data;                ///< 节点数据
+  _Atomic(struct CL_node *) next; ///< 后继节点（CL_LOCKFREE 下最低位为删除标记）
+  atomic_int marked;            ///< 逻辑删除标记（CL_LAZY）
+  pthread_mutex_t lock;         ///< 节点锁（CL_COUPLING、CL_LAZY）
+} CL_node;
+
+/**
+ * @brief 并发有序链表
+ */
+typedef struct CL_list {
+  enum CL_mode mode; ///< 同步策略
+  CL_node *head;     ///< 头哨兵节点（不存储数据，永不删除）
+  SL_hpDomain *hp;   ///< 风险指针域
+} CL_list;
+
+CL_list *CL_inifList(const enum CL_mode mode);
+
+SL_hpRecord *CL_attach(CL_list *const list);
+
+void CL_detach(CL_list *const list, SL_hpRecord *const record);
+
+uint16 CL_insert(CL_list *const list, SL_hpRecord *const record,
+                 const Elemtype data);
+
+uint16 CL_deleteData(CL_list *const list, SL_hpRecord *const record,
+                     const Elemtype data);
+
+uint16 CL_contains(CL_list *const list, SL_hpRecord *const record,
+                   const Elemtype data);
+
+uint32 CL_length(CL_list *const list);
+
+void CL_freeList(CL_list *list);
+
+/** @} */ // 并发有序链表
+
+#endif /* !__SL_CLIST_H__ */
@@ -0,0 +1,69 @@
+/*
+ * @file sl_distinct.h
+ * @brief 单向链表去重（distinct）接口定义头文件
+ * @author ringtree
+ * @date 2025-09-29
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 按第一次出现的顺序取出链表中的不同值（原值或绝对值），
+ * 根据数据规模与取值范围自动选择实现：
+ * - 位图：取值范围不超过 SL_DISTINCT_BITSET_RATIO * n 时，每个值1位；
+ * - 开放寻址哈希集合：取值稀疏且 n 小于 SL_DISTINCT_SORT_MIN 时；
+ * - 基数排序：取值稀疏且 n 较大时，顺序访问内存，避免哈希表的随机访问。
+ * 三种实现的额外内存都是O(n)，与取值范围无关。
+ *
+ * 绝对值模式下 INT32_MIN 的绝对值 2^31 无法用 Elemtype 表示，结果中记为 INT32_MIN。
+ */
+#pragma once
+#ifndef __SL_DISTINCT_H__
+#define __SL_DISTINCT_H__
+
+/* include ---------------------------------------------------- */
+#include "data_struct.h"
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 使用位图的最大取值范围与元素个数之比（位图最多 8n 字节）
+ */
+#ifndef SL_DISTINCT_BITSET_RATIO
+#define SL_DISTINCT_BITSET_RATIO 64u
+#endif
+
+/**
+ * @brief 稀疏取值改用基数排序的最小元素个数
+ */
+#ifndef SL_DISTINCT_SORT_MIN
+#define SL_DISTINCT_SORT_MIN (1u << 20)
+#endif
+
+/**
+ * @defgroup 单向链表去重
+ * @brief 位图 / 哈希集合 / 排序自适应的不同值提取
+ * @{
+ */
+
+/**
+ * @brief 去重的取值方式
+ */
+enum distinct { DISTINCT_RAW = 0x00, DISTINCT_ABS = 0x01 };
+
+/**
+ * @brief 去重实现（DISTINCT_AUTO 按数据自动选择）
+ */
+enum distinctMethod {
+  DISTINCT_AUTO = 0x00,
+  DISTINCT_BITSET = 0x01,
+  DISTINCT_HASH = 0x02,
+  DISTINCT_SORT = 0x03
+};
+
+Elemtype *SL_distinctArray(SL_link *const linkedList, enum distinct mode,
+                           enum distinctMethod method, uint32 *const outCount);
+
+SL_link *SL_distinct(SL_link *const linkedList, enum distinct mode);
+
+/** @} */ // 单向链表去重
+
+#endif /* !__SL_DISTINCT_H__ */
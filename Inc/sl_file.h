@@ -0,0 +1,78 @@
+/*
+ * @file sl_file.h
+ * @brief 单向链表二进制保存与内存映射加载接口定义头文件
+ * @author ringtree
+ * @date 2025-10-02
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 文件由定长文件头（SL_fileHeader）和数据区组成：
+ * - SL_FILE_RAW：数据区为 length 个紧密排列的 Elemtype；
+ * - SL_FILE_DELTA：每个元素与前一个元素（第一个元素与0）之差做 zigzag 编码后
+ *   按 LEB128 变长整数存储，有序或取值集中的数据通常每个元素只需 1~2 字节。
+ * 所有字段按小端字节序存储，只能在小端机器之间交换。
+ *
+ * SL_load() 使用 mmap() 映射整个文件（Windows 下退回 fread() 整体读入），
+ * 一次顺序扫描即生成节点链表（节点在私有节点池中连续分配）或顺序存储链表，
+ * 不再逐个插入元素。
+ */
+#pragma once
+#ifndef __SL_FILE_H__
+#define __SL_FILE_H__
+
+/* include ---------------------------------------------------- */
+#include "data_struct.h"
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 文件标识 "SLNK"
+ */
+#define SL_FILE_MAGIC 0x4B4E4C53u
+
+/**
+ * @brief 文件格式版本
+ */
+#define SL_FILE_VERSION 1
+
+/**
+ * @brief 保存与解码时的分块元素个数
+ */
+#define SL_FILE_CHUNK 16384
+
+/**
+ * @defgroup 二进制存取
+ * @brief SL_link 的二进制文件格式与快速加载
+ * @{
+ */
+
+/**
+ * @brief 数据区编码方式
+ */
+enum SL_fileFormat { SL_FILE_RAW = 0x00, SL_FILE_DELTA = 0x01 };
+
+/**
+ * @brief 加载后链表的存储方式
+ */
+enum SL_loadMode { SL_LOAD_NODES = 0x00, SL_LOAD_VECTOR = 0x01 };
+
+/**
+ * @brief 文件头（24字节）
+ */
+typedef struct SL_fileHeader {
+  uint32 magic;        ///< SL_FILE_MAGIC
+  uint16 version;      ///< SL_FILE_VERSION
+  uint16 format;       ///< enum SL_fileFormat
+  uint32 length;       ///< 元素个数
+  uint32 reserved;     ///< 保留，写0
+  uint64 payloadBytes; ///< 数据区字节数
+} SL_fileHeader;
+
+uint16 SL_save(SL_link *const linkedList, const char *const path,
+               enum SL_fileFormat format);
+
+SL_link *SL_load(const char *const path, enum SL_loadMode mode);
+
+/** @} */ // 二进制存取
+
+#endif /* !__SL_FILE_H__ */
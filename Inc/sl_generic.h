@@ -0,0 +1,884 @@
+/*
+ * @file sl_generic.h
+ * @brief 任意元素类型的单向链表生成宏
+ * @author ringtree
+ * @date 2025-10-03
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * data_struct.h 中的 Elemtype 固定为 int32。需要存放 64 位编号、浮点数或小结构体时，
+ * 用 DEFINE_SL_LIST(name, type, cmp, hash) 生成该类型专用的链表：
+ * - 节点为 name_node { type data; name_node *next; }，数据直接存放在节点内；
+ * - 链表为 name_link { headIndex, endIndex, length }，字段含义与 SL_link 相同；
+ * - 操作为 name_add、name_sort_Merge 等 static inline 函数，命名与 SL_* 对应；
+ * - cmp(a, b) 与 hash(a) 可以是函数或函数式宏，在排序、查找、去重的循环中
+ *   直接展开，没有 void* 转换与回调开销。
+ *
+ * cmp(a, b) 返回负数、0、正数分别表示 a 小于、等于、大于 b；
+ * hash(a) 返回 uint64，相等的元素哈希值必须相同（只有 name_distinct 使用）。
+ * 整数与浮点数可直接使用 SL_GENERIC_CMP，整数可使用 SL_GENERIC_HASH。
+ *
+ * 示例：
+ * @code
+ * DEFINE_SL_LIST(U64L, uint64, SL_GENERIC_CMP, SL_GENERIC_HASH)
+ *
+ * U64L_link *ids = U64L_inifLink();
+ * U64L_add(ids, 42);
+ * U64L_sort_Merge(ids, ASC);
+ * U64L_freeLinks(ids);
+ * @endcode
+ *
+ * 与 SL_link 不同，生成的链表不支持节点池、顺序存储与哈希索引，节点逐个 malloc()。
+ * 删除类函数通过输出参数返回被删除的数据，返回值只表示成功与否。
+ * 错误信息与 data_struct.c 一样经 SL_log() 以 SL_LOG_ERROR 级别输出。
+ *
+ * 同名函数的语义与 SL_* 一致：name_insert 的 index 非0时必须小于链表长度，
+ * name_find 返回全部匹配节点的数组（只要第一个时用 name_findFirst），
+ * name_deleteData 通过 outDeleted 返回删除的节点数（泛型类型没有 UINT32_MAX 这样的
+ * 失败标记值，无法像 SL_deleteData 那样返回被删除的数据），与 SL_tryDeleteData 相同。
+ * 整数与浮点数链表可再用 DEFINE_SL_LIST_RADIX(name, key) 生成 name_sort_Radix。
+ *
+ * 以下 SL_* 接口没有对应的生成函数：
+ * - SL_extind：可变参数会把 float、char、short 提升为其它类型，无法按 type 读取，
+ *   请使用 name_appendArray；
+ * - SL_traverseLink：打印格式与类型相关，请使用 name_forEach 自行输出；
+ * - SL_get_set：只适用于整数的绝对值去重，请使用 name_distinct；
+ * - SL_deleteIndices / SL_deleteValues：请使用 name_removeIf（对应 SL_removeIf）；
+ * - SL_try* 状态码接口：生成的函数本身已通过返回值报告成功与否；
+ * - 节点池、顺序存储与哈希索引相关接口。
+ */
+#pragma once
+#ifndef __SL_GENERIC_H__
+#define __SL_GENERIC_H__
+
+/* include ---------------------------------------------------- */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "data_struct.h"
+#include "main.h"
+#include "sl_log.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 标量类型的三路比较
+ */
+#define SL_GENERIC_CMP(a, b) (((a) > (b)) - ((a) < (b)))
+
+/**
+ * @brief 整数类型的哈希（直接取值，name_distinct 内部再做 Fibonacci 散列）
+ */
+#define SL_GENERIC_HASH(a) ((uint64)(a))
+
+/**
+ * @brief 无符号整数的基数排序键
+ */
+#define SL_GENERIC_KEY_UNSIGNED(a) ((uint64)(a))
+
+/**
+ * @brief 有符号整数的基数排序键（翻转符号位，负数排在非负数之前）
+ */
+#define SL_GENERIC_KEY_SIGNED(a) ((uint64)(int64)(a) ^ 0x8000000000000000ull)
+
+/**
+ * @brief 浮点数的基数排序键
+ *
+ * 负数按位取反，非负数翻转符号位，键的无符号序与数值序一致。
+ *
+ * @param a 浮点数（float 会先提升为 double）
+ * @return uint64 排序键
+ * @note -0.0 排在 0.0 之前；NaN 按符号位排在两端。
+ */
+static inline uint64 SL_genericKeyDouble(const d64 a) {
+  uint64 bits;
+  memcpy(&bits, &a, sizeof(bits));
+  return (bits & 0x8000000000000000ull) ? ~bits
+                                        : bits ^ 0x8000000000000000ull;
+}
+
+/**
+ * @defgroup 泛型单向链表
+ * @brief 按元素类型生成的单向链表
+ * @{
+ */
+
+/**
+ * @brief 生成元素类型为 type 的单向链表及其全部操作
+ *
+ * @param name 类型与函数名前缀
+ * @param type 元素类型（按值存放在节点中）
+ * @param cmp 三路比较，cmp(a, b) 的参数类型为 type
+ * @param hash 哈希函数，hash(a) 返回 uint64
+ */
+#define DEFINE_SL_LIST(name, type, cmp, hash)                                  \
+  typedef struct name##_node name##_node;                                      \
+                                                                               \
+  /** @brief 节点 */                                                           \
+  struct name##_node {                                                         \
+    type data;         /**< 节点数据 */                                        \
+    name##_node *next; /**< 后继节点 */                                        \
+  };                                                                           \
+                                                                               \
+  /** @brief 链表 */                                                           \
+  typedef struct name##_link {                                                 \
+    name##_node *headIndex; /**< 头节点 */                                     \
+    name##_node *endIndex;  /**< 尾节点 */                                     \
+    uint32 length;          /**< 节点个数 */                                   \
+  } name##_link;                                                               \
+                                                                               \
+  /** @brief 遍历回调，参数为节点、下标与用户上下文，返回非0时停止遍历 */      \
+  typedef uint16 (*name##_visitFn)(name##_node *const node,                    \
+                                   const uint32 index, void *const context);   \
+                                                                               \
+  /** @brief 条件回调，返回非0表示满足条件 */                                  \
+  typedef uint16 (*name##_predicateFn)(const type data, void *const context);  \
+                                                                               \
+  /** @brief 创建空链表，内存分配失败返回NULL */                               \
+  static inline name##_link *name##_inifLink(void) {                           \
+    name##_link *link = (name##_link *)malloc(sizeof(name##_link));            \
+    if (!link) {                                                               \
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");                       \
+      return NULL;                                                             \
+    }                                                                          \
+    link->headIndex = NULL;                                                    \
+    link->endIndex = NULL;                                                     \
+    link->length = 0;                                                          \
+    return link;                                                               \
+  }                                                                            \
+                                                                               \
+  /** @brief 创建节点，内存分配失败返回NULL */                                 \
+  static inline name##_node *name##_inifNode(const type data) {                \
+    name##_node *node = (name##_node *)malloc(sizeof(name##_node));            \
+    if (!node) {                                                               \
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");                       \
+      return NULL;                                                             \
+    }                                                                          \
+    node->data = data;                                                         \
+    node->next = NULL;                                                         \
+    return node;                                                               \
+  }                                                                            \
+                                                                               \
+  /** @brief 头部插入，成功返回1 */                                            \
+  static inline uint16 name##_insertHead(name##_link *const link,              \
+                                         const type data) {                    \
+    name##_node *node = name##_inifNode(data);                                 \
+    if (!node)                                                                 \
+      return 0;                                                                \
+    node->next = link->headIndex;                                              \
+    link->headIndex = node;                                                    \
+    if (!link->endIndex)                                                       \
+      link->endIndex = node;                                                   \
+    link->length++;                                                            \
+    return 1;                                                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 尾部追加，成功返回1 */                                            \
+  static inline uint16 name##_add(name##_link *const link, const type data) {  \
+    name##_node *node = name##_inifNode(data);                                 \
+    if (!node)                                                                 \
+      return 0;                                                                \
+    if (link->endIndex)                                                        \
+      link->endIndex->next = node;                                             \
+    else                                                                       \
+      link->headIndex = node;                                                  \
+    link->endIndex = node;                                                     \
+    link->length++;                                                            \
+    return 1;                                                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 取下标为 index 的节点，越界返回NULL */                            \
+  static inline name##_node *name##_getNode(name##_link *const link,           \
+                                            const uint32 index) {              \
+    if (index >= link->length)                                                 \
+      return NULL;                                                             \
+    if (index == link->length - 1)                                             \
+      return link->endIndex;                                                   \
+    name##_node *cur = link->headIndex;                                        \
+    for (uint32 i = 0; i < index; i++)                                         \
+      cur = cur->next;                                                         \
+    return cur;                                                                \
+  }                                                                            \
+                                                                               \
+  /** @brief 插入到下标 index 处，与 SL_insert 相同：index 为0时插入头部，     \
+   *         否则必须小于链表长度（追加请用 name_add），成功返回1 */           \
+  static inline uint16 name##_insert(name##_link *const link, const type data, \
+                                     const uint32 index) {                     \
+    if (index == 0)                                                            \
+      return name##_insertHead(link, data);                                    \
+    if (index >= link->length) {                                               \
+      SL_log(SL_LOG_ERROR, "错误：索引 %u 越界(单向链表长度为 %u)",            \
+             index, link->length);                                             \
+      return 0;                                                                \
+    }                                                                          \
+    name##_node *node = name##_inifNode(data);                                 \
+    if (!node)                                                                 \
+      return 0;                                                                \
+    name##_node *prev = name##_getNode(link, index - 1);                       \
+    node->next = prev->next;                                                   \
+    prev->next = node;                                                         \
+    link->length++;                                                            \
+    return 1;                                                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 在 prev 之后插入（prev 为NULL时插入头部），O(1)；                 \
+   *         返回新节点，内存分配失败返回NULL */                               \
+  static inline name##_node *name##_insertAfter(                               \
+      name##_link *const link, name##_node *const prev, const type data) {     \
+    name##_node *node = name##_inifNode(data);                                 \
+    if (!node)                                                                 \
+      return NULL;                                                             \
+    if (prev == NULL) {                                                        \
+      node->next = link->headIndex;                                            \
+      link->headIndex = node;                                                  \
+    } else {                                                                   \
+      node->next = prev->next;                                                 \
+      prev->next = node;                                                       \
+    }                                                                          \
+    if (node->next == NULL)                                                    \
+      link->endIndex = node;                                                   \
+    link->length++;                                                            \
+    return node;                                                               \
+  }                                                                            \
+                                                                               \
+  /** @brief 按数组顺序追加，返回实际追加的个数 */                             \
+  static inline uint32 name##_appendArray(                                     \
+      name##_link *const link, const type *const array, const uint32 count) {  \
+    uint32 i = 0;                                                              \
+    for (; i < count; i++) {                                                   \
+      if (!name##_add(link, array[i]))                                         \
+        break;                                                                 \
+    }                                                                          \
+    return i;                                                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 释放全部节点，链表变为空链表 */                                   \
+  static inline void name##_freeNodes(name##_link *const link) {               \
+    name##_node *cur = link->headIndex;                                        \
+    while (cur) {                                                              \
+      name##_node *next = cur->next;                                           \
+      free(cur);                                                               \
+      cur = next;                                                              \
+    }                                                                          \
+    link->headIndex = NULL;                                                    \
+    link->endIndex = NULL;                                                     \
+    link->length = 0;                                                          \
+  }                                                                            \
+                                                                               \
+  /** @brief 释放全部节点与链表结构体，传入NULL时直接返回 */                   \
+  static inline void name##_freeLinks(name##_link *link) {                     \
+    if (link == NULL)                                                          \
+      return;                                                                  \
+    name##_freeNodes(link);                                                    \
+    free(link);                                                                \
+  }                                                                            \
+                                                                               \
+  /** @brief 由数组创建链表，内存分配失败返回NULL */                           \
+  static inline name##_link *name##_fromArray(const type *const array,         \
+                                              const uint32 count) {            \
+    name##_link *link = name##_inifLink();                                     \
+    if (link && name##_appendArray(link, array, count) != count) {             \
+      name##_freeLinks(link);                                                  \
+      return NULL;                                                             \
+    }                                                                          \
+    return link;                                                               \
+  }                                                                            \
+                                                                               \
+  /** @brief 统计等于 findData 的元素个数 */                                   \
+  static inline uint32 name##_count(name##_link *const link,                   \
+                                    const type findData) {                     \
+    uint32 count = 0;                                                          \
+    for (name##_node *cur = link->headIndex; cur; cur = cur->next)             \
+      count += cmp(cur->data, findData) == 0;                                  \
+    return count;                                                              \
+  }                                                                            \
+                                                                               \
+  /** @brief 与 SL_find 相同：返回全部等于 findData 的节点指针数组，           \
+   *         个数写入 outCount；未找到或内存分配失败返回NULL，                 \
+   *         数组需由调用者 free() */                                          \
+  static inline name##_node **name##_find(name##_link *const link,             \
+                                          const type findData,                 \
+                                          uint32 *outCount) {                  \
+    *outCount = 0;                                                             \
+    name##_node **nodes = NULL;                                                \
+    uint32 capacity = 16;                                                      \
+    uint32 count = 0;                                                          \
+    for (name##_node *cur = link->headIndex; cur; cur = cur->next) {           \
+      if (cmp(cur->data, findData) != 0)                                       \
+        continue;                                                              \
+      if (nodes == NULL || count == capacity) {                                \
+        if (nodes) /* 匹配数不超过链表长度，翻倍前截断以防溢出 */              \
+          capacity = capacity > link->length / 2 ? link->length                \
+                                                 : capacity * 2;               \
+        name##_node **grown = (name##_node **)realloc(                         \
+            nodes, sizeof(name##_node *) * (size_t)capacity);                  \
+        if (!grown) {                                                          \
+          SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");                   \
+          free(nodes);                                                         \
+          return NULL;                                                         \
+        }                                                                      \
+        nodes = grown;                                                         \
+      }                                                                        \
+      nodes[count++] = cur;                                                    \
+    }                                                                          \
+    *outCount = count;                                                         \
+    return nodes;                                                              \
+  }                                                                            \
+                                                                               \
+  /** @brief 与 SL_findInto 相同：最多写入 capacity 个匹配节点，               \
+   *         返回匹配总数（大于 capacity 表示数组容量不足） */                 \
+  static inline uint32 name##_findInto(name##_link *const link,                \
+                                       const type findData,                    \
+                                       name##_node **const outNodes,           \
+                                       const uint32 capacity) {                \
+    uint32 count = 0;                                                          \
+    for (name##_node *cur = link->headIndex; cur; cur = cur->next) {           \
+      if (cmp(cur->data, findData) == 0) {                                     \
+        if (count < capacity)                                                  \
+          outNodes[count] = cur;                                               \
+        count++;                                                               \
+      }                                                                        \
+    }                                                                          \
+    return count;                                                              \
+  }                                                                            \
+                                                                               \
+  /** @brief 与 SL_forEachMatch 相同：对每个匹配节点调用 visit，               \
+   *         回调返回非0时停止；返回已调用回调的次数 */                        \
+  static inline uint32 name##_forEachMatch(name##_link *const link,            \
+                                           const type findData,                \
+                                           name##_visitFn visit,               \
+                                           void *const context) {              \
+    uint32 count = 0;                                                          \
+    uint32 index = 0;                                                          \
+    for (name##_node *cur = link->headIndex; cur;                              \
+         cur = cur->next, index++) {                                           \
+      if (cmp(cur->data, findData) == 0) {                                     \
+        count++;                                                               \
+        if (visit(cur, index, context))                                        \
+          break;                                                               \
+      }                                                                        \
+    }                                                                          \
+    return count;                                                              \
+  }                                                                            \
+                                                                               \
+  /** @brief 第一个等于 findData 的节点，未找到返回NULL */                     \
+  static inline name##_node *name##_findFirst(name##_link *const link,         \
+                                              const type findData) {           \
+    for (name##_node *cur = link->headIndex; cur; cur = cur->next) {           \
+      if (cmp(cur->data, findData) == 0)                                       \
+        return cur;                                                            \
+    }                                                                          \
+    return NULL;                                                               \
+  }                                                                            \
+                                                                               \
+  /** @brief 第一个等于 findData 的元素下标，未找到返回UINT32_MAX */           \
+  static inline uint32 name##_getIndex(name##_link *const link,                \
+                                       const type findData) {                  \
+    uint32 index = 0;                                                          \
+    for (name##_node *cur = link->headIndex; cur; cur = cur->next, index++) {  \
+      if (cmp(cur->data, findData) == 0)                                       \
+        return index;                                                          \
+    }                                                                          \
+    return UINT32_MAX;                                                         \
+  }                                                                            \
+                                                                               \
+  /** @brief 删除头节点，数据写入 out（可为NULL），成功返回1 */                \
+  static inline uint16 name##_delHead(name##_link *const link,                 \
+                                      type *const out) {                       \
+    name##_node *node = link->headIndex;                                       \
+    if (!node) {                                                               \
+      SL_log(SL_LOG_ERROR, "错误：单向链表为空，无法删除头节点");              \
+      return 0;                                                                \
+    }                                                                          \
+    link->headIndex = node->next;                                              \
+    if (!link->headIndex)                                                      \
+      link->endIndex = NULL;                                                   \
+    link->length--;                                                            \
+    if (out)                                                                   \
+      *out = node->data;                                                       \
+    free(node);                                                                \
+    return 1;                                                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 删除下标为 index 的节点，数据写入 out（可为NULL） */              \
+  static inline uint16 name##_deleteIndex(name##_link *const link,             \
+                                          const uint32 index,                  \
+                                          type *const out) {                   \
+    if (index >= link->length) {                                               \
+      SL_log(SL_LOG_ERROR, "错误：索引 %u 越界(单向链表长度为 %u)",            \
+             index, link->length);                                             \
+      return 0;                                                                \
+    }                                                                          \
+    if (index == 0)                                                            \
+      return name##_delHead(link, out);                                        \
+    name##_node *prev = name##_getNode(link, index - 1);                       \
+    name##_node *node = prev->next;                                            \
+    prev->next = node->next;                                                   \
+    if (node == link->endIndex)                                                \
+      link->endIndex = prev;                                                   \
+    link->length--;                                                            \
+    if (out)                                                                   \
+      *out = node->data;                                                       \
+    free(node);                                                                \
+    return 1;                                                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 删除尾节点（O(n) 查找前驱），数据写入 out（可为NULL） */          \
+  static inline uint16 name##_delEnd(name##_link *const link,                  \
+                                     type *const out) {                        \
+    if (link->length == 0) {                                                   \
+      SL_log(SL_LOG_ERROR, "错误：单向链表为空，无法删除尾节点");              \
+      return 0;                                                                \
+    }                                                                          \
+    return name##_deleteIndex(link, link->length - 1, out);                    \
+  }                                                                            \
+                                                                               \
+  /** @brief 删除 prev 的后继节点（prev 为NULL时删除头节点），O(1)；           \
+   *         数据写入 out（可为NULL），没有后继节点返回0 */                    \
+  static inline uint16 name##_deleteAfter(name##_link *const link,             \
+                                          name##_node *const prev,             \
+                                          type *const out) {                   \
+    name##_node *node = prev ? prev->next : link->headIndex;                   \
+    if (node == NULL) {                                                        \
+      SL_log(SL_LOG_ERROR, "错误：指定节点没有后继节点，无法删除");            \
+      return 0;                                                                \
+    }                                                                          \
+    if (prev == NULL)                                                          \
+      link->headIndex = node->next;                                            \
+    else                                                                       \
+      prev->next = node->next;                                                 \
+    if (node == link->endIndex)                                                \
+      link->endIndex = prev;                                                   \
+    link->length--;                                                            \
+    if (out)                                                                   \
+      *out = node->data;                                                       \
+    free(node);                                                                \
+    return 1;                                                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 删除指定节点（O(n) 查找前驱），数据写入 out（可为NULL）；         \
+   *         节点不在链表中返回0 */                                            \
+  static inline uint16 name##_deleteNode(name##_link *const link,              \
+                                         name##_node *const node,              \
+                                         type *const out) {                    \
+    if (node == NULL || link->headIndex == NULL) {                             \
+      SL_log(SL_LOG_ERROR, "错误：单向链表为空或节点为NULL，无法删除节点");    \
+      return 0;                                                                \
+    }                                                                          \
+    name##_node *prev = NULL;                                                  \
+    name##_node *cur = link->headIndex;                                        \
+    while (cur && cur != node) {                                               \
+      prev = cur;                                                              \
+      cur = cur->next;                                                         \
+    }                                                                          \
+    if (cur == NULL) {                                                         \
+      SL_log(SL_LOG_ERROR, "未找到目标节点，无法删除");                        \
+      return 0;                                                                \
+    }                                                                          \
+    return name##_deleteAfter(link, prev, out);                                \
+  }                                                                            \
+                                                                               \
+  /** @brief 删除等于 targetData 的节点，                                      \
+   *         deleteCount 为0时删除全部，大于0时只删除第 deleteCount 个         \
+   *         匹配项；删除的节点数写入 outDeleted（可为NULL），                 \
+   *         至少删除一个节点时返回1 */                                        \
+  static inline uint16 name##_deleteData(name##_link *const link,              \
+                                         const type targetData,                \
+                                         const uint32 deleteCount,             \
+                                         uint32 *const outDeleted) {           \
+    uint32 matched = 0;                                                        \
+    uint32 deleted = 0;                                                        \
+    name##_node *prev = NULL;                                                  \
+    name##_node *cur = link->headIndex;                                        \
+    while (cur) {                                                              \
+      name##_node *next = cur->next;                                           \
+      if (cmp(cur->data, targetData) == 0 &&                                   \
+          (deleteCount == 0 || ++matched == deleteCount)) {                    \
+        if (prev)                                                              \
+          prev->next = next;                                                   \
+        else                                                                   \
+          link->headIndex = next;                                              \
+        if (cur == link->endIndex)                                             \
+          link->endIndex = prev;                                               \
+        free(cur);                                                             \
+        link->length--;                                                        \
+        deleted++;                                                             \
+        if (deleteCount)                                                       \
+          break;                                                               \
+      } else {                                                                 \
+        prev = cur;                                                            \
+      }                                                                        \
+      cur = next;                                                              \
+    }                                                                          \
+    if (outDeleted)                                                            \
+      *outDeleted = deleted;                                                   \
+    return deleted != 0;                                                       \
+  }                                                                            \
+                                                                               \
+  /** @brief 一次遍历删除 predicate 结果等于 match 的全部节点，                \
+   *         返回删除的节点数（name_removeIf / name_retainIf 共用） */         \
+  static inline uint32 name##_removeWhere(name##_link *const link,             \
+                                          name##_predicateFn predicate,        \
+                                          void *const context,                 \
+                                          const uint16 match) {                \
+    uint32 deleted = 0;                                                        \
+    name##_node *prev = NULL;                                                  \
+    name##_node *cur = link->headIndex;                                        \
+    while (cur) {                                                              \
+      name##_node *next = cur->next;                                           \
+      if ((predicate(cur->data, context) != 0) == match) {                     \
+        if (prev)                                                              \
+          prev->next = next;                                                   \
+        else                                                                   \
+          link->headIndex = next;                                              \
+        free(cur);                                                             \
+        deleted++;                                                             \
+      } else {                                                                 \
+        prev = cur;                                                            \
+      }                                                                        \
+      cur = next;                                                              \
+    }                                                                          \
+    link->endIndex = prev;                                                     \
+    link->length -= deleted;                                                   \
+    return deleted;                                                            \
+  }                                                                            \
+                                                                               \
+  /** @brief 删除满足 predicate 的全部节点，                                   \
+   *         返回删除的节点数 */                                               \
+  static inline uint32 name##_removeIf(name##_link *const link,                \
+                                       name##_predicateFn predicate,           \
+                                       void *const context) {                  \
+    return name##_removeWhere(link, predicate, context, 1);                    \
+  }                                                                            \
+                                                                               \
+  /** @brief 只保留满足 predicate 的节点，                                     \
+   *         返回删除的节点数 */                                               \
+  static inline uint32 name##_retainIf(name##_link *const link,                \
+                                       name##_predicateFn predicate,           \
+                                       void *const context) {                  \
+    return name##_removeWhere(link, predicate, context, 0);                    \
+  }                                                                            \
+                                                                               \
+  /** @brief 原地反转 */                                                       \
+  static inline void name##_reverse(name##_link *const link) {                 \
+    name##_node *prev = NULL;                                                  \
+    name##_node *cur = link->headIndex;                                        \
+    link->endIndex = cur;                                                      \
+    while (cur) {                                                              \
+      name##_node *next = cur->next;                                           \
+      cur->next = prev;                                                        \
+      prev = cur;                                                              \
+      cur = next;                                                              \
+    }                                                                          \
+    link->headIndex = prev;                                                    \
+  }                                                                            \
+                                                                               \
+  /** @brief a 是否应排在 b 之前（相等时为否，保证排序稳定） */                \
+  static inline uint16 name##_before(const type a, const type b,               \
+                                     enum sort way) {                          \
+    return way == ASC ? cmp(a, b) < 0 : cmp(a, b) > 0;                         \
+  }                                                                            \
+                                                                               \
+  /** @brief 稳定插入排序，O(n^2) */                                           \
+  static inline void name##_sort_Insertion(name##_link *const link,            \
+                                           enum sort way) {                    \
+    name##_node *sorted = NULL;                                                \
+    name##_node *tail = NULL;                                                  \
+    name##_node *cur = link->headIndex;                                        \
+    while (cur) {                                                              \
+      name##_node *next = cur->next;                                           \
+      if (!tail || !name##_before(cur->data, tail->data, way)) {               \
+        cur->next = NULL;                                                      \
+        if (tail)                                                              \
+          tail->next = cur;                                                    \
+        else                                                                   \
+          sorted = cur;                                                        \
+        tail = cur;                                                            \
+      } else if (name##_before(cur->data, sorted->data, way)) {                \
+        cur->next = sorted;                                                    \
+        sorted = cur;                                                          \
+      } else {                                                                 \
+        name##_node *pos = sorted;                                             \
+        while (!name##_before(cur->data, pos->next->data, way))                \
+          pos = pos->next;                                                     \
+        cur->next = pos->next;                                                 \
+        pos->next = cur;                                                       \
+      }                                                                        \
+      cur = next;                                                              \
+    }                                                                          \
+    link->headIndex = sorted;                                                  \
+    link->endIndex = tail;                                                     \
+  }                                                                            \
+                                                                               \
+  /** @brief 合并两条有序链（a 中元素原本在 b 之前） */                        \
+  static inline name##_node *name##_mergeRuns(name##_node *a, name##_node *b,  \
+                                              enum sort way) {                 \
+    name##_node head;                                                          \
+    name##_node *tail = &head;                                                 \
+    while (a && b) {                                                           \
+      if (name##_before(b->data, a->data, way)) {                              \
+        tail->next = b;                                                        \
+        b = b->next;                                                           \
+      } else {                                                                 \
+        tail->next = a;                                                        \
+        a = a->next;                                                           \
+      }                                                                        \
+      tail = tail->next;                                                       \
+    }                                                                          \
+    tail->next = a ? a : b;                                                    \
+    return head.next;                                                          \
+  }                                                                            \
+                                                                               \
+  /** @brief 稳定自底向上归并排序，O(n log n)，额外空间O(1) */                 \
+  static inline void name##_sort_Merge(name##_link *const link,                \
+                                       enum sort way) {                        \
+    name##_node *bins[33] = {NULL};                                            \
+    name##_node *cur = link->headIndex;                                        \
+    while (cur) {                                                              \
+      name##_node *next = cur->next;                                           \
+      name##_node *run = cur;                                                  \
+      uint32 i = 0;                                                            \
+      run->next = NULL;                                                        \
+      for (; bins[i]; i++) {                                                   \
+        run = name##_mergeRuns(bins[i], run, way);                             \
+        bins[i] = NULL;                                                        \
+      }                                                                        \
+      bins[i] = run;                                                           \
+      cur = next;                                                              \
+    }                                                                          \
+    name##_node *result = NULL;                                                \
+    for (uint32 i = 0; i < 33; i++) {                                          \
+      if (bins[i])                                                             \
+        result = name##_mergeRuns(bins[i], result, way);                       \
+    }                                                                          \
+    link->headIndex = result;                                                  \
+    link->endIndex = result;                                                   \
+    while (link->endIndex && link->endIndex->next)                             \
+      link->endIndex = link->endIndex->next;                                   \
+  }                                                                            \
+                                                                               \
+  /** @brief 复制到数组，返回写入的元素个数 */                                 \
+  static inline uint32 name##_toArray(name##_link *const link,                 \
+                                      type *const outArray,                    \
+                                      const uint32 capacity) {                 \
+    uint32 count = 0;                                                          \
+    for (name##_node *cur = link->headIndex; cur && count < capacity;          \
+         cur = cur->next)                                                      \
+      outArray[count++] = cur->data;                                           \
+    return count;                                                              \
+  }                                                                            \
+                                                                               \
+  /** @brief 按顺序对每个节点调用 visit（代替 SL_traverseLink 的打印，         \
+   *         输出格式由回调决定），回调返回非0时停止；返回已访问的节点数 */    \
+  static inline uint32 name##_forEach(name##_link *const link,                 \
+                                      name##_visitFn visit,                    \
+                                      void *const context) {                   \
+    uint32 index = 0;                                                          \
+    for (name##_node *cur = link->headIndex; cur; cur = cur->next) {           \
+      if (visit(cur, index++, context))                                        \
+        break;                                                                 \
+    }                                                                          \
+    return index;                                                              \
+  }                                                                            \
+                                                                               \
+  /** @brief 按第一次出现的顺序取出不同元素，返回新链表（线性探测哈希集合） */ \
+  static inline name##_link *name##_distinct(name##_link *const link) {        \
+    name##_link *result = name##_inifLink();                                   \
+    if (!result || link->length == 0)                                          \
+      return result;                                                           \
+    uint64 capacity = 16;                                                      \
+    uint32 shift = 64 - 4;                                                     \
+    while (capacity < (uint64)link->length * 2) {                              \
+      capacity <<= 1;                                                          \
+      shift--;                                                                 \
+    }                                                                          \
+    name##_node **slots =                                                      \
+        (name##_node **)calloc((size_t)capacity, sizeof(name##_node *));       \
+    if (!slots) {                                                              \
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");                       \
+      name##_freeLinks(result);                                                \
+      return NULL;                                                             \
+    }                                                                          \
+    for (name##_node *cur = link->headIndex; cur; cur = cur->next) {           \
+      uint64 slot = ((uint64)(hash(cur->data)) * 0x9E3779B97F4A7C15ull) >>     \
+                    shift;                                                     \
+      while (slots[slot] && cmp(slots[slot]->data, cur->data) != 0)            \
+        slot = (slot + 1) & (capacity - 1);                                    \
+      if (slots[slot])                                                         \
+        continue;                                                              \
+      if (!name##_add(result, cur->data)) {                                    \
+        free(slots);                                                           \
+        name##_freeLinks(result);                                              \
+        return NULL;                                                           \
+      }                                                                        \
+      slots[slot] = result->endIndex;                                          \
+    }                                                                          \
+    free(slots);                                                               \
+    return result;                                                             \
+  }                                                                            \
+                                                                               \
+  /** @brief 与 SL_josephusSurvivor 相同：每数到第 n 个节点删除该节点，        \
+   *         链表中只剩幸存节点，其数据写入 out（可为NULL）；                  \
+   *         链表为空或 n 为0时返回0 */                                        \
+  static inline uint16 name##_josephusSurvivor(name##_link *const link,        \
+                                               const uint32 n,                 \
+                                               type *const out) {              \
+    if (link->length == 0 || n == 0) {                                         \
+      SL_log(SL_LOG_ERROR, "错误：链表为空或报数间隔为0");                     \
+      return 0;                                                                \
+    }                                                                          \
+    name##_node *prev = link->endIndex;                                        \
+    while (link->length > 1) {                                                 \
+      for (uint32 steps = (n - 1) % link->length; steps; steps--)              \
+        prev = prev->next ? prev->next : link->headIndex;                      \
+      name##_deleteAfter(link, prev == link->endIndex ? NULL : prev, NULL);    \
+    }                                                                          \
+    if (out)                                                                   \
+      *out = link->headIndex->data;                                            \
+    return 1;                                                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 约瑟夫环幸存者的下标，由 SL_josephusIndex 计算，不修改链表；      \
+   *         链表为空或 n 为0时返回UINT32_MAX */                               \
+  static inline uint32 name##_josephusIndex(name##_link *const link,           \
+                                            const uint32 n) {                  \
+    return SL_josephusIndex(link->length, n);                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 与 SL_josephusPeek 相同：幸存者数据写入 out（可为NULL），         \
+   *         不修改链表；链表为空或 n 为0时返回0 */                            \
+  static inline uint16 name##_josephusPeek(name##_link *const link,            \
+                                           const uint32 n, type *const out) {  \
+    uint32 index = name##_josephusIndex(link, n);                              \
+    if (index == UINT32_MAX)                                                   \
+      return 0;                                                                \
+    if (out)                                                                   \
+      *out = name##_getNode(link, index)->data;                                \
+    return 1;                                                                  \
+  }                                                                            \
+                                                                               \
+  /** @brief 完整出列顺序（原始下标）写入 outOrder，由 SL_josephusOrder        \
+   *         计算，不修改链表；返回写入的元素个数 */                           \
+  static inline uint32 name##_josephusOrder(name##_link *const link,           \
+                                            const uint32 n,                    \
+                                            uint32 *const outOrder) {          \
+    return SL_josephusOrder(link->length, n, outOrder);                        \
+  }                                                                            \
+                                                                               \
+  /** @brief 与 fast_slow_find 相同：快慢指针查找倒数第 findIndex 个节点       \
+   *         （从1开始），索引无效返回NULL */                                  \
+  static inline name##_node *name##_fast_slow_find(name##_link *const link,    \
+                                                   const uint32 findIndex) {   \
+    if (findIndex == 0 || findIndex > link->length)                            \
+      return NULL;                                                             \
+    if (findIndex == 1)                                                        \
+      return link->endIndex;                                                   \
+    name##_node *slow = link->headIndex;                                       \
+    name##_node *fast = link->headIndex;                                       \
+    for (uint32 i = 0; i < findIndex; i++)                                     \
+      fast = fast->next;                                                       \
+    while (fast) {                                                             \
+      slow = slow->next;                                                       \
+      fast = fast->next;                                                       \
+    }                                                                          \
+    return slow;                                                               \
+  }                                                                            \
+                                                                               \
+  /** @brief 两条链表按 cmp 相等的最长公共后缀：长度写入 count，               \
+   *         返回后缀在 link1 中的首节点，没有公共后缀返回NULL */              \
+  static inline name##_node *name##_same_suffix(name##_link *const link1,      \
+                                                name##_link *const link2,      \
+                                                uint32 *const count) {         \
+    name##_node *a = link1->headIndex;                                         \
+    name##_node *b = link2->headIndex;                                         \
+    name##_node *start = NULL;                                                 \
+    *count = 0;                                                                \
+    for (uint32 i = link1->length; i > link2->length; i--)                     \
+      a = a->next;                                                             \
+    for (uint32 i = link2->length; i > link1->length; i--)                     \
+      b = b->next;                                                             \
+    for (; a; a = a->next, b = b->next) {                                      \
+      if (cmp(a->data, b->data) != 0) {                                        \
+        start = NULL;                                                          \
+        *count = 0;                                                            \
+      } else {                                                                 \
+        if (!start)                                                            \
+          start = a;                                                           \
+        (*count)++;                                                            \
+      }                                                                        \
+    }                                                                          \
+    return start;                                                              \
+  }
+
+/**
+ * @brief 为 DEFINE_SL_LIST(name, ...) 生成的链表追加 name_sort_Radix
+ *
+ * 必须在同一 name 的 DEFINE_SL_LIST 之后使用。没有合适排序键的类型
+ * （结构体、字符串等）不生成基数排序，使用 name_sort_Merge。
+ *
+ * @param name 与 DEFINE_SL_LIST 相同的前缀
+ * @param key 排序键，key(a) 返回 uint64，且其无符号序与 cmp 的顺序一致；
+ *            可使用 SL_GENERIC_KEY_UNSIGNED、SL_GENERIC_KEY_SIGNED、
+ *            SL_genericKeyDouble
+ */
+#define DEFINE_SL_LIST_RADIX(name, key)                                        \
+  /** @brief 基数排序的 (键, 节点) 元素 */                                     \
+  typedef struct name##_radixItem {                                            \
+    uint64 key;        /**< 排序键 */                                          \
+    name##_node *node; /**< 节点 */                                            \
+  } name##_radixItem;                                                          \
+                                                                               \
+  /** @brief 稳定 LSD 基数排序，O(n)：按 key(data) 的无符号序分 8 轮、         \
+   *         每轮 8 位分发，所有元素落在同一桶的轮次直接跳过；                 \
+   *         临时分配约 32 * length 字节，分配失败时退回 name_sort_Merge */    \
+  static inline void name##_sort_Radix(name##_link *const link,                \
+                                       enum sort way) {                        \
+    uint32 n = link->length;                                                   \
+    if (n < 2)                                                                 \
+      return;                                                                  \
+    name##_radixItem *items = (name##_radixItem *)malloc(                      \
+        sizeof(name##_radixItem) * 2 * (size_t)n);                             \
+    if (!items) {                                                              \
+      name##_sort_Merge(link, way);                                            \
+      return;                                                                  \
+    }                                                                          \
+    name##_radixItem *src = items;                                             \
+    name##_radixItem *dst = items + n;                                         \
+    uint32 hist[8][256] = {{0}};                                               \
+    uint32 i = 0;                                                              \
+    for (name##_node *cur = link->headIndex; cur; cur = cur->next, i++) {      \
+      uint64 k = (uint64)(key(cur->data));                                     \
+      if (way == DESC)                                                         \
+        k = ~k;                                                                \
+      src[i].key = k;                                                          \
+      src[i].node = cur;                                                       \
+      for (uint32 d = 0; d < 8; d++)                                           \
+        hist[d][(k >> (8 * d)) & 0xFF]++;                                      \
+    }                                                                          \
+    for (uint32 d = 0; d < 8; d++) {                                           \
+      uint32 shift = 8 * d;                                                    \
+      if (hist[d][(src[0].key >> shift) & 0xFF] == n)                          \
+        continue;                                                              \
+      uint32 offset = 0;                                                       \
+      for (uint32 b = 0; b < 256; b++) {                                       \
+        uint32 c = hist[d][b];                                                 \
+        hist[d][b] = offset;                                                   \
+        offset += c;                                                           \
+      }                                                                        \
+      for (i = 0; i < n; i++)                                                  \
+        dst[hist[d][(src[i].key >> shift) & 0xFF]++] = src[i];                 \
+      name##_radixItem *swap = src;                                            \
+      src = dst;                                                               \
+      dst = swap;                                                              \
+    }                                                                          \
+    for (i = 0; i + 1 < n; i++)                                                \
+      src[i].node->next = src[i + 1].node;                                     \
+    src[n - 1].node->next = NULL;                                              \
+    link->headIndex = src[0].node;                                             \
+    link->endIndex = src[n - 1].node;                                          \
+    free(items);                                                               \
+  }
+
+/** @} */ // 泛型单向链表
+
+#endif /* !__SL_GENERIC_H__ */
@@ -0,0 +1,95 @@
+/*
+ * @file sl_hazard.h
+ * @brief 风险指针（hazard pointer）安全内存回收接口定义头文件
+ * @author ringtree
+ * @date 2025-09-24
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 无锁数据结构中，被摘除的节点可能仍被其他线程读取，不能立即 free()。
+ * 每个线程在访问共享节点前把节点地址登记为风险指针，摘除节点的线程把节点
+ * 放入本线程的待回收列表，待回收数量达到阈值时扫描所有风险指针，
+ * 只回收没有被任何线程登记的节点。
+ *
+ * 使用说明：
+ * - 每个访问无锁结构的线程先调用 SL_hpAcquire() 领取一条线程记录，
+ *   退出前调用 SL_hpRelease() 归还；线程记录不能跨线程同时使用；
+ * - SL_hpProtect() 登记并校验风险指针，SL_hpRetire() 延迟回收节点。
+ */
+#pragma once
+#ifndef __SL_HAZARD_H__
+#define __SL_HAZARD_H__
+
+/* include ---------------------------------------------------- */
+#include <stdatomic.h>
+
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 可同时领取线程记录的最大线程数
+ */
+#define SL_HP_MAX_THREADS 128
+
+/**
+ * @brief 每个线程的风险指针槽位数
+ */
+#define SL_HP_SLOTS 3
+
+/**
+ * @brief 缓存行大小（用于隔离不同线程频繁写入的数据）
+ */
+#define SL_CACHE_LINE 64
+
+/**
+ * @defgroup 风险指针
+ * @brief 无锁数据结构的安全内存回收
+ * @{
+ */
+
+/**
+ * @brief 节点回收函数类型
+ */
+typedef void (*SL_reclaimFn)(void *ptr);
+
+/**
+ * @brief 线程记录（独占缓存行，避免伪共享）
+ */
+typedef struct SL_hpRecord {
+  _Alignas(SL_CACHE_LINE) _Atomic(void *) hazard[SL_HP_SLOTS]; ///< 风险指针槽位
+  atomic_int active;                   ///< 是否已被线程领取
+  void **retired;                      ///< 待回收节点列表（线程私有）
+  uint32 retiredCount;                 ///< 待回收节点数
+  uint32 retiredCapacity;              ///< 待回收列表容量
+} SL_hpRecord;
+
+/**
+ * @brief 风险指针域
+ */
+typedef struct SL_hpDomain {
+  SL_hpRecord records[SL_HP_MAX_THREADS]; ///< 线程记录
+  atomic_uint highWater;                  ///< 曾被领取过的最大记录下标 + 1
+  SL_reclaimFn reclaim;                   ///< 节点回收函数
+} SL_hpDomain;
+
+SL_hpDomain *SL_inifHpDomain(SL_reclaimFn reclaim);
+
+SL_hpRecord *SL_hpAcquire(SL_hpDomain *const domain);
+
+void SL_hpRelease(SL_hpDomain *const domain, SL_hpRecord *const record);
+
+void *SL_hpProtect(SL_hpRecord *const record, const uint32 slot,
+                   _Atomic(void *) *const source);
+
+void SL_hpSet(SL_hpRecord *const record, const uint32 slot, void *const ptr);
+
+void SL_hpClear(SL_hpRecord *const record);
+
+void SL_hpRetire(SL_hpDomain *const domain, SL_hpRecord *const record,
+                 void *const ptr);
+
+void SL_freeHpDomain(SL_hpDomain *domain);
+
+/** @} */ // 风险指针
+
+#endif /* !__SL_HAZARD_H__ */
@@ -0,0 +1,77 @@
+/*
+ * @file sl_index.h
+ * @brief 单向链表值哈希索引接口定义头文件
+ * @author ringtree
+ * @date 2025-09-12
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 哈希索引以开放寻址（线性探测）哈希表记录链表中每个值出现的次数，
+ * 挂接到 SL_link 后由插入、删除操作自动维护。
+ *
+ * 使用说明：
+ * - SL_indexEnable() 为链表建立索引，SL_indexDisable() 删除索引；
+ * - 启用索引后 SL_count() 为O(1)，SL_getIndex()、SL_find()、
+ *   SL_deleteData() 在值不存在时O(1)返回，并在找齐全部匹配项后提前结束遍历；
+ * - 索引只记录值的出现次数，不记录节点与位置：值存在时 SL_find()、
+ *   SL_getIndex() 仍需从表头遍历，最坏O(n)，只有 SL_count() 与
+ *   “值不存在”的判断被加速；排序、反转不影响索引；
+ * - 插入时索引扩容失败且无法继续使用原表的，链表自动删除索引，
+ *   之后的查找退回逐节点遍历（可再次调用 SL_indexEnable()）。
+ */
+#pragma once
+#ifndef __SL_INDEX_H__
+#define __SL_INDEX_H__
+
+/* include ---------------------------------------------------- */
+#include "data_struct.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 哈希索引初始槽位数（2的幂）
+ */
+#define SL_INDEX_MIN_CAPACITY 16
+
+/**
+ * @defgroup 单向链表哈希索引
+ * @brief 值到出现次数的开放寻址哈希表
+ * @{
+ */
+
+/**
+ * @brief 哈希索引槽位
+ */
+typedef struct SL_indexEntry {
+  Elemtype key; ///< 值
+  uint32 count; ///< 出现次数，0 表示空槽位
+} SL_indexEntry;
+
+/**
+ * @brief 哈希索引结构体
+ */
+struct SL_index {
+  SL_indexEntry *slots; ///< 槽位数组
+  uint32 capacity;      ///< 槽位数（2的幂）
+  uint32 shift;         ///< 哈希右移位数（32 - log2(capacity)）
+  uint32 size;          ///< 不同值的个数
+};
+
+SL_index *SL_inifIndex(const uint32 capacityHint);
+
+uint16 SL_indexAdd(SL_index *const index, const Elemtype key);
+
+void SL_indexRemove(SL_index *const index, const Elemtype key);
+
+uint32 SL_indexCount(const SL_index *const index, const Elemtype key);
+
+void SL_indexClear(SL_index *const index);
+
+void SL_freeIndex(SL_index *index);
+
+uint16 SL_indexEnable(SL_link *const linkedList);
+
+void SL_indexDisable(SL_link *const linkedList);
+
+/** @} */ // 单向链表哈希索引
+
+#endif /* !__SL_INDEX_H__ */
@@ -0,0 +1,127 @@
+/*
+ * @file sl_intrusive.h
+ * @brief 侵入式单向链表接口定义头文件
+ * @author ringtree
+ * @date 2025-10-04
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * SL_* 函数每插入一个元素都要分配一个 SL_node 并复制数据。侵入式链表由调用者
+ * 在自己的结构体中嵌入 IL_hook 字段，链表只串联这些字段，不分配也不释放任何节点：
+ * @code
+ * typedef struct task {
+ *   uint32 id;
+ *   IL_hook hook;
+ * } task;
+ *
+ * IL_link *queue = IL_inifLink();
+ * IL_add(queue, &t->hook);
+ * task *first = IL_ENTRY(queue->headIndex, task, hook);
+ * @endcode
+ *
+ * 对象的内存由调用者管理（可以来自调用者自己的对象池），删除类函数只把
+ * IL_hook 从链表中摘下并返回，IL_freeLinks() 只释放链表结构体。
+ * 同一个 IL_hook 同一时刻只能位于一条链表中。
+ */
+#pragma once
+#ifndef __SL_INTRUSIVE_H__
+#define __SL_INTRUSIVE_H__
+
+/* include ---------------------------------------------------- */
+#include <stddef.h>
+
+#include "data_struct.h"
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 由成员指针取得外层结构体指针
+ *
+ * @param ptr 成员指针
+ * @param type 外层结构体类型
+ * @param member 成员名
+ */
+#define IL_CONTAINER_OF(ptr, type, member)                                     \
+  ((type *)((char *)(ptr) - offsetof(type, member)))
+
+/**
+ * @brief 由 IL_hook 指针取得嵌入它的对象，hook 为NULL时结果为NULL
+ */
+#define IL_ENTRY(hook, type, member)                                           \
+  ((hook) ? IL_CONTAINER_OF(hook, type, member) : (type *)NULL)
+
+/**
+ * @defgroup 侵入式单向链表
+ * @brief 串联调用者对象中嵌入的链接字段，链接操作不分配内存
+ * @{
+ */
+
+/**
+ * @brief 嵌入调用者结构体中的链接字段
+ */
+typedef struct IL_hook {
+  struct IL_hook *next; ///< 后继链接字段
+} IL_hook;
+
+/**
+ * @brief 侵入式链表结构体
+ */
+typedef struct IL_link {
+  IL_hook *headIndex; ///< 头链接字段
+  IL_hook *endIndex;  ///< 尾链接字段
+  uint32 length;      ///< 链表长度
+} IL_link;
+
+/**
+ * @brief 比较两个对象，返回负数、0、正数分别表示 a 小于、等于、大于 b
+ */
+typedef int32 (*IL_compareFn)(const IL_hook *const a, const IL_hook *const b,
+                              void *const context);
+
+/**
+ * @brief 访问一个链接字段（如约瑟夫环中出列的对象）
+ */
+typedef void (*IL_visitFn)(IL_hook *const hook, void *const context);
+
+IL_link *IL_inifLink(void);
+
+void IL_clear(IL_link *const link);
+
+void IL_freeLinks(IL_link *link);
+
+void IL_insertHead(IL_link *const link, IL_hook *const hook);
+
+void IL_add(IL_link *const link, IL_hook *const hook);
+
+uint16 IL_insert(IL_link *const link, IL_hook *const hook, const uint32 index);
+
+void IL_insertAfter(IL_link *const link, IL_hook *const prev,
+                    IL_hook *const hook);
+
+IL_hook *IL_getNode(IL_link *const link, const uint32 index);
+
+IL_hook *IL_delHead(IL_link *const link);
+
+IL_hook *IL_delEnd(IL_link *const link);
+
+IL_hook *IL_deleteAfter(IL_link *const link, IL_hook *const prev);
+
+IL_hook *IL_deleteIndex(IL_link *const link, const uint32 index);
+
+uint16 IL_unlink(IL_link *const link, IL_hook *const hook);
+
+void IL_reverse(IL_link *const link);
+
+void IL_sort_Merge(IL_link *const link, IL_compareFn compare,
+                   void *const context, enum sort way);
+
+IL_hook *IL_josephusSurvivor(IL_link *const link, const uint32 n,
+                             IL_visitFn eliminated, void *const context);
+
+IL_hook *IL_sameSuffix(IL_link *const link1, IL_link *const link2,
+                       IL_compareFn compare, void *const context,
+                       uint32 *const count);
+
+/** @} */ // 侵入式单向链表
+
+#endif /* !__SL_INTRUSIVE_H__ */
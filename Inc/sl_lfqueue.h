@@ -0,0 +1,71 @@
+/*
+ * @file sl_lfqueue.h
+ * @brief 基于 SL_node 的无锁多生产者多消费者队列接口定义头文件
+ * @author ringtree
+ * @date 2025-09-24
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 采用 Michael-Scott 算法：队列始终保留一个哑节点，head 指向哑节点，
+ * 入队以 CAS 挂接到 tail->next 后推进 tail，出队以 CAS 推进 head，
+ * 原哑节点交给风险指针延迟回收，新的队首节点成为哑节点。
+ *
+ * 使用说明：
+ * - LQ_add() / LQ_delHead() 分别对应 SL_add() / SL_delHead()；
+ * - 每个访问队列的线程先调用 LQ_attach() 取得线程记录，
+ *   之后的入队出队都传入该记录，线程退出前调用 LQ_detach()；
+ * - 节点的 next 域通过 LQ_NEXT() 以原子方式访问，
+ *   不能与 data_struct.h 中的 SL_* 函数混用同一条链。
+ */
+#pragma once
+#ifndef __SL_LFQUEUE_H__
+#define __SL_LFQUEUE_H__
+
+/* include ---------------------------------------------------- */
+#include <stdatomic.h>
+
+#include "data_struct.h"
+#include "sl_hazard.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 以原子方式访问节点的 next 域
+ *
+ * SL_node.next 声明为普通指针以保持与单向链表相同的节点布局，
+ * 在 GCC/Clang/MSVC 支持的平台上 _Atomic(SL_node *) 与 SL_node * 大小、
+ * 对齐一致，这里直接把地址转换为原子指针使用。
+ */
+#define LQ_NEXT(node) ((_Atomic(SL_node *) *)&(node)->next)
+
+/**
+ * @defgroup 无锁队列
+ * @brief 多生产者多消费者无锁队列
+ * @{
+ */
+
+/**
+ * @brief 无锁队列（head 与 tail 分处不同缓存行，避免生产者与消费者伪共享）
+ */
+typedef struct SL_lfQueue {
+  _Alignas(SL_CACHE_LINE) _Atomic(SL_node *) head; ///< 哑节点（出队端）
+  _Alignas(SL_CACHE_LINE) _Atomic(SL_node *) tail; ///< 尾节点（入队端）
+  _Alignas(SL_CACHE_LINE) SL_hpDomain *hp;         ///< 风险指针域
+} SL_lfQueue;
+
+SL_lfQueue *LQ_inifQueue(void);
+
+SL_hpRecord *LQ_attach(SL_lfQueue *const queue);
+
+void LQ_detach(SL_lfQueue *const queue, SL_hpRecord *const record);
+
+uint16 LQ_add(SL_lfQueue *const queue, SL_hpRecord *const record,
+              const Elemtype data);
+
+uint16 LQ_delHead(SL_lfQueue *const queue, SL_hpRecord *const record,
+                  Elemtype *const outData);
+
+void LQ_freeQueue(SL_lfQueue *queue);
+
+/** @} */ // 无锁队列
+
+#endif /* !__SL_LFQUEUE_H__ */
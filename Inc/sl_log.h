@@ -0,0 +1,75 @@
+/*
+ * @file sl_log.h
+ * @brief 单向链表日志钩子接口定义头文件
+ * @author ringtree
+ * @date 2025-10-06
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * data_struct.c 及 dl_link.c、sl_skip.c、sl_unrolled.c 等其它模块中原先直接 printf() 的
+ * 错误、警告与提示信息统一经 SL_log() 输出：
+ * - 低于当前级别的消息在格式化之前直接返回，不产生任何开销；
+ * - 默认级别为 SL_LOG_WARN，SL_freeNodes() / SL_freeLinks() 等的提示信息默认不输出；
+ * - 默认钩子把消息加换行写到 stdout，与原先的输出一致；
+ * - SL_setLogHook(NULL, NULL) 或 SL_setLogLevel(SL_LOG_OFF) 关闭全部诊断输出；
+ *   SL_traverseLink()、DL_traverseLink()、UL_traverseLink() 等打印链表内容的函数
+ *   与 SL_statsDump() 的输出不是诊断信息，不经过 SL_log()。
+ *
+ * sl_pool.c、sl_vector.c、sl_index.c 的分配函数失败时只返回失败值，
+ * 由调用它们的 SL_* 原接口报告。需要区分失败原因或完全不产生输出时，
+ * 使用 data_struct.h 中的 SL_try* 状态码接口，它们在任何路径上都不调用 SL_log()。
+ */
+#pragma once
+#ifndef __SL_LOG_H__
+#define __SL_LOG_H__
+
+/* include ---------------------------------------------------- */
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 单条日志格式化后的最大字节数（超出部分截断）
+ */
+#define SL_LOG_MAX_MESSAGE 256
+
+/**
+ * @defgroup 日志钩子
+ * @brief 可替换的日志输出与级别过滤
+ * @{
+ */
+
+/**
+ * @brief 日志级别
+ */
+enum SL_logLevel {
+  SL_LOG_INFO = 0x00, ///< 提示（如节点已释放）
+  SL_LOG_WARN,        ///< 警告（如传入NULL的释放操作）
+  SL_LOG_ERROR,       ///< 错误（如空链表删除、索引越界、内存不足）
+  SL_LOG_OFF          ///< 作为级别设置时关闭全部输出
+};
+
+/**
+ * @brief 日志钩子
+ *
+ * @param level 日志级别
+ * @param message 格式化后的消息（不含换行）
+ * @param context SL_setLogHook() 传入的用户上下文
+ */
+typedef void (*SL_logFn)(const enum SL_logLevel level,
+                         const char *const message, void *const context);
+
+void SL_setLogHook(SL_logFn hook, void *const context);
+
+void SL_setLogLevel(const enum SL_logLevel level);
+
+enum SL_logLevel SL_getLogLevel(void);
+
+void SL_logStdout(const enum SL_logLevel level, const char *const message,
+                  void *const context);
+
+void SL_log(const enum SL_logLevel level, const char *const format, ...)
+    __attribute__((format(printf, 2, 3)));
+
+/** @} */ // 日志钩子
+
+#endif /* !__SL_LOG_H__ */
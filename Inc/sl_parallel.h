@@ -0,0 +1,140 @@
+/*
+ * @file sl_parallel.h
+ * @brief 单向链表并行分段遍历与归约接口定义头文件
+ * @author ringtree
+ * @date 2025-09-30
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 把 SL_link 切分为若干段，由线程池并行执行统计、求和、最值、条件筛选
+ * 以及用户自定义的 map / reduce：
+ * - 分段表（PL_split）一次遍历记录各段的起始节点，之后按 link->version
+ *   判断是否过期，链表未修改时重复使用，不再遍历；
+ * - 线程池（PL_pool）常驻工作线程，每次调用只唤醒一次；
+ * - PL_STATIC 按段号平均分给各线程，PL_STEALING 在此基础上允许空闲线程
+ *   从其它线程的段区间尾部窃取，适合各段耗时不均（如谓词代价不同）的情况。
+ *
+ * 各段的部分结果按段号顺序合并，因此结果与串行遍历一致，
+ * PL_filter() 的输出保持原链表顺序。
+ * 并行遍历期间不能修改链表；节点存储与顺序存储链表均可使用。
+ */
+#pragma once
+#ifndef __SL_PARALLEL_H__
+#define __SL_PARALLEL_H__
+
+/* include ---------------------------------------------------- */
+#include <pthread.h>
+
+#include "data_struct.h"
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 线程池最大线程数
+ */
+#define PL_MAX_THREADS 64
+
+/**
+ * @brief 未指定段数时每个线程分得的段数
+ */
+#define PL_SEGMENTS_PER_THREAD 8
+
+/**
+ * @defgroup 并行遍历
+ * @brief 单向链表的分段并行 map / reduce
+ * @{
+ */
+
+/**
+ * @brief 段调度方式
+ */
+enum PL_schedule { PL_STATIC = 0x00, PL_STEALING = 0x01 };
+
+/**
+ * @brief 常驻线程池
+ */
+typedef struct PL_pool {
+  pthread_t threads[PL_MAX_THREADS]; ///< 工作线程
+  uint32 threadCount;                ///< 工作线程数
+  pthread_mutex_t lock;              ///< 保护以下字段
+  pthread_cond_t wake;               ///< 新任务到达
+  pthread_cond_t done;               ///< 全部线程完成当前任务
+  uint64 generation;                 ///< 任务序号，每提交一次递增
+  uint32 running;                    ///< 尚未完成当前任务的线程数
+  uint16 stop;                       ///< 线程池正在关闭
+  void (*task)(void *const arg);     ///< 当前任务（每个线程各调用一次）
+  void *arg;                         ///< 当前任务参数
+} PL_pool;
+
+/**
+ * @brief 分段表（缓存各段的起点）
+ */
+typedef struct PL_split {
+  SL_link *link;    ///< 被分段的链表
+  uint32 requested; ///< 请求的段数
+  uint32 segments;  ///< 实际段数（不超过链表长度）
+  uint32 version;   ///< 与 link->version 一致时分段表有效
+  uint32 length;    ///< 建表时的链表长度
+  SL_node **starts; ///< 各段第一个节点（顺序存储链表为NULL）
+  uint32 *offsets;  ///< 各段第一个元素的下标，offsets[segments] == length
+} PL_split;
+
+/**
+ * @brief PL_reduce() 的结果
+ */
+typedef struct PL_result {
+  uint32 count; ///< 元素个数
+  int64 sum;    ///< 元素之和
+  Elemtype min; ///< 最小值（count 为0时无意义）
+  Elemtype max; ///< 最大值（count 为0时无意义）
+} PL_result;
+
+/**
+ * @brief 元素谓词，返回非0表示满足条件
+ */
+typedef uint16 (*PL_predicate)(const Elemtype data, void *const context);
+
+/**
+ * @brief 把一个元素累加到部分结果中
+ */
+typedef void (*PL_mapFn)(void *const acc, const Elemtype data,
+                         void *const context);
+
+/**
+ * @brief 把部分结果 other 合并到 acc 中（按段号顺序调用）
+ */
+typedef void (*PL_combineFn)(void *const acc, const void *const other,
+                             void *const context);
+
+PL_pool *PL_inifPool(uint32 threads);
+
+void PL_freePool(PL_pool *pool);
+
+PL_split *PL_inifSplit(SL_link *const link, const uint32 segments);
+
+uint16 PL_refreshSplit(PL_split *const split);
+
+void PL_freeSplit(PL_split *split);
+
+uint32 PL_count(PL_pool *const pool, PL_split *const split,
+                enum PL_schedule schedule, const Elemtype findData);
+
+PL_result PL_reduce(PL_pool *const pool, PL_split *const split,
+                    enum PL_schedule schedule);
+
+uint32 PL_countIf(PL_pool *const pool, PL_split *const split,
+                  enum PL_schedule schedule, PL_predicate predicate,
+                  void *const context);
+
+SL_link *PL_filter(PL_pool *const pool, PL_split *const split,
+                   enum PL_schedule schedule, PL_predicate predicate,
+                   void *const context);
+
+uint16 PL_mapReduce(PL_pool *const pool, PL_split *const split,
+                    enum PL_schedule schedule, PL_mapFn map,
+                    PL_combineFn combine, void *const acc,
+                    const uint32 accSize, void *const context);
+
+/** @} */ // 并行遍历
+
+#endif /* !__SL_PARALLEL_H__ */
@@ -0,0 +1,76 @@
+/*
+ * @file sl_pool.h
+ * @brief 单向链表节点池（slab 分配器）接口定义头文件
+ * @author ringtree
+ * @date 2025-08-30
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 节点池按块（slab）批量申请 SL_node，被删除的节点挂入空闲链表循环利用，
+ * 从而避免每次插入/删除都调用 malloc()/free()。
+ *
+ * 使用说明：
+ * - 通过 SL_inifLinkPool(NULL) 创建带私有节点池的链表，链表释放时整池回收；
+ * - 通过 SL_inifPool() 创建共享节点池，再传给 SL_inifLinkPool(pool)
+ *   供多个链表共用，共享池需由调用者使用 SL_freePool() 释放；
+ * - 节点池本身不是线程安全的。
+ */
+#pragma once
+#ifndef __SL_POOL_H__
+#define __SL_POOL_H__
+
+/* include ---------------------------------------------------- */
+#include "data_struct.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 节点块默认容纳的节点数量
+ */
+#define SL_POOL_SLAB_NODES 1024
+
+/**
+ * @defgroup 单向链表节点池
+ * @brief 单向链表节点的块式分配与回收
+ * @{
+ */
+
+/**
+ * @brief 节点块结构体
+ *
+ * 一次 malloc() 得到的连续节点数组，块之间通过 next 串接。
+ */
+typedef struct SL_slab {
+  struct SL_slab *next; ///< 下一个节点块
+  uint32 capacity;      ///< 本块可容纳的节点数
+  uint32 used;          ///< 本块已切分出去的节点数
+  SL_node nodes[];      ///< 节点存储区
+} SL_slab;
+
+/**
+ * @brief 节点池结构体
+ */
+struct SL_pool {
+  SL_slab *slabs;    ///< 节点块链表，首块为当前切分块
+  SL_node *freeList; ///< 回收节点空闲链表（借用节点 next 指针串接）
+  uint32 slabNodes;  ///< 新建节点块默认容纳的节点数
+  uint32 slabCount;  ///< 当前节点块数量
+};
+
+SL_pool *SL_inifPool(const uint32 slabNodes);
+
+SL_node *SL_poolAlloc(SL_pool *const pool);
+
+SL_node *SL_poolAllocBlock(SL_pool *const pool, const uint32 count);
+
+void SL_poolRelease(SL_pool *const pool, SL_node *const node);
+
+void SL_poolReleaseChain(SL_pool *const pool, SL_node *const head,
+                         SL_node *const tail);
+
+void SL_poolReset(SL_pool *const pool);
+
+void SL_freePool(SL_pool *pool);
+
+/** @} */ // 单向链表节点池
+
+#endif /* !__SL_POOL_H__ */
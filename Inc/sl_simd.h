@@ -0,0 +1,67 @@
+/*
+ * @file sl_simd.h
+ * @brief 单向链表连续快照与向量化扫描接口定义头文件
+ * @author ringtree
+ * @date 2025-09-16
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 快照把链表数据按顺序打包到64字节对齐的连续数组中，扫描类操作在数组上
+ * 以 SIMD 指令执行，避免逐节点的指针跳转。
+ *
+ * 使用说明：
+ * - SL_inifSnapshot() 为链表创建快照，SL_freeSnapshot() 释放快照；
+ * - 快照通过链表的 version 字段判断是否过期，所有 SL_snap* 查询函数在
+ *   执行前自动重建过期的快照，链表修改后无需手动刷新；
+ * - x86/x86-64 下按 CPU 能力在运行时选择 AVX2、SSE4.2 或标量实现，
+ *   其他平台使用标量实现，结果完全一致。
+ */
+#pragma once
+#ifndef __SL_SIMD_H__
+#define __SL_SIMD_H__
+
+/* include ---------------------------------------------------- */
+#include "data_struct.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @defgroup 单向链表向量化扫描
+ * @brief 基于连续快照的向量化查找与统计
+ * @{
+ */
+
+/**
+ * @brief 链表连续快照结构体
+ */
+typedef struct SL_snapshot {
+  SL_link *link;   ///< 快照对应的链表
+  Elemtype *data;  ///< 64字节对齐的连续数据
+  uint32 length;   ///< 数据个数
+  uint32 capacity; ///< 数据数组容量
+  uint32 version;  ///< 生成快照时链表的版本号
+  uint16 valid;    ///< 快照是否已生成
+} SL_snapshot;
+
+const char *SL_simdLevel(void);
+
+SL_snapshot *SL_inifSnapshot(SL_link *const linkedList);
+
+uint16 SL_snapshotRefresh(SL_snapshot *const snap);
+
+void SL_freeSnapshot(SL_snapshot *snap);
+
+uint32 SL_snapCount(SL_snapshot *const snap, const Elemtype findData);
+
+uint32 SL_snapGetIndex(SL_snapshot *const snap, const Elemtype findData);
+
+uint16 SL_snapAbsRange(SL_snapshot *const snap, uint32 *const outMin,
+                       uint32 *const outMax);
+
+int64 SL_snapSum(SL_snapshot *const snap);
+
+uint32 SL_snapHistogram(SL_snapshot *const snap, const Elemtype low,
+                        const uint32 buckets, uint32 *const outHist);
+
+/** @} */ // 单向链表向量化扫描
+
+#endif /* !__SL_SIMD_H__ */
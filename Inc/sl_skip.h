@@ -0,0 +1,84 @@
+/*
+ * @file sl_skip.h
+ * @brief 单向链表跳表索引接口定义头文件
+ * @author ringtree
+ * @date 2025-09-26
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 在 SL_link 的节点链之上建立多层快车道：第0层就是原节点链本身，
+ * 每个节点以 1/4 的概率逐层晋升，每条快车道链接记录跨过的底层节点数（宽度），
+ * 因此按下标访问与（升序链表上的）按值查找都只需期望O(log n)。
+ *
+ * 使用说明：
+ * - 通过 SK_* 函数修改链表时索引同步更新；
+ * - 也可以继续对同一链表调用 data_struct.h 中的任意函数，
+ *   索引会在下一次 SK_* 调用时根据 version 发现过期并以O(n)重建；
+ * - 按值查找只在链表为升序（非严格）时为O(log n)，否则退化为线性查找。
+ */
+#pragma once
+#ifndef __SL_SKIP_H__
+#define __SL_SKIP_H__
+
+/* include ---------------------------------------------------- */
+#include "data_struct.h"
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 快车道最大层数（晋升概率 1/4 时足以覆盖 4^16 个节点）
+ */
+#define SK_MAX_LEVEL 16
+
+/**
+ * @defgroup 跳表索引
+ * @brief 单向链表的O(log n)下标访问与有序查找
+ * @{
+ */
+
+/**
+ * @brief 快车道节点
+ */
+typedef struct SK_lane {
+  SL_node *node;        ///< 对应的底层节点（头哨兵为NULL）
+  struct SK_lane *next; ///< 同层的下一个快车道节点
+  struct SK_lane *down; ///< 下一层中同一底层节点的快车道节点
+  uint32 width;         ///< 到 next 跨过的底层节点数（next为NULL时计到表尾之后）
+} SK_lane;
+
+/**
+ * @brief 跳表索引
+ */
+typedef struct SK_index {
+  SL_link *link;               ///< 被索引的单向链表
+  SK_lane head[SK_MAX_LEVEL];  ///< 各层头哨兵（head[0] 为最低一层快车道）
+  uint32 level;                ///< 当前使用的快车道层数
+  uint32 version;              ///< 与 link->version 一致时索引有效
+  uint32 seed;                 ///< 晋升层数随机数状态
+  uint16 sorted;               ///< 链表是否为升序
+} SK_index;
+
+SK_index *SK_inifIndex(SL_link *const link);
+
+uint16 SK_refresh(SK_index *const skip);
+
+SL_node *SK_getNode(SK_index *const skip, const uint32 index);
+
+Elemtype SK_getData(SK_index *const skip, const uint32 index);
+
+uint32 SK_getIndex(SK_index *const skip, const Elemtype findData);
+
+uint16 SK_insert(SK_index *const skip, const Elemtype inputData,
+                 const uint32 index);
+
+uint32 SK_insertSorted(SK_index *const skip, const Elemtype inputData);
+
+Elemtype SK_deleteIndex(SK_index *const skip, const uint32 index);
+
+uint16 SK_deleteData(SK_index *const skip, const Elemtype targetData);
+
+void SK_freeIndex(SK_index *skip);
+
+/** @} */ // 跳表索引
+
+#endif /* !__SL_SKIP_H__ */
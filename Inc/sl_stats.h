@@ -0,0 +1,168 @@
+/*
+ * @file sl_stats.h
+ * @brief 单向链表操作统计接口定义头文件
+ * @author ringtree
+ * @date 2025-10-05
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 编译时定义 SL_STATS（CMake 选项 -DSL_STATS=ON）后，data_struct.c 中的
+ * SL_* 操作按操作类型记录：
+ * - 调用次数；
+ * - 访问的节点数（遍历、查找前驱、排序时经过的节点）；
+ * - 分配与释放的节点数（malloc() / free() 或节点池）；
+ * - 耗时总和与按2的幂分桶的耗时直方图。
+ * 嵌套调用（如 SL_insert 调用 SL_insertHead）只记在最外层操作上。
+ * 计时默认使用 clock_gettime(CLOCK_MONOTONIC)，单位为纳秒；在 x86 上再定义
+ * SL_STATS_RDTSC 时改用 rdtsc，单位为 CPU 周期。
+ *
+ * 未定义 SL_STATS 时所有记录宏展开为空，data_struct.c 的代码与未插桩时相同；
+ * 快照、转储等接口仍然可以调用，结果全部为0。
+ */
+#pragma once
+#ifndef __SL_STATS_H__
+#define __SL_STATS_H__
+
+/* include ---------------------------------------------------- */
+#include <stdio.h>
+
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 耗时直方图的桶数，第 i 个桶统计耗时在 [2^i, 2^(i+1)) 的调用
+ */
+#define SL_STATS_BUCKETS 32
+
+/**
+ * @defgroup 操作统计
+ * @brief 编译期可关闭的调用次数、节点访问、内存分配与耗时统计
+ * @{
+ */
+
+/**
+ * @brief 被统计的操作
+ */
+enum SL_statOp {
+  SL_OP_INSERT_HEAD = 0x00,
+  SL_OP_ADD,
+  SL_OP_INSERT,
+  SL_OP_INSERT_AFTER,
+  SL_OP_APPEND_ARRAY,
+  SL_OP_COUNT,
+  SL_OP_FIND,
+  SL_OP_GET_INDEX,
+  SL_OP_JOSEPHUS,
+  SL_OP_SORT_INSERTION,
+  SL_OP_SORT_MERGE,
+  SL_OP_SORT_RADIX,
+  SL_OP_REVERSE,
+  SL_OP_DEL_HEAD,
+  SL_OP_DEL_END,
+  SL_OP_DELETE_NODE,
+  SL_OP_DELETE_INDEX,
+  SL_OP_DELETE_DATA,
+  SL_OP_DELETE_BATCH,
+  SL_OP_TRAVERSE,
+  SL_OP_TO_ARRAY,
+  SL_OP_FREE,
+  SL_OP_MAX ///< 操作个数，不是操作
+};
+
+/**
+ * @brief 单个操作的统计
+ */
+typedef struct SL_opStats {
+  uint64 calls;                       ///< 调用次数
+  uint64 nodes;                       ///< 访问的节点数
+  uint64 allocs;                      ///< 分配的节点数
+  uint64 frees;                       ///< 释放的节点数
+  uint64 totalTime;                   ///< 耗时总和（纳秒或周期）
+  uint64 histogram[SL_STATS_BUCKETS]; ///< 耗时直方图
+} SL_opStats;
+
+/**
+ * @brief 全部操作的统计快照
+ */
+typedef struct SL_stats {
+  uint16 enabled;            ///< 编译时是否启用了统计
+  SL_opStats ops[SL_OP_MAX]; ///< 按 enum SL_statOp 索引
+} SL_stats;
+
+void SL_statsSnapshot(SL_stats *const out);
+
+void SL_statsReset(void);
+
+void SL_statsDump(FILE *const out);
+
+const char *SL_statsOpName(enum SL_statOp op);
+
+uint16 SL_statsStartDump(FILE *const out, const uint32 intervalMs);
+
+void SL_statsStopDump(void);
+
+#ifdef SL_STATS
+
+/**
+ * @brief 一次被统计的调用（位于调用者栈上）
+ */
+typedef struct SL_statScope {
+  int32 op;      ///< 操作，-1 表示嵌套调用不单独统计
+  uint64 start;  ///< 开始时间
+  uint64 nodes;  ///< 访问的节点数
+  uint64 allocs; ///< 分配的节点数
+  uint64 frees;  ///< 释放的节点数
+} SL_statScope;
+
+extern _Thread_local SL_statScope *SL_statCurrent;
+
+void SL_statEnter(SL_statScope *const scope, const enum SL_statOp op);
+
+void SL_statLeave(SL_statScope *const scope);
+
+/**
+ * @brief 在函数开头声明一次被统计的调用，函数返回时自动记录
+ */
+#define SL_STAT_SCOPE(op)                                                      \
+  SL_statScope SL_statScopeVar __attribute__((cleanup(SL_statLeave)));         \
+  SL_statEnter(&SL_statScopeVar, op)
+
+/**
+ * @brief 记录访问了 k 个节点
+ */
+#define SL_STAT_NODES(k)                                                       \
+  do {                                                                         \
+    if (SL_statCurrent)                                                        \
+      SL_statCurrent->nodes += (k);                                            \
+  } while (0)
+
+/**
+ * @brief 记录分配了 k 个节点
+ */
+#define SL_STAT_ALLOC(k)                                                       \
+  do {                                                                         \
+    if (SL_statCurrent)                                                        \
+      SL_statCurrent->allocs += (k);                                           \
+  } while (0)
+
+/**
+ * @brief 记录释放了 k 个节点
+ */
+#define SL_STAT_FREE(k)                                                        \
+  do {                                                                         \
+    if (SL_statCurrent)                                                        \
+      SL_statCurrent->frees += (k);                                            \
+  } while (0)
+
+#else
+
+#define SL_STAT_SCOPE(op) ((void)0)
+#define SL_STAT_NODES(k) ((void)0)
+#define SL_STAT_ALLOC(k) ((void)0)
+#define SL_STAT_FREE(k) ((void)0)
+
+#endif /* SL_STATS */
+
+/** @} */ // 操作统计
+
+#endif /* !__SL_STATS_H__ */
@@ -0,0 +1,91 @@
+/*
+ * @file sl_unrolled.h
+ * @brief 展开链表（unrolled linked list）接口定义头文件
+ * @author ringtree
+ * @date 2025-09-05
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 展开链表的每个节点块恰好占一个缓存行（64字节），块内连续存放多个
+ * Elemtype 数据，遍历时每个缓存行只发生一次指针跳转。
+ *
+ * 使用说明：
+ * - 接口与 data_struct.h 中的单向链表一一对应，前缀为 UL_；
+ * - 索引从0开始计数，失败时返回值约定与单向链表相同（UINT32_MAX）；
+ * - 节点块按64字节对齐分配，需通过 UL_freeLinks() 释放。
+ */
+#pragma once
+#ifndef __SL_UNROLLED_H__
+#define __SL_UNROLLED_H__
+
+/* include ---------------------------------------------------- */
+#include "data_struct.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 节点块大小（字节），与缓存行大小一致
+ */
+#define UL_BLOCK_BYTES 64
+
+/**
+ * @brief 每个节点块可容纳的数据个数
+ */
+#define UL_BLOCK_CAP                                                           \
+  ((UL_BLOCK_BYTES - sizeof(void *) - sizeof(uint32)) / sizeof(Elemtype))
+
+/**
+ * @defgroup 展开链表模块
+ * @brief 以缓存行大小的节点块存储数据的链表
+ * @{
+ */
+
+/**
+ * @brief 展开链表节点块结构体
+ */
+typedef struct UL_block {
+  struct UL_block *next;       ///< 指向下一个节点块的指针
+  uint32 count;                ///< 块内有效数据个数
+  Elemtype data[UL_BLOCK_CAP]; ///< 块内数据
+} UL_block;
+
+/**
+ * @brief 展开链表结构体
+ */
+typedef struct SL_unrolled {
+  UL_block *headIndex; ///< 指向首个节点块的指针
+  UL_block *endIndex;  ///< 指向末尾节点块的指针
+  uint32 length;       ///< 数据总个数
+  uint32 blocks;       ///< 节点块个数
+} SL_unrolled;
+
+SL_unrolled *UL_inifLink(void);
+
+void UL_insertHead(SL_unrolled *const list, const Elemtype inputData);
+
+void UL_add(SL_unrolled *const list, const Elemtype inputData);
+
+void UL_insert(SL_unrolled *const list, const Elemtype inputData,
+               const uint32 index);
+
+uint32 UL_count(SL_unrolled *const list, const Elemtype findData);
+
+uint32 UL_getIndex(SL_unrolled *const list, const Elemtype findData);
+
+Elemtype UL_getData(SL_unrolled *const list, const uint32 index);
+
+Elemtype UL_deleteIndex(SL_unrolled *const list, const uint32 index);
+
+Elemtype UL_deleteData(SL_unrolled *const list, const Elemtype targetData,
+                       uint32 deleteCount);
+
+uint16 UL_reverse(SL_unrolled *const list);
+
+void UL_sort(SL_unrolled *const list, enum sort way);
+
+uint32 UL_traverseLink(SL_unrolled *const list);
+
+void UL_freeLinks(SL_unrolled *list);
+
+/** @} */ // 展开链表模块
+
+#endif /* !__SL_UNROLLED_H__ */
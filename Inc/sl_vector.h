@@ -0,0 +1,84 @@
+/*
+ * @file sl_vector.h
+ * @brief 单向链表的顺序存储（连续数组）后端接口定义头文件
+ * @author ringtree
+ * @date 2025-09-27
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 由 SL_inifLinkVector() 创建的链表不再逐个分配节点，而是把数据存放在
+ * 可增长的连续数组中，headIndex / endIndex 恒为NULL，length 仍表示元素个数。
+ * data_struct.h 中的 SL_* 函数在函数入口检查 linkedList->vector 并转发到
+ * 本文件的 SV_* 函数，调用者无需区分两种后端。
+ *
+ * 数组前后都预留空位（data[start, start + length) 为有效数据），
+ * 尾部追加与头部插入、删除均摊O(1)，中间插入、删除为O(n)的 memmove。
+ *
+ * 本头文件只供 data_struct.c 使用，外部代码应通过 SL_* 函数访问。
+ */
+#pragma once
+#ifndef __SL_VECTOR_H__
+#define __SL_VECTOR_H__
+
+/* include ---------------------------------------------------- */
+#include "data_struct.h"
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 顺序存储后端的最小容量
+ */
+#define SV_MIN_CAPACITY 16
+
+/**
+ * @brief 顺序存储链表第一个元素的地址
+ */
+#define SV_DATA(link) ((link)->vector->data + (link)->vector->start)
+
+/**
+ * @defgroup 顺序存储后端
+ * @brief SL_link 的连续数组存储实现
+ * @{
+ */
+
+/**
+ * @brief 连续数组存储
+ */
+struct SL_vector {
+  Elemtype *data;  ///< 数组首地址
+  uint32 start;    ///< 第一个有效元素的下标
+  uint32 capacity; ///< 数组容量（元素个数）
+};
+
+SL_vector *SV_inifVector(const uint32 capacity);
+
+void SV_freeVector(SL_vector *vector);
+
+uint16 SV_insert(SL_link *const linkedList, const Elemtype inputData,
+                 const uint32 index);
+
+uint32 SV_appendArray(SL_link *const linkedList, const Elemtype *const array,
+                      const uint32 count);
+
+uint32 SV_count(SL_link *const linkedList, const Elemtype findData);
+
+uint32 SV_getIndex(SL_link *const linkedList, const Elemtype findData);
+
+Elemtype SV_deleteIndex(SL_link *const linkedList, const uint32 index);
+
+uint32 SV_deleteData(SL_link *const linkedList, const Elemtype targetData,
+                     const uint32 deleteCount);
+
+void SV_reverse(SL_link *const linkedList);
+
+void SV_sortInsertion(SL_link *const linkedList, enum sort way);
+
+void SV_sortMerge(SL_link *const linkedList, enum sort way);
+
+void SV_sortRadix(SL_link *const linkedList, enum sort way);
+
+void SV_clear(SL_link *const linkedList);
+
+/** @} */ // 顺序存储后端
+
+#endif /* !__SL_VECTOR_H__ */
@@ -0,0 +1,87 @@
+/*
+ * @file sl_writer.h
+ * @brief 单向链表缓冲文本输出接口定义头文件
+ * @author ringtree
+ * @date 2025-10-01
+ * @version 1.0
+ * @copyright Copyright (c) 2025 ringtree. All rights reserved.
+ *
+ * 把链表数据格式化为文本并写入缓冲区，缓冲区写满时一次性交给输出目标：
+ * - 内存：调用者提供的缓冲区，写满后停止并置 error；
+ * - FILE*：每次刷新调用一次 fwrite()；
+ * - 文件描述符：每次刷新调用 write()（处理部分写入与 EINTR）。
+ * 整数使用两位一组查表的快速转换，逐元素不分配内存、不调用 printf()。
+ *
+ * 输出格式（SW_format）：每个元素之后写 separator，每满 rowWidth 个元素
+ * 且后面还有元素时写 newline，全部元素之后再写一次 newline。
+ * 默认格式（format 传NULL）与 SL_traverseLink() 的输出相同："\t" 分隔、每行20个。
+ */
+#pragma once
+#ifndef __SL_WRITER_H__
+#define __SL_WRITER_H__
+
+/* include ---------------------------------------------------- */
+#include <stdio.h>
+
+#include "data_struct.h"
+#include "main.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief FILE* / 文件描述符输出的默认缓冲区大小（字节）
+ */
+#define SW_DEFAULT_CAPACITY (64u * 1024u)
+
+/**
+ * @brief 一个 Elemtype 格式化后的最大字符数（"-2147483648"）
+ */
+#define SW_MAX_DIGITS 11
+
+/**
+ * @defgroup 缓冲输出
+ * @brief 链表数据的快速文本序列化
+ * @{
+ */
+
+/**
+ * @brief 输出格式
+ */
+typedef struct SW_format {
+  const char *separator; ///< 每个元素之后写入的字符串
+  const char *newline;   ///< 每行结束时写入的字符串
+  uint32 rowWidth;       ///< 每行元素个数，0 表示不换行（只在末尾写 newline）
+} SW_format;
+
+/**
+ * @brief 缓冲输出器
+ */
+typedef struct SW_writer {
+  char *buffer;      ///< 缓冲区
+  uint32 capacity;   ///< 缓冲区大小（字节）
+  uint32 used;       ///< 缓冲区中尚未交给输出目标的字节数
+  FILE *file;        ///< FILE* 输出目标，为NULL时不使用
+  int fd;            ///< 文件描述符输出目标，小于0时不使用
+  uint16 ownBuffer;  ///< 缓冲区是否由输出器分配
+  uint16 error;      ///< 内存缓冲区已满或写入失败
+  uint64 written;    ///< 已交给输出目标的字节总数
+} SW_writer;
+
+SW_writer *SW_inifWriter(char *const buffer, const uint32 capacity);
+
+SW_writer *SW_inifWriterFile(FILE *const file, const uint32 capacity);
+
+SW_writer *SW_inifWriterFd(const int fd, const uint32 capacity);
+
+uint16 SW_flush(SW_writer *const writer);
+
+uint32 SW_writeArray(SW_writer *const writer, const Elemtype *const array,
+                     const uint32 count, const SW_format *format);
+
+uint32 SW_writeLink(SW_writer *const writer, SL_link *const linkedList,
+                    const SW_format *format);
+
+void SW_freeWriter(SW_writer *writer);
+
+/** @} */ // 缓冲输出
+
+#endif /* !__SL_WRITER_H__ */
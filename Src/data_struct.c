@@ -13,12 +13,43 @@
  *
  * 所有函数实现均遵循dataStruct.h头文件中声明的接口规范。
  */
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "data_struct.h"
+#include "sl_distinct.h"
+#include "sl_index.h"
+#include "sl_log.h"
+#include "sl_pool.h"
+#include "sl_stats.h"
+#include "sl_vector.h"
+#include "sl_writer.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 基数排序每轮处理的位数（32位键分3轮：11 + 11 + 10）
+ */
+#define SL_RADIX_BITS 11
+#define SL_RADIX_BUCKETS (1u << SL_RADIX_BITS)
+#define SL_RADIX_PASSES 3
+
+/**
+ * @brief 基数排序启用并行直方图统计的最小元素个数
+ */
+#ifndef SL_RADIX_PARALLEL_MIN
+#define SL_RADIX_PARALLEL_MIN (1u << 20)
+#endif
+
+/**
+ * @brief 基数排序并行直方图统计的线程数（设为1关闭并行）
+ */
+#ifndef SL_RADIX_THREADS
+#define SL_RADIX_THREADS 4
+#endif
 
 /**
  * @addtogroup 单向链表模块
@@ -44,13 +75,78 @@ inline SL_link *SL_inifLink(void) {
   SL_link *cur =
       (SL_link *)malloc(sizeof(SL_link)); // 动态内存分配 单向链表结构体
   if (!cur) {
-    printf("内存分配失败 可能内存不足");
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
     return NULL;
   }
 
   cur->headIndex = NULL; // 设置单向链表头节点
   cur->endIndex = NULL;  // 设置单向链表尾节点
   cur->length = 0;       // 初始化单向链表数量 0
+  cur->pool = NULL;      // 默认不使用节点池
+  cur->ownPool = 0;
+  cur->index = NULL;     // 默认不维护哈希索引
+  cur->version = 0;
+  cur->vector = NULL;    // 默认使用节点存储
+
+  return cur;
+}
+
+/**
+ * @brief 创建并初始化一个由节点池供给节点的单向链表
+ *
+ * 该函数创建一个新的空单向链表，其节点从节点池中分配、删除时归还节点池，
+ * 插入/删除不再逐个调用 malloc()/free()。
+ * - pool 为NULL：为链表创建私有节点池，释放节点时整池回收，代价O(块数)；
+ * - pool 非NULL：多个链表共享该节点池，节点池由调用者负责释放。
+ *
+ * @param pool 共享节点池指针，传入NULL时创建私有节点池
+ * @return SL_link* 返回指向新创建的单向链表结构的指针，若内存分配失败则返回NULL
+ * @note 共享节点池必须在所有使用它的链表释放之后再释放。
+ */
+SL_link *SL_inifLinkPool(SL_pool *const pool) {
+  SL_link *cur = SL_inifLink();
+  if (!cur)
+    return NULL;
+
+  if (pool) { // 共享节点池
+    cur->pool = pool;
+    return cur;
+  }
+
+  cur->pool = SL_inifPool(0); // 私有节点池
+  if (!cur->pool) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    free(cur);
+    return NULL;
+  }
+  cur->ownPool = 1;
+
+  return cur;
+}
+
+/**
+ * @brief 创建并初始化一个顺序存储（连续数组）的单向链表
+ *
+ * 数据存放在可增长的连续数组中，适合以尾部追加和整表扫描为主、
+ * 很少在中间插入的场景。SL_add、SL_insert、SL_delete*、SL_count、
+ * SL_reverse、SL_sort_* 等函数自动按顺序存储实现执行。
+ * 顺序存储没有节点，返回或接收 SL_node* 的函数（SL_find、SL_deleteNode 等）
+ * 经 SL_log() 报告错误并返回失败值；也不支持哈希索引与跳表索引。
+ *
+ * @param capacity 预留容量（元素个数），传入0时使用默认最小容量
+ * @return SL_link* 返回指向新创建的单向链表结构的指针，若内存分配失败则返回NULL
+ */
+SL_link *SL_inifLinkVector(const uint32 capacity) {
+  SL_link *cur = SL_inifLink();
+  if (!cur)
+    return NULL;
+
+  cur->vector = SV_inifVector(capacity);
+  if (!cur->vector) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    free(cur);
+    return NULL;
+  }
 
   return cur;
 }
@@ -61,22 +157,97 @@ inline SL_link *SL_inifLink(void) {
  * 该函数创建一个新的单向链表节点，将节点数据设置为inputData，
  * next指针初始化为NULL。
  *
+ * 若链表配置了节点池，则节点从节点池中分配，否则调用 malloc()。
+ * 若链表启用了哈希索引，同步记录新值。
+ *
+ * @param linkedList 节点所属的单向链表
  * @param inputData 要存储在节点中的数据
  * @return SL_node* 返回指向新创建的节点的指针，若内存分配失败则返回NULL
+ * @note 本函数不产生输出，供状态码接口使用。
  */
-static inline SL_node *SL_inifNode(const Elemtype inputData) {
-  SL_node *head = (SL_node *)malloc(sizeof(SL_node)); // 动态内存分配 节点结构体
-  if (!head) {
-    printf("内存分配失败 可能内存不足");
-    return NULL;
-  }
+static inline SL_node *SL_inifNode(SL_link *const linkedList,
+                                   const Elemtype inputData) {
+  SL_node *head =
+      linkedList->pool
+          ? SL_poolAlloc(linkedList->pool)
+          : (SL_node *)malloc(sizeof(SL_node)); // 动态内存分配 节点结构体
+  if (!head)
+    return NULL; // 由调用者报告或返回 SL_ERR_NO_MEMORY
 
   head->data = inputData;
   head->next = NULL;
+  linkedList->version++;
+  SL_STAT_ALLOC(1);
+  if (linkedList->index && !SL_indexAdd(linkedList->index, inputData))
+    SL_indexDisable(linkedList); // 索引无法扩容，退回逐节点遍历
 
   return head;
 }
 
+/**
+ * @brief 释放单向链表的一个节点
+ *
+ * 若链表配置了节点池，则节点归还节点池，否则调用 free()。
+ * 若链表启用了哈希索引，同步删除该节点的值。
+ *
+ * @param linkedList 节点所属的单向链表
+ * @param node 待释放的节点
+ */
+static inline void SL_freeNode(SL_link *const linkedList, SL_node *const node) {
+  if (linkedList->index)
+    SL_indexRemove(linkedList->index, node->data);
+  linkedList->version++;
+  SL_STAT_FREE(1);
+  if (linkedList->pool)
+    SL_poolRelease(linkedList->pool, node);
+  else
+    free(node);
+}
+
+/**
+ * @brief 检查链表是否为顺序存储
+ *
+ * 顺序存储没有节点，不支持返回或接收 SL_node* 的接口。
+ *
+ * @param linkedList 单向链表
+ * @return uint16 是顺序存储时经 SL_log() 报告错误并返回1，否则返回0
+ */
+static inline uint16 SL_rejectVector(const SL_link *const linkedList) {
+  if (linkedList && linkedList->vector) {
+    SL_log(SL_LOG_ERROR, "错误：顺序存储链表不支持节点指针接口");
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief 获取状态码的文字说明
+ *
+ * @param status 状态码
+ * @return const char* 说明文字（静态字符串），状态码无效时返回 "未知错误"
+ */
+const char *SL_statusString(const enum SL_status status) {
+  switch (status) {
+  case SL_OK:
+    return "成功";
+  case SL_ERR_NULL:
+    return "错误：传入的指针为NULL";
+  case SL_ERR_EMPTY:
+    return "错误：单向链表为空";
+  case SL_ERR_RANGE:
+    return "错误：索引越界";
+  case SL_ERR_NOT_FOUND:
+    return "错误：未找到目标数据或节点";
+  case SL_ERR_NO_MEMORY:
+    return "内存分配失败 可能内存不足";
+  case SL_ERR_UNSUPPORTED:
+    return "错误：顺序存储链表不支持节点指针接口";
+  case SL_ERR_CORRUPT:
+    return "错误：单向链表结构损坏";
+  }
+  return "未知错误";
+}
+
 /** @} */ // 单向链表初始化操作
 
 /**
@@ -85,6 +256,38 @@ static inline SL_node *SL_inifNode(const Elemtype inputData) {
  * @{
  */
 
+/**
+ * @brief 在单向链表头部插入一个新节点（状态码接口，不产生任何输出）
+ *
+ * @param linkedList 指向要操作的单向链表的指针
+ * @param inputData 要插入的新节点数据
+ * @return enum SL_status 成功返回 SL_OK；链表为NULL返回 SL_ERR_NULL；
+ *         内存分配失败返回 SL_ERR_NO_MEMORY
+ */
+enum SL_status SL_tryInsertHead(SL_link *const linkedList,
+                                const Elemtype inputData) {
+  SL_STAT_SCOPE(SL_OP_INSERT_HEAD);
+  if (linkedList == NULL)
+    return SL_ERR_NULL;
+  if (linkedList->vector)
+    return SV_insert(linkedList, inputData, 0) ? SL_OK : SL_ERR_NO_MEMORY;
+
+  SL_node *newNode = SL_inifNode(linkedList, inputData); // 调用inifNode()函数 创建新节点
+  if (!newNode)
+    return SL_ERR_NO_MEMORY;
+
+  // 节点连接更新
+  newNode->next = linkedList->headIndex;
+  linkedList->headIndex = newNode;
+  if (linkedList->endIndex == NULL) { // 空链表插入后新节点同时是尾节点
+    linkedList->endIndex = newNode;
+  }
+
+  // 单向链表长度更新
+  linkedList->length++;
+  return SL_OK;
+}
+
 /**
  * @brief 在单向链表头部插入一个新节点
  *
@@ -94,16 +297,46 @@ static inline SL_node *SL_inifNode(const Elemtype inputData) {
  * @param linkedList 指向要操作的单向链表的指针
  * @param inputData 要插入的新节点数据
  * @return void 无返回值
+ * @note 内存分配失败时经 SL_log() 报告错误，链表保持不变；
+ *       需要得知失败时使用 SL_tryInsertHead()。
  */
 void SL_insertHead(SL_link *const linkedList, const Elemtype inputData) {
-  SL_node *newNode = SL_inifNode(inputData); // 调用inifNode()函数 创建新节点
+  enum SL_status status = SL_tryInsertHead(linkedList, inputData);
+  if (status != SL_OK)
+    SL_log(SL_LOG_ERROR, "%s", SL_statusString(status));
+}
 
-  // 节点连接更新
-  newNode->next = linkedList->headIndex;
-  linkedList->headIndex = newNode;
+/**
+ * @brief 在单向链表尾部插入一个新节点（状态码接口，不产生任何输出）
+ *
+ * @param linkedList 指向要操作的单向链表的指针
+ * @param inputData 要插入的新节点数据
+ * @return enum SL_status 成功返回 SL_OK；链表为NULL返回 SL_ERR_NULL；
+ *         内存分配失败返回 SL_ERR_NO_MEMORY
+ */
+enum SL_status SL_tryAdd(SL_link *const linkedList, const Elemtype inputData) {
+  SL_STAT_SCOPE(SL_OP_ADD);
+  if (linkedList == NULL)
+    return SL_ERR_NULL;
+  if (linkedList->vector) {
+    return SV_insert(linkedList, inputData, linkedList->length)
+               ? SL_OK
+               : SL_ERR_NO_MEMORY;
+  }
+  if (linkedList->headIndex == NULL)
+    return SL_tryInsertHead(linkedList, inputData);
+
+  SL_node *newNode = SL_inifNode(linkedList, inputData); // 调用inifNode()函数 创建新节点
+  if (!newNode)
+    return SL_ERR_NO_MEMORY;
+
+  // 节点连接更新（尾指针直接定位尾节点）
+  linkedList->endIndex->next = newNode;
+  linkedList->endIndex = newNode;
 
   // 单向链表长度更新
   linkedList->length++;
+  return SL_OK;
 }
 
 /**
@@ -116,26 +349,13 @@ void SL_insertHead(SL_link *const linkedList, const Elemtype inputData) {
  * @param linkedList 指向要操作的单向链表的指针
  * @param inputData 要插入的新节点数据
  * @return void 无返回值
- * @note 该函数实现中存在一个潜在问题：当单向链表为空时（headIndex为NULL），
- *       直接访问temNode->next会导致空指针解引用错误。
+ * @note 直接通过尾指针 endIndex 连接新节点，时间复杂度O(1)，
+ *       要求所有修改操作都正确维护 endIndex。
  */
 void SL_add(SL_link *const linkedList, const Elemtype inputData) {
-  if (linkedList->headIndex == NULL) {
-    SL_insertHead(linkedList, inputData);
-  } else {
-    SL_node *newNode = SL_inifNode(inputData); // 调用inifNode()函数 创建新节点
-    SL_node *temNode = linkedList->headIndex;  // 创建临时节点代替单向链表头节点
-
-    // 节点连接更新
-    linkedList->endIndex = newNode;
-    while (temNode->next) { // 遍历寻找尾节点上一节点（单单向链表缺点）
-      temNode = temNode->next;
-    }
-    temNode->next = newNode;
-
-    // 单向链表长度更新
-    linkedList->length++;
-  }
+  enum SL_status status = SL_tryAdd(linkedList, inputData);
+  if (status != SL_OK)
+    SL_log(SL_LOG_ERROR, "%s", SL_statusString(status));
 }
 
 /**
@@ -149,15 +369,14 @@ void SL_add(SL_link *const linkedList, const Elemtype inputData) {
  * @param count 插入的节点数量
  * @param ... 可变参数列表，包含要插入的节点的数据（int32类型）
  * @return void 无返回值
- * @note 该函数在每次调用add函数后会手动增加单向链表长度，
- *       但add函数内部已经更新了长度，这可能导致长度被重复增加。
+ * @note 每个数据的插入代价为O(1)，总代价为O(count)。
  */
 void SL_extind(SL_link *const linkedList, const uint32 count, ...) {
   va_list args;          // 创建可变参数列表容器
   va_start(args, count); // 初始化可变参数列表
 
   // 循环插入数据
-  for (uint16 i = 0; i < count; i++) {
+  for (uint32 i = 0; i < count; i++) {
     int32 data = va_arg(args, int32); // 获取可变参数列表中的下一个参数
     SL_add(linkedList, data);         // 调用add()函数 添加数据
   }
@@ -165,45 +384,220 @@ void SL_extind(SL_link *const linkedList, const uint32 count, ...) {
   va_end(args); // 结束可变参数列表
 }
 
+/**
+ * @brief 在单向链表的指定位置插入新节点（状态码接口，不产生任何输出）
+ *
+ * @param linkedList 指向单向链表结构的指针
+ * @param inputData 要插入的数据
+ * @param index 插入位置的索引（从0开始计数），与 SL_insert() 相同，
+ *              非0时必须小于链表长度
+ * @return enum SL_status 成功返回 SL_OK；链表为NULL返回 SL_ERR_NULL；
+ *         索引越界返回 SL_ERR_RANGE；内存分配失败返回 SL_ERR_NO_MEMORY
+ */
+enum SL_status SL_tryInsert(SL_link *const linkedList, const Elemtype inputData,
+                            const uint32 index) {
+  SL_STAT_SCOPE(SL_OP_INSERT);
+  if (linkedList == NULL)
+    return SL_ERR_NULL;
+  if (!index) // 如果索引值为0 则插入头部
+    return SL_tryInsertHead(linkedList, inputData);
+  if (index >= linkedList->length) // 如果索引值大于单向链表长度 则返回错误
+    return SL_ERR_RANGE;
+
+  if (linkedList->vector)
+    return SV_insert(linkedList, inputData, index) ? SL_OK : SL_ERR_NO_MEMORY;
+
+  SL_node *newNode = SL_inifNode(linkedList, inputData); // 调用inifNode()函数 创建新节点
+  if (!newNode)
+    return SL_ERR_NO_MEMORY;
+  SL_node *cur = linkedList->headIndex;      // 定义指针cur指向单向链表头节点
+
+  // 循环找到索引位置的前一个节点
+  for (uint32 i = 0; i < index - 1; i++) {
+    cur = cur->next;
+  }
+  SL_STAT_NODES(index);
+
+  // 节点连接更新
+  newNode->next = cur->next;
+  cur->next = newNode;
+
+  // 更新单向链表长度
+  linkedList->length++;
+  return SL_OK;
+}
+
 /**
  * @brief 在单向链表的指定位置插入新节点
  *
  * 该函数创建一个新的节点，将其插入到单向链表的指定位置，
  * 并更新单向链表的相关属性（尾指针和长度）。
  * 如果索引为0，则调用insertHead函数在头部插入；
- * 如果索引大于等于单向链表长度，则打印错误信息并返回。
+ * 如果索引大于等于单向链表长度，则经 SL_log() 报告错误并返回。
  *
  * @param linkedList 指向单向链表结构的指针
  * @param inputData 要插入的数据
  * @param index 插入位置的索引（从0开始计数）
  * @return void 无返回值
- * @note 当索引值大于等于单向链表长度时，函数仅打印错误信息而不执行插入操作
+ * @note 当索引值大于等于单向链表长度时，函数仅经 SL_log() 报告错误而不执行插入操作
  */
 void SL_insert(SL_link *const linkedList, const Elemtype inputData,
                const uint32 index) {
-  if (!index) { // 如果索引值为0 则插入头部
-    SL_insertHead(linkedList, inputData);
-    return;
-  } else if (index >=
-             linkedList->length) { // 如果索引值大于单向链表长度 则返回错误
-    printf("Error: Index out of range\n");
-    return;
-  }
+  enum SL_status status = SL_tryInsert(linkedList, inputData, index);
+  if (status == SL_ERR_RANGE)
+    SL_log(SL_LOG_ERROR, "Error: Index out of range");
+  else if (status != SL_OK)
+    SL_log(SL_LOG_ERROR, "%s", SL_statusString(status));
+}
 
-  SL_node *newNode = SL_inifNode(inputData); // 调用inifNode()函数 创建新节点
-  SL_node *cur = linkedList->headIndex;      // 定义指针cur指向单向链表头节点
+/**
+ * @brief 在指定节点之后插入新节点
+ *
+ * 已持有前驱节点时插入只需O(1)，供跳表索引等在链表之上维护
+ * 额外结构的模块使用。
+ *
+ * @param linkedList 单向链表指针
+ * @param prev 前驱节点，为NULL时插入到头部
+ * @param inputData 要插入的数据
+ * @return SL_node* 新节点，内存分配失败返回NULL
+ * @warning prev 必须是该单向链表中的有效节点。
+ */
+SL_node *SL_insertAfter(SL_link *const linkedList, SL_node *const prev,
+                        const Elemtype inputData) {
+  SL_STAT_SCOPE(SL_OP_INSERT_AFTER);
+  if (SL_rejectVector(linkedList))
+    return NULL;
 
-  // 循环找到索引位置的前一个节点
-  for (uint32 i = 0; i < index - 1; i++) {
-    cur = cur->next;
+  SL_node *newNode = SL_inifNode(linkedList, inputData);
+  if (!newNode) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
   }
 
-  // 节点连接更新
-  newNode->next = cur->next;
-  cur->next = newNode;
+  if (prev == NULL) {
+    newNode->next = linkedList->headIndex;
+    linkedList->headIndex = newNode;
+  } else {
+    newNode->next = prev->next;
+    prev->next = newNode;
+  }
+  if (newNode->next == NULL) // 插入到末尾时同步尾指针
+    linkedList->endIndex = newNode;
 
-  // 更新单向链表长度
   linkedList->length++;
+  return newNode;
+}
+
+/**
+ * @brief 由数组一次性构建单向链表
+ *
+ * 该函数创建一个带私有节点池的新链表，所有节点在同一块连续内存中分配，
+ * 并按数组顺序一次遍历完成连接。
+ *
+ * @param array 源数据数组
+ * @param count 数组元素个数
+ * @return SL_link* 新链表指针，内存分配失败返回NULL
+ * @note 返回的链表需使用 SL_freeLinks() 释放。
+ */
+SL_link *SL_fromArray(const Elemtype *const array, const uint32 count) {
+  SL_link *linkedList = SL_inifLinkPool(NULL);
+  if (!linkedList)
+    return NULL;
+
+  if (count && SL_appendArray(linkedList, array, count) != count) {
+    SL_freeLinks(linkedList);
+    return NULL;
+  }
+
+  return linkedList;
+}
+
+/**
+ * @brief 将数组中的数据批量追加到单向链表尾部
+ *
+ * 该函数按数组顺序把数据追加到链表尾部，只遍历一次数组：
+ * - 链表使用节点池时，所有新节点在一段连续内存中分配；
+ * - 链表未使用节点池且为空时，先为其创建私有节点池，再按上一条处理；
+ * - 链表未使用节点池且非空时，逐个 malloc() 节点，每个节点代价O(1)。
+ *
+ * @param linkedList 单向链表指针
+ * @param array 源数据数组
+ * @param count 数组元素个数
+ * @return uint32 实际追加的元素个数，内存分配失败时为0
+ */
+uint32 SL_appendArray(SL_link *const linkedList, const Elemtype *const array,
+                      const uint32 count) {
+  SL_STAT_SCOPE(SL_OP_APPEND_ARRAY);
+  if (linkedList == NULL || array == NULL || count == 0)
+    return 0;
+  if (linkedList->vector) {
+    uint32 appended = SV_appendArray(linkedList, array, count);
+    if (!appended)
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return appended;
+  }
+
+  // 空的 malloc 模式链表改为私有节点池，以便连续分配
+  if (!linkedList->pool && linkedList->length == 0) {
+    linkedList->pool = SL_inifPool(0);
+    if (!linkedList->pool) {
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+      return 0;
+    }
+    linkedList->ownPool = 1;
+  }
+
+  SL_node *first = NULL;
+  SL_node *last = NULL;
+
+  if (linkedList->pool) { // 连续分配并一次连接
+    first = SL_poolAllocBlock(linkedList->pool, count);
+    if (!first) {
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+      return 0;
+    }
+    SL_STAT_ALLOC(count);
+    for (uint32 i = 0; i < count - 1; i++) {
+      first[i].data = array[i];
+      first[i].next = &first[i + 1];
+    }
+    last = &first[count - 1];
+    last->data = array[count - 1];
+    last->next = NULL;
+    for (uint32 i = 0; i < count && linkedList->index; i++) {
+      if (!SL_indexAdd(linkedList->index, array[i]))
+        SL_indexDisable(linkedList); // 索引无法扩容，退回逐节点遍历
+    }
+  } else { // 逐个分配，先在局部串好再整体挂接
+    SL_node head = {0, NULL};
+    last = &head;
+    for (uint32 i = 0; i < count; i++) {
+      SL_node *node = SL_inifNode(linkedList, array[i]);
+      if (!node) {
+        // 释放已分配的节点，保持链表不变
+        for (SL_node *cur = head.next, *next = NULL; cur; cur = next) {
+          next = cur->next;
+          SL_freeNode(linkedList, cur);
+        }
+        SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+        return 0;
+      }
+      last->next = node;
+      last = node;
+    }
+    first = head.next;
+  }
+
+  // 挂接到链表尾部
+  if (linkedList->endIndex)
+    linkedList->endIndex->next = first;
+  else
+    linkedList->headIndex = first;
+  linkedList->endIndex = last;
+  linkedList->length += count;
+  linkedList->version++;
+
+  return count;
 }
 
 /** @} */ // 单向链表插入操作
@@ -223,11 +617,19 @@ void SL_insert(SL_link *const linkedList, const Elemtype inputData,
  * @param linkedList 单向链表结构体指针
  * @param findData 要查找的数据
  * @return uint32 返回数据在单向链表中出现的次数
+ * @note 启用哈希索引时时间复杂度为O(1)。
  */
 uint32 SL_count(SL_link *const linkedList, const Elemtype findData) {
+  SL_STAT_SCOPE(SL_OP_COUNT);
   if (linkedList == NULL) {
     return 0;
   }
+  if (linkedList->index) { // 哈希索引直接给出次数
+    return SL_indexCount(linkedList->index, findData);
+  }
+  if (linkedList->vector) {
+    return SV_count(linkedList, findData);
+  }
   SL_node *cur = linkedList->headIndex; // 定义指针cur指向单向链表头节点
   uint32 count = 0;                     // 定义变量count记录找到的节点数量
 
@@ -237,6 +639,7 @@ uint32 SL_count(SL_link *const linkedList, const Elemtype findData) {
       count++;
     cur = cur->next;
   }
+  SL_STAT_NODES(linkedList->length);
 
   return count;
 }
@@ -244,45 +647,143 @@ uint32 SL_count(SL_link *const linkedList, const Elemtype findData) {
 /**
  * @brief 在单向链表中查找所有匹配数据的节点指针，并返回数组
  *
- * 该函数从单向链表头开始遍历，收集所有数据与指定值相等的节点指针，
- * 最终返回动态分配的指针数组（需由调用者释放）。
- * 函数首先调用count函数统计匹配节点数量，然后分配对应大小的内存，
- * 最后再次遍历单向链表收集所有匹配节点的指针。
+ * 该函数从单向链表头开始遍历一次，把所有数据与指定值相等的节点指针
+ * 收集到动态增长的数组中，最终返回该数组（需由调用者释放）。
+ * 启用哈希索引时按匹配数一次分配到位，并在找齐后提前结束遍历。
  *
  * @param linkedList 单向链表结构体指针
  * @param findData 要查找的目标数据
- * @param outCount 输出参数，用于返回匹配的节点数量（若未找到则为0）
- * @return SL_node** 指向匹配节点指针数组的指针（未找到时返回NULL）
+ * @param outCount 输出参数，用于返回匹配的节点数量（若未找到则为0），
+ *                 调用前无需赋值
+ * @return SL_node** 指向匹配节点指针数组的指针（未找到或内存分配失败时返回NULL）
  * @note 调用者需使用 free() 释放返回的数组以避免内存泄漏
- * @warning 代码中存在同名但不同签名的find函数，这在C语言中是不允许的，
- *          可能会导致编译错误或运行时问题
  */
 SL_node **SL_find(SL_link *const linkedList, const Elemtype findData,
                   uint32 *outCount) {
-  // 统计匹配的节点数量
-  *outCount = SL_count(linkedList, findData);
-  if (*outCount == 0) {
-    return NULL; // 无匹配节点，返回 NULL
+  SL_STAT_SCOPE(SL_OP_FIND);
+  *outCount = 0;
+  if (linkedList == NULL || SL_rejectVector(linkedList)) {
+    return NULL;
+  }
+
+  uint32 capacity = 16; // 初始容量，不足时翻倍，但不超过链表长度
+  uint32 remaining = UINT32_MAX;
+  if (linkedList->index) { // 哈希索引给出精确数量
+    remaining = SL_indexCount(linkedList->index, findData);
+    if (remaining == 0) {
+      return NULL;
+    }
+    capacity = remaining;
   }
 
-  SL_node **nodeList = (SL_node **)malloc(
-      sizeof(SL_node *) * (*outCount)); // 动态分配内存存储所有匹配节点的指针
-  SL_node *cur = linkedList->headIndex; // 遍历单向链表，收集所有匹配的节点指针
+  SL_node **nodeList = NULL;
+  uint32 count = 0;
 
   // 遍历单向链表，收集所有匹配的节点指针
-  for (uint32 i = 0; i < *outCount; i++) {
-    for (; cur != NULL; cur = cur->next) {
-      if (cur->data == findData) {
-        nodeList[i] = cur;
-        cur = cur->next; // 移动到下一个节点
-        break;
+  for (SL_node *cur = linkedList->headIndex; cur && count < remaining;
+       cur = cur->next) {
+    SL_STAT_NODES(1);
+    if (cur->data != findData) {
+      continue;
+    }
+    if (nodeList == NULL || count == capacity) { // 扩容
+      if (nodeList) { // 匹配数不超过链表长度，翻倍前截断以防 uint32 溢出
+        capacity = capacity > linkedList->length / 2 ? linkedList->length
+                                                     : capacity * 2;
       }
+      SL_node **grown = (SL_node **)realloc(
+          nodeList, sizeof(SL_node *) * (size_t)capacity);
+      if (!grown) {
+        SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+        free(nodeList);
+        return NULL;
+      }
+      nodeList = grown;
     }
+    nodeList[count++] = cur;
   }
 
+  *outCount = count;
   return nodeList;
 }
 
+/**
+ * @brief 在单向链表中查找所有匹配数据的节点，写入调用者提供的数组
+ *
+ * 该函数只遍历一次链表，不分配任何内存。最多写入 capacity 个节点指针，
+ * 返回值为匹配节点总数；返回值大于 capacity 表示数组容量不足（溢出），
+ * 此时数组中是前 capacity 个匹配节点。
+ *
+ * @param linkedList 单向链表结构体指针
+ * @param findData 要查找的目标数据
+ * @param outNodes 输出数组，由调用者分配（capacity 为0时可为NULL）
+ * @param capacity 输出数组容量
+ * @return uint32 匹配节点总数
+ */
+uint32 SL_findInto(SL_link *const linkedList, const Elemtype findData,
+                   SL_node **const outNodes, const uint32 capacity) {
+  SL_STAT_SCOPE(SL_OP_FIND);
+  if (linkedList == NULL || SL_rejectVector(linkedList)) {
+    return 0;
+  }
+
+  uint32 remaining = linkedList->index
+                         ? SL_indexCount(linkedList->index, findData)
+                         : UINT32_MAX;
+  uint32 count = 0;
+
+  for (SL_node *cur = linkedList->headIndex; cur && count < remaining;
+       cur = cur->next) {
+    SL_STAT_NODES(1);
+    if (cur->data == findData) {
+      if (count < capacity) {
+        outNodes[count] = cur;
+      }
+      count++;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * @brief 对单向链表中每个匹配数据的节点调用回调函数
+ *
+ * 该函数只遍历一次链表，不分配任何内存。回调返回非0时立即停止遍历。
+ *
+ * @param linkedList 单向链表结构体指针
+ * @param findData 要查找的目标数据
+ * @param visit 回调函数，参数为匹配节点、节点索引和用户上下文
+ * @param context 透传给回调函数的用户上下文
+ * @return uint32 已调用回调的次数
+ */
+uint32 SL_forEachMatch(SL_link *const linkedList, const Elemtype findData,
+                       SL_visitFn visit, void *const context) {
+  SL_STAT_SCOPE(SL_OP_FIND);
+  if (linkedList == NULL || visit == NULL || SL_rejectVector(linkedList)) {
+    return 0;
+  }
+
+  uint32 remaining = linkedList->index
+                         ? SL_indexCount(linkedList->index, findData)
+                         : UINT32_MAX;
+  uint32 count = 0;
+  uint32 index = 0;
+
+  for (SL_node *cur = linkedList->headIndex; cur && count < remaining;
+       cur = cur->next, index++) {
+    SL_STAT_NODES(1);
+    if (cur->data == findData) {
+      count++;
+      if (visit(cur, index, context)) {
+        break;
+      }
+    }
+  }
+
+  return count;
+}
+
 /**
  * @brief 在单向链表中查找指定数据并返回第一个匹配节点的索引
  *
@@ -293,128 +794,286 @@ SL_node **SL_find(SL_link *const linkedList, const Elemtype findData,
  * @param linkedList 单向链表结构体指针
  * @param findData 要查找的目标数据
  * @return uint32 返回找到的节点的索引（从0开始计数），未找到则返回UINT32_MAX
- * @note 函数返回UINT32_MAX表示未找到匹配节点，需包含<stdint.h>头文件
+ * @note 函数返回UINT32_MAX表示未找到匹配节点，需包含<stdint.h>头文件；
+ *       启用哈希索引时，值不存在的情况O(1)返回。
  */
 uint32 SL_getIndex(SL_link *const linkedList, const Elemtype findData) {
-  if (linkedList == NULL) {
-    printf("Error: linkedList is NULL\n");
-    return UINT32_MAX;
+  uint32 index = UINT32_MAX;
+  if (SL_tryGetIndex(linkedList, findData, &index) == SL_ERR_NULL)
+    SL_log(SL_LOG_ERROR, "Error: linkedList is NULL");
+  return index;
+}
+
+/**
+ * @brief 查找指定数据第一个匹配节点的索引（状态码接口，不产生任何输出）
+ *
+ * @param linkedList 单向链表结构体指针
+ * @param findData 要查找的目标数据
+ * @param outIndex 输出参数，匹配节点的索引（从0开始）；未找到时置为UINT32_MAX
+ * @return enum SL_status 找到返回 SL_OK；链表或 outIndex 为NULL返回
+ *         SL_ERR_NULL；未找到返回 SL_ERR_NOT_FOUND
+ */
+enum SL_status SL_tryGetIndex(SL_link *const linkedList,
+                              const Elemtype findData, uint32 *const outIndex) {
+  SL_STAT_SCOPE(SL_OP_GET_INDEX);
+  if (linkedList == NULL || outIndex == NULL)
+    return SL_ERR_NULL;
+  *outIndex = UINT32_MAX;
+  if (linkedList->index && !SL_indexCount(linkedList->index, findData)) {
+    return SL_ERR_NOT_FOUND; // 哈希索引确认不存在
+  }
+  if (linkedList->vector) {
+    *outIndex = SV_getIndex(linkedList, findData);
+    return *outIndex == UINT32_MAX ? SL_ERR_NOT_FOUND : SL_OK;
   }
   SL_node *cur = linkedList->headIndex;
   uint32 index = 0;
   while (cur) {
-    if (cur->data == findData)
-      return index;
+    SL_STAT_NODES(1);
+    if (cur->data == findData) {
+      *outIndex = index;
+      return SL_OK;
+    }
     cur = cur->next;
     index++;
   }
-  return UINT32_MAX;
+  return SL_ERR_NOT_FOUND;
 }
 
 /**
  * @brief 获取链表中绝对值的集合
  *
- * 对链表中节点数据的绝对值进行去重处理，并将去重后的结果按降序排列输出。
- * 同时创建一个新链表保存去重后的绝对值。
+ * 对链表中节点数据的绝对值去重，按第一次出现的顺序打印结果。
+ * 去重由 SL_distinct() 完成，额外内存为O(n)，与取值范围无关。
  *
  * @param linked 链表
+ * @return void* 固定返回NULL；需要保留结果时请直接调用 SL_distinct()
  */
 void *SL_get_set(SL_link *const linked) {
   // 检查链表是否为空
-  if (linked == NULL || linked->headIndex == NULL) {
-    printf("警告：传入的链表为空\n");
+  if (linked == NULL || linked->length == 0) {
+    SL_log(SL_LOG_WARN, "警告：传入的链表为空");
     return NULL;
   }
 
-  SL_node *temNode = linked->headIndex;
-  Elemtype max = abs(temNode->data);
-  Elemtype min = abs(temNode->data);
+  SL_link *outLint = SL_distinct(linked, DISTINCT_ABS);
+  if (outLint == NULL) {
+    SL_log(SL_LOG_ERROR, "创建链表失败");
+    return NULL;
+  }
+
+  SL_traverseLink(outLint);
+  SL_freeLinks(outLint);
 
-  // 找出链表中绝对值的最大值和最小值
-  for (; temNode; temNode = temNode->next) {
-    Elemtype absVal = abs(temNode->data);
-    max = (max < absVal) ? absVal : max;
-    min = (min > absVal) ? absVal : min;
+  return NULL;
+}
+
+/**
+ * @brief 求解约瑟夫环问题：在一个循环链表中，从头部开始，每数到第 n
+ * 个节点就删除该节点， 直到链表中只剩下一个节点，返回该剩余节点的数据。
+ *
+ * 单向链表模拟循环链表：报数时同步维护前驱节点（头节点的前驱视为尾节点），
+ * 数到第 n 个节点后用 SL_deleteAfter() 以O(1)删除，不再回到表头查找前驱；
+ * 每轮的报数步数按当前长度取模。
+ *
+ * @param link 单向链表指针，结束时链表中只剩下幸存节点
+ * @param n    每数到第 n 个节点时，删除该节点。n 必须 >= 1。
+ *
+ * @return uint32 最后剩下的那个节点的数据值（data）；链表为空或 n 为0时返回
+ * UINT32_MAX。
+ *
+ * @note 时间复杂度O(m * min(n, m))，其中 m 为初始节点个数，
+ *       n 为常数时即为O(m)。只需要幸存者时可使用不修改链表的
+ *       SL_josephusPeek()，需要完整出列顺序时使用 SL_josephusOrder()。
+ */
+uint32 SL_josephusSurvivor(SL_link *const link, uint32 n) {
+  SL_STAT_SCOPE(SL_OP_JOSEPHUS);
+  if (link == NULL || link->length == 0 || n == 0) {
+    SL_log(SL_LOG_ERROR, "错误：链表为空或报数间隔为0");
+    return UINT32_MAX;
   }
 
-  // 分配适当大小的数组
-  Elemtype *list = (Elemtype *)malloc(sizeof(Elemtype) * (max - min + 1));
-  if (list == NULL) {
-    printf("内存分配失败\n");
-    return NULL;
+  if (link->vector) { // 顺序存储：直接计算被删除元素的下标
+    uint32 pos = 0;
+    while (link->length > 1) {
+      pos = (uint32)((pos + (uint64)n - 1) % link->length);
+      SV_deleteIndex(link, pos);
+      if (pos == link->length)
+        pos = 0;
+    }
+    return SV_DATA(link)[0];
   }
 
-  // 初始化数组，注意循环范围
-  for (int i = 0; i < (max - min + 1); i++) {
-    list[i] = 0;
+  SL_node *prev = link->endIndex; // 待报数节点的前驱（循环意义下）
+  while (link->length > 1) {
+    SL_STAT_NODES((n - 1) % link->length);
+    for (uint32 steps = (n - 1) % link->length; steps; steps--)
+      prev = prev->next ? prev->next : link->headIndex;
+
+    // 前驱为尾节点时被删除的是头节点
+    SL_deleteAfter(link, prev == link->endIndex ? NULL : prev);
   }
 
-  // 去重并创建新链表
-  temNode = linked->headIndex;
-  SL_link *outLint = SL_inifLink();
-  if (outLint == NULL) {
-    free(list);
-    printf("创建链表失败\n");
-    return NULL;
+  return link->headIndex->data;
+}
+
+/**
+ * @brief 计算约瑟夫环幸存者的下标（不需要链表）
+ *
+ * 对 count 个人从下标0开始报数、每数到第 n 个出列，返回最后幸存者的下标：
+ * - 一般情况使用递推 J(1) = 0，J(m) = (J(m - 1) + n) % m，时间O(count)；
+ * - n 远小于 count 时每轮一次性跳过 m / n 个出列者，
+ *   时间与额外空间均为O(n log count)。
+ *
+ * @param count 总人数（链表长度）
+ * @param n 报数间隔，必须 >= 1
+ * @return uint32 幸存者下标（从0开始）；参数无效或内存分配失败时返回UINT32_MAX
+ */
+uint32 SL_josephusIndex(const uint32 count, const uint32 n) {
+  if (count == 0 || n == 0) {
+    SL_log(SL_LOG_ERROR, "错误：人数或报数间隔为0");
+    return UINT32_MAX;
+  }
+  if (n == 1)
+    return count - 1;
+
+  uint32 depth = 0; // 成批跳过的轮数上界约为 n * ln(count)
+  for (uint32 m = count; m; m >>= 1)
+    depth++;
+  if ((uint64)n * depth * 2 >= count) { // 线性递推更快
+    uint32 pos = 0;
+    for (uint32 m = 2; m <= count; m++)
+      pos = (uint32)((pos + (uint64)n) % m);
+    return pos;
   }
 
-  for (; temNode; temNode = temNode->next) {
-    Elemtype absVal = abs(temNode->data);
-    // 计算索引时确保在有效范围内
-    size_t index = absVal - min;
-    if (index < (max - min + 1) && !list[index]) {
-      list[index] = 1;
-      SL_add(outLint, absVal);
+  // 自顶向下记录每轮的人数，直到人数小于 n
+  uint32 capacity = 64;
+  uint32 *sizes = (uint32 *)malloc(sizeof(uint32) * capacity);
+  if (!sizes) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return UINT32_MAX;
+  }
+  uint32 levels = 0;
+  uint32 m = count;
+  while (m >= n) {
+    if (levels == capacity) {
+      capacity *= 2;
+      uint32 *grown = (uint32 *)realloc(sizes, sizeof(uint32) * capacity);
+      if (!grown) {
+        SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+        free(sizes);
+        return UINT32_MAX;
+      }
+      sizes = grown;
     }
+    sizes[levels++] = m;
+    m -= m / n; // 一轮走完整圈，出列 m / n 人
   }
 
-  // 排序并遍历输出结果
-  SL_traverseLink(outLint);
+  uint32 pos = 0; // 人数小于 n 时线性递推
+  for (uint32 k = 2; k <= m; k++)
+    pos = (uint32)((pos + (uint64)n) % k);
 
-  // 释放资源
-  free(list);
-  SL_freeLinks(outLint);
+  // 自底向上把下标映射回上一轮：跳过的出列者位于每 n 个中的最后一个
+  while (levels) {
+    m = sizes[--levels];
+    uint32 rest = m % n;
+    if (pos < rest) {
+      pos = m - rest + pos;
+    } else {
+      pos -= rest;
+      pos += pos / (n - 1);
+    }
+  }
 
-  return NULL;
+  free(sizes);
+  return pos;
 }
 
 /**
- * @brief 求解约瑟夫环问题：在一个循环链表中，从头部开始，每数到第 n
- * 个节点就删除该节点， 直到链表中只剩下一个节点，返回该剩余节点的数据。
+ * @brief 求约瑟夫环幸存者的数据，不修改链表
  *
- * @param link
- * 指向循环链表结构的常量指针，包含头节点指针、尾节点指针和链表长度等信息。
- *             假设该结构中至少包含以下成员：
- *             - SL_node* headIndex;  // 指向链表第一个节点
- *             - SL_node* endIndex;   // 指向链表最后一个节点
- *             - uint32 length;       // 链表当前节点总数
- *             并且存在一个外部函数 SL_deleteNode(link, node) 用于删除指定节点。
- * @param n    每数到第 n 个节点时，删除该节点。n 必须 >= 1。
+ * 由 SL_josephusIndex() 算出下标后直接读取对应数据，
+ * 结果与 SL_josephusSurvivor() 相同。
+ *
+ * @param link 单向链表指针
+ * @param n 报数间隔，必须 >= 1
+ * @return uint32 幸存者的数据；链表为空或 n 为0时返回UINT32_MAX
+ */
+uint32 SL_josephusPeek(SL_link *const link, const uint32 n) {
+  SL_STAT_SCOPE(SL_OP_JOSEPHUS);
+  if (link == NULL || link->length == 0) {
+    SL_log(SL_LOG_ERROR, "错误：链表为空");
+    return UINT32_MAX;
+  }
+
+  uint32 index = SL_josephusIndex(link->length, n);
+  if (index == UINT32_MAX)
+    return UINT32_MAX;
+  if (link->vector)
+    return SV_DATA(link)[index];
+
+  SL_node *cur = link->headIndex;
+  for (uint32 i = 0; i < index; i++)
+    cur = cur->next;
+  SL_STAT_NODES(index);
+  return cur->data;
+}
+
+/**
+ * @brief 计算约瑟夫环的完整出列顺序（不需要链表）
  *
- * @return uint32 最后剩下的那个节点的数据值（data）。
+ * 用树状数组记录每个下标是否仍在环中，按名次查找第 k 个在环者只需
+ * O(log count)，总时间O(count log count)，与 n 无关。
  *
- * @note 该函数会不断删除链表中的节点，直到链表中只剩一个节点，时间复杂度为
- * O(m*n)，其中 m 为初始节点个数。 假设链表是循环的，且 SL_deleteNode
- * 函数能正确处理节点删除和链表结构更新。
+ * @param count 总人数（链表长度）
+ * @param n 报数间隔，必须 >= 1
+ * @param outOrder 输出数组，至少 count 个元素，依次写入出列者的原始下标，
+ *                 最后一个元素即幸存者
+ * @return uint32 写入的元素个数；参数无效或内存分配失败时返回0
  */
-uint32 SL_josephusSurvivor(SL_link *const link, uint32 n) {
-  uint32 counter = 1;                 // 计数器
-  SL_node *temNode = link->headIndex; // 临时节点
-  SL_node *delNode = NULL;            // 待删除节点
-
-  for (; link->length != 1; counter++) { // 循环直到链表中剩一个节点
-    if (counter == n) {
-      delNode = temNode;
-      temNode = (temNode == link->endIndex)
-                    ? link->headIndex
-                    : temNode->next; // 单向链表模拟循环链表
-      SL_deleteNode(link, delNode);
-      counter = 0; // 重置计数器
-    } else
-      temNode = (temNode == link->endIndex) ? link->headIndex : temNode->next;
-  }
-
-  return temNode->data;
+uint32 SL_josephusOrder(const uint32 count, const uint32 n,
+                        uint32 *const outOrder) {
+  if (count == 0 || n == 0 || outOrder == NULL) {
+    SL_log(SL_LOG_ERROR, "错误：人数或报数间隔为0");
+    return 0;
+  }
+
+  uint32 *tree = (uint32 *)malloc(sizeof(uint32) * ((size_t)count + 1));
+  if (!tree) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return 0;
+  }
+  for (uint32 i = 1; i <= count; i++) // 全1数组的树状数组：tree[i] = lowbit(i)
+    tree[i] = i & (0u - i);
+
+  uint32 top = 1; // 不超过 count 的最大2的幂
+  while (top <= count / 2)
+    top <<= 1;
+
+  uint32 pos = 0; // 下一次从第 pos 个在环者开始报数（从0开始）
+  for (uint32 m = count; m; m--) {
+    pos = (uint32)((pos + (uint64)n - 1) % m);
+
+    // 二分倍增查找第 pos + 1 个在环者
+    uint32 idx = 0;
+    uint32 rank = pos + 1;
+    for (uint32 step = top; step; step >>= 1) {
+      if (idx + step <= count && tree[idx + step] < rank) {
+        idx += step;
+        rank -= tree[idx];
+      }
+    }
+    idx++; // 树状数组下标从1开始
+
+    outOrder[count - m] = idx - 1;
+    for (uint32 i = idx; i <= count; i += i & (0u - i))
+      tree[i]--;
+  }
+
+  free(tree);
+  return count;
 }
 
 /** @} */ // 单向链表查找操作
@@ -448,6 +1107,11 @@ uint32 SL_josephusSurvivor(SL_link *const link, uint32 n) {
  * - 排序仅调整节点 next 指针，不释放节点内存。
  */
 void SL_sort_Insertion(SL_link *const linkedList, enum sort way) {
+  SL_STAT_SCOPE(SL_OP_SORT_INSERTION);
+  if (linkedList && linkedList->vector) {
+    SV_sortInsertion(linkedList, way);
+    return;
+  }
   if (!(linkedList && linkedList->headIndex) || linkedList->length <= 1)
     return;  // 空链表或只有一个节点，无需排序
 
@@ -461,6 +1125,7 @@ void SL_sort_Insertion(SL_link *const linkedList, enum sort way) {
   while (disorder) {
     cursor = dummy;  // 重置游标
     while (cursor->next) {
+      SL_STAT_NODES(1);
       if ((!way && disorder->data >= cursor->next->data) ||
           (way && disorder->data <= cursor->next->data))
         cursor = cursor->next;  
@@ -473,14 +1138,250 @@ void SL_sort_Insertion(SL_link *const linkedList, enum sort way) {
     disorder = temp;
   }
 
-  linkedList->headIndex = dummy->next;  // 更新链表头
+  linkedList->headIndex = dummy->next;  // 更新链表头
+  linkedList->version++;
+
+  // 获取并更新链表尾节点
+  temp = cursor;
+  while (temp->next) temp = temp->next;
+  linkedList->endIndex = temp;
+
+  free(dummy);  // 释放虚拟头节点
+}
+
+/**
+ * @brief 从链表片段头部切下前 step 个节点
+ *
+ * @param head 片段头节点
+ * @param step 切下的节点数
+ * @return SL_node* 剩余部分的头节点（不足 step 个节点时返回NULL）
+ */
+static inline SL_node *SL_cutRun(SL_node *head, uint32 step) {
+  for (; head && step > 1; step--)
+    head = head->next;
+  if (!head)
+    return NULL;
+
+  SL_node *rest = head->next;
+  head->next = NULL;
+  return rest;
+}
+
+/**
+ * @brief 稳定合并两个有序片段并接到 tail 之后
+ *
+ * 两值相等时优先取左片段的节点，保证排序稳定。
+ *
+ * @param left 左有序片段
+ * @param right 右有序片段
+ * @param tail 合并结果挂接位置
+ * @param way 排序方式：ASC（升序）或 DESC（降序）
+ * @return SL_node* 合并结果的尾节点
+ */
+static inline SL_node *SL_mergeRuns(SL_node *left, SL_node *right,
+                                    SL_node *tail, enum sort way) {
+  while (left && right) {
+    if ((!way && left->data <= right->data) ||
+        (way && left->data >= right->data)) {
+      tail->next = left;
+      left = left->next;
+    } else {
+      tail->next = right;
+      right = right->next;
+    }
+    tail = tail->next;
+  }
+
+  tail->next = left ? left : right;
+  while (tail->next)
+    tail = tail->next;
+  return tail;
+}
+
+/**
+ * @brief 对单向链表进行归并排序（支持升序 / 降序）
+ *
+ * 使用自底向上（非递归）归并排序，排序方式由参数 way 指定（ASC 升序，DESC 降序）。
+ * 每一轮把长度为 step 的相邻有序片段两两合并，step 从1开始逐轮翻倍。
+ *
+ * @param linkedList 指向链表结构体的常量指针，需保证有效
+ * @param way 排序方式：ASC（升序）或 DESC（降序），定义见 enum sort
+ *
+ * @note
+ * - 时间复杂度O(n log n)，稳定排序（相等元素保持原有先后顺序）；
+ * - 只调整节点 next 指针，不分配任何内存（虚拟头节点位于栈上）；
+ * - 排序后同步更新 headIndex 与 endIndex。
+ */
+void SL_sort_Merge(SL_link *const linkedList, enum sort way) {
+  SL_STAT_SCOPE(SL_OP_SORT_MERGE);
+  if (linkedList && linkedList->vector) {
+    SV_sortMerge(linkedList, way);
+    return;
+  }
+  if (!(linkedList && linkedList->headIndex) || linkedList->length <= 1)
+    return; // 空链表或只有一个节点，无需排序
+
+  SL_node dummy = {0, linkedList->headIndex}; // 栈上虚拟头节点
+  SL_node *tail = NULL;
+
+  for (uint32 step = 1; step < linkedList->length; step <<= 1) {
+    SL_node *cur = dummy.next;
+    tail = &dummy;
+    SL_STAT_NODES(linkedList->length);
+    while (cur) {
+      SL_node *left = cur;
+      SL_node *right = SL_cutRun(left, step);
+      cur = SL_cutRun(right, step);
+      tail = SL_mergeRuns(left, right, tail, way);
+    }
+    if (step > UINT32_MAX / 2) // 防止 step 溢出
+      break;
+  }
+
+  linkedList->headIndex = dummy.next;
+  linkedList->endIndex = tail;
+  linkedList->version++;
+}
+
+/**
+ * @brief 基数排序直方图统计任务
+ */
+typedef struct SL_radixTask {
+  const uint64 *items;                                  ///< 待统计的元素
+  uint32 begin;                                         ///< 统计区间起点
+  uint32 end;                                           ///< 统计区间终点（不含）
+  uint32 hist[SL_RADIX_PASSES][SL_RADIX_BUCKETS]; ///< 每轮的桶计数
+} SL_radixTask;
+
+/**
+ * @brief 一次遍历统计区间内所有轮次的桶计数
+ *
+ * 元素高32位为排序键，低32位为节点下标。
+ *
+ * @param arg SL_radixTask 指针
+ * @return void* 固定返回NULL（满足 pthread 入口签名）
+ */
+static void *SL_radixHistogram(void *arg) {
+  SL_radixTask *task = (SL_radixTask *)arg;
+
+  memset(task->hist, 0, sizeof(task->hist));
+  for (uint32 i = task->begin; i < task->end; i++) {
+    uint32 key = (uint32)(task->items[i] >> 32);
+    task->hist[0][key & (SL_RADIX_BUCKETS - 1)]++;
+    task->hist[1][(key >> SL_RADIX_BITS) & (SL_RADIX_BUCKETS - 1)]++;
+    task->hist[2][key >> (2 * SL_RADIX_BITS)]++;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief 对单向链表进行基数排序（支持升序 / 降序）
+ *
+ * 使用 LSD 基数排序，排序方式由参数 way 指定（ASC 升序，DESC 降序）。
+ * 实现步骤：
+ * 1. 遍历链表，把节点指针拷贝到下标数组，同时生成 (键, 下标) 元素，
+ *    键为 data 翻转符号位后的无符号值（降序时再按位取反）；
+ * 2. 一次遍历统计3轮（11/11/10位）的桶计数，元素数不少于
+ *    SL_RADIX_PARALLEL_MIN 时由 SL_RADIX_THREADS 个线程分段并行统计；
+ * 3. 逐轮按桶分发元素，所有元素落在同一桶的轮次直接跳过；
+ * 4. 按排好的下标顺序重新连接节点，更新 headIndex 与 endIndex。
+ *
+ * @param linkedList 指向链表结构体的常量指针，需保证有效
+ * @param way 排序方式：ASC（升序）或 DESC（降序），定义见 enum sort
+ *
+ * @note
+ * - 时间复杂度O(n)，稳定排序；
+ * - 临时分配约 24 * length 字节的辅助数组，分配失败时退回 SL_sort_Merge()。
+ */
+void SL_sort_Radix(SL_link *const linkedList, enum sort way) {
+  SL_STAT_SCOPE(SL_OP_SORT_RADIX);
+  if (linkedList && linkedList->vector) {
+    SV_sortRadix(linkedList, way);
+    return;
+  }
+  if (!(linkedList && linkedList->headIndex) || linkedList->length <= 1)
+    return; // 空链表或只有一个节点，无需排序
+
+  uint32 n = linkedList->length;
+  SL_node **nodes = (SL_node **)malloc(sizeof(SL_node *) * n);
+  uint64 *items = (uint64 *)malloc(sizeof(uint64) * n);
+  uint64 *buffer = (uint64 *)malloc(sizeof(uint64) * n);
+  SL_radixTask *tasks =
+      (SL_radixTask *)malloc(sizeof(SL_radixTask) * SL_RADIX_THREADS);
+  if (!(nodes && items && buffer && tasks)) {
+    free(nodes);
+    free(items);
+    free(buffer);
+    free(tasks);
+    SL_sort_Merge(linkedList, way);
+    return;
+  }
+
+  // 拷贝节点指针并生成排序元素
+  uint32 flip = way ? 0x7FFFFFFFu : 0x80000000u; // 降序：翻转符号位后再取反
+  SL_node *cur = linkedList->headIndex;
+  for (uint32 i = 0; i < n; i++, cur = cur->next) {
+    nodes[i] = cur;
+    items[i] = ((uint64)((uint32)cur->data ^ flip) << 32) | i;
+  }
+  SL_STAT_NODES(n);
+
+  // 统计各轮桶计数
+  uint32 threads = (n >= SL_RADIX_PARALLEL_MIN) ? SL_RADIX_THREADS : 1;
+  pthread_t tids[SL_RADIX_THREADS];
+  for (uint32 t = 0; t < threads; t++) {
+    tasks[t].items = items;
+    tasks[t].begin = (uint32)((uint64)n * t / threads);
+    tasks[t].end = (uint32)((uint64)n * (t + 1) / threads);
+    if (t == 0 || pthread_create(&tids[t], NULL, SL_radixHistogram,
+                                 &tasks[t]) != 0) {
+      SL_radixHistogram(&tasks[t]); // 创建线程失败时在当前线程完成
+      tids[t] = pthread_self();
+    }
+  }
+  for (uint32 t = 1; t < threads; t++) {
+    if (!pthread_equal(tids[t], pthread_self()))
+      pthread_join(tids[t], NULL);
+    for (uint32 p = 0; p < SL_RADIX_PASSES; p++)
+      for (uint32 b = 0; b < SL_RADIX_BUCKETS; b++)
+        tasks[0].hist[p][b] += tasks[t].hist[p][b];
+  }
 
-  // 获取并更新链表尾节点
-  temp = cursor;
-  while (temp->next) temp = temp->next;
-  linkedList->endIndex = temp;
+  // 逐轮分发
+  for (uint32 p = 0; p < SL_RADIX_PASSES; p++) {
+    uint32 *hist = tasks[0].hist[p];
+    uint32 shift = 32 + p * SL_RADIX_BITS;
+    uint64 first = (items[0] >> shift) & (SL_RADIX_BUCKETS - 1);
+    if (hist[first] == n) // 本轮所有元素同桶，无需分发
+      continue;
+
+    uint32 offset = 0;
+    for (uint32 b = 0; b < SL_RADIX_BUCKETS; b++) { // 计数转换为起始位置
+      uint32 count = hist[b];
+      hist[b] = offset;
+      offset += count;
+    }
+    for (uint32 i = 0; i < n; i++)
+      buffer[hist[(items[i] >> shift) & (SL_RADIX_BUCKETS - 1)]++] = items[i];
 
-  free(dummy);  // 释放虚拟头节点
+    uint64 *temp = items;
+    items = buffer;
+    buffer = temp;
+  }
+
+  // 按排序结果重新连接节点
+  for (uint32 i = 0; i + 1 < n; i++)
+    nodes[(uint32)items[i]]->next = nodes[(uint32)items[i + 1]];
+  linkedList->headIndex = nodes[(uint32)items[0]];
+  linkedList->endIndex = nodes[(uint32)items[n - 1]];
+  linkedList->endIndex->next = NULL;
+  linkedList->version++;
+
+  free(nodes);
+  free(items);
+  free(buffer);
+  free(tasks);
 }
 
 /**
@@ -493,9 +1394,14 @@ void SL_sort_Insertion(SL_link *const linkedList, enum sort way) {
 
  */
 uint16 SL_reverse(SL_link *const linked) {
+  SL_STAT_SCOPE(SL_OP_REVERSE);
   if (linked == NULL || linked->length == 0 || linked->length == 1) {
     return 0;
-  } 
+  }
+  if (linked->vector) {
+    SV_reverse(linked);
+    return 1;
+  }
   SL_node *pre = NULL;              ///< 前驱节点
   SL_node *cur = linked->headIndex; ///< 中心节点
   SL_node *sub = cur->next;        ///< 后继节点
@@ -508,6 +1414,10 @@ uint16 SL_reverse(SL_link *const linked) {
   for (; sub; cur->next = pre, pre = cur, cur = sub, sub = sub->next);
 
   cur->next = pre;
+  SL_STAT_NODES(linked->length);
+  linked->version++;
+
+  return 1;
 }
 
 /** @} */ // 单向链表修改操作
@@ -518,44 +1428,122 @@ uint16 SL_reverse(SL_link *const linked) {
  * @{
  */
 
+/**
+ * @brief 删除单向链表的头节点（状态码接口，不产生任何输出）
+ *
+ * @param linkedList 单向链表指针
+ * @param outData 输出参数，被删除节点的数据；传入NULL时丢弃
+ * @return enum SL_status 成功返回 SL_OK；链表为NULL返回 SL_ERR_NULL；
+ *         链表为空返回 SL_ERR_EMPTY
+ */
+enum SL_status SL_tryDelHead(SL_link *const linkedList,
+                             Elemtype *const outData) {
+  SL_STAT_SCOPE(SL_OP_DEL_HEAD);
+  if (linkedList == NULL)
+    return SL_ERR_NULL;
+  if (linkedList->length == 0)
+    return SL_ERR_EMPTY;
+
+  Elemtype data;
+  if (linkedList->vector) {
+    data = SV_deleteIndex(linkedList, 0);
+  } else {
+    SL_node *deletedNode = linkedList->headIndex; // 保存头节点
+    data = deletedNode->data;
+
+    linkedList->headIndex = deletedNode->next; // 更新头指针
+
+    // 若删除后单向链表为空，同步更新尾指针
+    if (linkedList->headIndex == NULL) {
+      linkedList->endIndex = NULL;
+    }
+
+    linkedList->length--; // 更新单向链表长度
+    SL_freeNode(linkedList, deletedNode); // 释放被删除节点的内存
+  }
+
+  if (outData)
+    *outData = data;
+  return SL_OK;
+}
+
 /**
  * @brief 删除单向链表的头节点
  *
  * 该函数删除单向链表的头节点，释放其内存，并更新单向链表的头指针和长度。
- * 如果单向链表为空，则打印错误信息并返回UINT32_MAX。
+ * 如果单向链表为空，则经 SL_log() 报告错误并返回UINT32_MAX。
  * 如果删除后单向链表为空，同步更新尾指针为NULL。
  *
  * @param linkedList 单向链表指针（需保证单向链表结构有效且不为空）
  * @return Elemtype 被删除头节点的数据；若失败（如单向链表为空），返回
  * UINT32_MAX
+ * @note UINT32_MAX 与数据 -1 无法区分，需要区分时使用 SL_tryDelHead()。
  */
 Elemtype SL_delHead(SL_link *const linkedList) {
-  // 检查单向链表是否为空
-  if (linkedList->headIndex == NULL || linkedList->length == 0) {
-    printf("错误：单向链表为空，无法删除头节点\n");
+  Elemtype outData;
+  if (SL_tryDelHead(linkedList, &outData) != SL_OK) {
+    SL_log(SL_LOG_ERROR, "错误：单向链表为空，无法删除头节点");
     return UINT32_MAX;
   }
+  return outData; // 返回被删除节点的数据
+}
 
-  SL_node *deletedNode = linkedList->headIndex; // 保存头节点
-  Elemtype outData = deletedNode->data;
+/**
+ * @brief 删除单向链表的尾节点（状态码接口，不产生任何输出）
+ *
+ * @param linkedList 单向链表指针
+ * @param outData 输出参数，被删除节点的数据；传入NULL时丢弃
+ * @return enum SL_status 成功返回 SL_OK；链表为NULL返回 SL_ERR_NULL；
+ *         链表为空返回 SL_ERR_EMPTY；找不到尾节点前驱返回 SL_ERR_CORRUPT
+ */
+enum SL_status SL_tryDelEnd(SL_link *const linkedList,
+                            Elemtype *const outData) {
+  SL_STAT_SCOPE(SL_OP_DEL_END);
+  if (linkedList == NULL)
+    return SL_ERR_NULL;
+  if (linkedList->length == 0)
+    return SL_ERR_EMPTY;
+
+  Elemtype data;
+  if (linkedList->vector) {
+    data = SV_deleteIndex(linkedList, linkedList->length - 1);
+  } else {
+    SL_node *deletedNode = linkedList->endIndex; // 保存尾节点
+    data = deletedNode->data;
 
-  linkedList->headIndex = deletedNode->next; // 更新头指针
+    if (linkedList->headIndex == linkedList->endIndex) {
+      // 单向链表只有一个节点，即头节点也是尾节点
+      linkedList->headIndex = NULL;
+      linkedList->endIndex = NULL;
+    } else {
+      // 找到倒数第二个节点
+      SL_node *cur = linkedList->headIndex;
+      while (cur->next != linkedList->endIndex) {
+        cur = cur->next;
+        // 防御性检查：防止单向链表结构损坏
+        if (cur == NULL)
+          return SL_ERR_CORRUPT;
+      }
+      SL_STAT_NODES(linkedList->length - 1);
+      // 更新尾指针
+      linkedList->endIndex = cur;
+      cur->next = NULL; // 断开与原尾节点的链接
+    }
 
-  // 若删除后单向链表为空，同步更新尾指针
-  if (linkedList->headIndex == NULL) {
-    linkedList->endIndex = NULL;
+    linkedList->length--; // 更新单向链表长度
+    SL_freeNode(linkedList, deletedNode); // 释放被删除节点的内存
   }
 
-  linkedList->length--; // 更新单向链表长度
-  free(deletedNode);    // 释放被删除节点的内存
-  return outData;       // 返回被删除节点的数据
+  if (outData)
+    *outData = data;
+  return SL_OK;
 }
 
 /**
  * @brief 删除单向链表的尾节点
  *
  * 该函数删除单向链表的尾节点，释放其内存，并更新单向链表的尾指针和长度。
- * 如果单向链表为空，则打印错误信息并返回UINT32_MAX。
+ * 如果单向链表为空，则经 SL_log() 报告错误并返回UINT32_MAX。
  * 如果单向链表只有一个节点（头节点也是尾节点），删除后将头指针和尾指针都设置为NULL。
  * 否则，需要遍历单向链表找到倒数第二个节点，将其next指针设置为NULL，并更新尾指针。
  *
@@ -565,38 +1553,67 @@ Elemtype SL_delHead(SL_link *const linkedList) {
  * @note 由于单单向链表的限制，删除尾节点需要遍历整个单向链表，时间复杂度为O(n)
  */
 Elemtype SL_delEnd(SL_link *const linkedList) {
-  // 检查单向链表是否为空
-  if (linkedList->endIndex == NULL || linkedList->length == 0) {
-    printf("错误：单向链表为空，无法删除尾节点\n");
+  Elemtype outData;
+  switch (SL_tryDelEnd(linkedList, &outData)) {
+  case SL_OK:
+    return outData; // 返回被删除节点的数据
+  case SL_ERR_CORRUPT:
+    SL_log(SL_LOG_ERROR, "错误：单向链表结构损坏，无法找到尾节点前驱");
+    return UINT32_MAX;
+  default:
+    SL_log(SL_LOG_ERROR, "错误：单向链表为空，无法删除尾节点");
     return UINT32_MAX;
   }
+}
 
-  SL_node *deletedNode = linkedList->endIndex; // 保存尾节点
-  Elemtype outData = deletedNode->data;
+/**
+ * @brief 从单向链表中删除指定节点（状态码接口，不产生任何输出）
+ *
+ * @param linkedList 单向链表指针
+ * @param node 待删除的节点指针
+ * @param outData 输出参数，被删除节点的数据；传入NULL时丢弃
+ * @return enum SL_status 成功返回 SL_OK；链表或节点为NULL返回 SL_ERR_NULL；
+ *         顺序存储链表返回 SL_ERR_UNSUPPORTED；链表为空返回 SL_ERR_EMPTY；
+ *         节点不在链表中返回 SL_ERR_NOT_FOUND
+ */
+enum SL_status SL_tryDeleteNode(SL_link *const linkedList, SL_node *const node,
+                                Elemtype *const outData) {
+  SL_STAT_SCOPE(SL_OP_DELETE_NODE);
+  if (linkedList == NULL)
+    return SL_ERR_NULL;
+  if (linkedList->vector)
+    return SL_ERR_UNSUPPORTED;
+  if (linkedList->headIndex == NULL || linkedList->length == 0)
+    return SL_ERR_EMPTY;
+  if (node == NULL)
+    return SL_ERR_NULL;
 
-  if (linkedList->headIndex == linkedList->endIndex) {
-    // 单向链表只有一个节点，即头节点也是尾节点
-    linkedList->headIndex = NULL;
-    linkedList->endIndex = NULL;
-  } else {
-    // 找到倒数第二个节点
-    SL_node *cur = linkedList->headIndex;
-    while (cur->next != linkedList->endIndex) {
-      cur = cur->next;
-      // 防御性检查：防止单向链表结构损坏
-      if (cur == NULL) {
-        printf("错误：单向链表结构损坏，无法找到尾节点前驱\n");
-        return UINT32_MAX;
-      }
-    }
-    // 更新尾指针
-    linkedList->endIndex = cur;
-    cur->next = NULL; // 断开与原尾节点的链接
+  // 删除头节点
+  if (node == linkedList->headIndex)
+    return SL_tryDelHead(linkedList, outData);
+  // 删除尾节点
+  if (node == linkedList->endIndex)
+    return SL_tryDelEnd(linkedList, outData);
+
+  // 删除中间节点：找到node的前驱节点
+  SL_node *prev = linkedList->headIndex;
+  while (prev != NULL && prev->next != node) {
+    prev = prev->next;
+    SL_STAT_NODES(1);
   }
 
+  // 如果未找到前驱节点，说明node不在单向链表中
+  if (prev == NULL)
+    return SL_ERR_NOT_FOUND;
+
+  // 更新前驱节点的next指针，跳过node
+  prev->next = node->next;
+
+  if (outData)
+    *outData = node->data;
+  SL_freeNode(linkedList, node); // 释放节点内存
   linkedList->length--; // 更新单向链表长度
-  free(deletedNode);    // 释放被删除节点的内存
-  return outData;       // 返回被删除节点的数据
+  return SL_OK;
 }
 
 /**
@@ -615,53 +1632,152 @@ Elemtype SL_delEnd(SL_link *const linkedList) {
  * @warning 传入的节点指针必须是单向链表中的有效节点，否则可能导致错误
  */
 Elemtype SL_deleteNode(SL_link *const linkedList, SL_node *const node) {
-  // 检查单向链表是否为空
-  if (linkedList->headIndex == NULL || linkedList->length == 0) {
-    printf("错误：单向链表为空，无法删除节点\n");
+  Elemtype outData;
+  switch (SL_tryDeleteNode(linkedList, node, &outData)) {
+  case SL_OK:
+    return outData;
+  case SL_ERR_UNSUPPORTED:
+    SL_log(SL_LOG_ERROR, "错误：顺序存储链表不支持节点指针接口");
+    return UINT32_MAX;
+  case SL_ERR_EMPTY:
+    SL_log(SL_LOG_ERROR, "错误：单向链表为空，无法删除节点");
+    return UINT32_MAX;
+  case SL_ERR_CORRUPT:
+    SL_log(SL_LOG_ERROR, "错误：单向链表结构损坏，无法找到尾节点前驱");
+    return UINT32_MAX;
+  case SL_ERR_NOT_FOUND:
+    SL_log(SL_LOG_ERROR, "未找到目标节点，无法删除");
+    return UINT32_MAX;
+  default:
+    SL_log(SL_LOG_ERROR, "传入的节点指针为NULL");
     return UINT32_MAX;
   }
+}
+
+/**
+ * @brief 删除指定节点的后继节点（状态码接口，不产生任何输出）
+ *
+ * 已持有前驱节点时删除只需O(1)（SL_tryDeleteNode 需要遍历查找前驱）。
+ *
+ * @param linkedList 单向链表指针
+ * @param prev 前驱节点，为NULL时删除头节点
+ * @param outData 输出参数，被删除节点的数据；传入NULL时丢弃
+ * @return enum SL_status 成功返回 SL_OK；链表为NULL返回 SL_ERR_NULL；
+ *         顺序存储链表返回 SL_ERR_UNSUPPORTED；没有后继节点返回 SL_ERR_NOT_FOUND
+ * @warning prev 必须是该单向链表中的有效节点。
+ */
+enum SL_status SL_tryDeleteAfter(SL_link *const linkedList,
+                                 SL_node *const prev,
+                                 Elemtype *const outData) {
+  SL_STAT_SCOPE(SL_OP_DELETE_NODE);
+  if (linkedList == NULL)
+    return SL_ERR_NULL;
+  if (linkedList->vector)
+    return SL_ERR_UNSUPPORTED;
+
+  SL_node *target = prev ? prev->next : linkedList->headIndex;
+  if (target == NULL)
+    return SL_ERR_NOT_FOUND;
+
+  if (prev == NULL)
+    linkedList->headIndex = target->next;
+  else
+    prev->next = target->next;
+  if (target == linkedList->endIndex) // 删除尾节点时同步尾指针
+    linkedList->endIndex = prev;
+
+  if (outData)
+    *outData = target->data;
+  linkedList->length--;
+  SL_freeNode(linkedList, target);
+  return SL_OK;
+}
 
-  // 检查节点是否为NULL
-  if (node == NULL) {
-    printf("传入的节点指针为NULL\n");
+/**
+ * @brief 删除指定节点的后继节点，返回被删除节点的数据
+ *
+ * 已持有前驱节点时删除只需O(1)（SL_deleteNode 需要遍历查找前驱）。
+ *
+ * @param linkedList 单向链表指针
+ * @param prev 前驱节点，为NULL时删除头节点
+ * @return Elemtype 被删除节点的数据；没有后继节点时返回UINT32_MAX
+ * @warning prev 必须是该单向链表中的有效节点。
+ */
+Elemtype SL_deleteAfter(SL_link *const linkedList, SL_node *const prev) {
+  Elemtype outData;
+  switch (SL_tryDeleteAfter(linkedList, prev, &outData)) {
+  case SL_OK:
+    return outData;
+  case SL_ERR_UNSUPPORTED:
+    SL_log(SL_LOG_ERROR, "错误：顺序存储链表不支持节点指针接口");
+    return UINT32_MAX;
+  default:
+    SL_log(SL_LOG_ERROR, "错误：指定节点没有后继节点，无法删除");
     return UINT32_MAX;
   }
+}
 
-  // 删除头节点
-  if (node == linkedList->headIndex) {
-    return SL_delHead(linkedList);
-  }
-  // 删除尾节点
-  else if (node == linkedList->endIndex) {
-    return SL_delEnd(linkedList);
+/**
+ * @brief 删除单向链表中指定索引的节点（状态码接口，不产生任何输出）
+ *
+ * @param linkedList 单向链表指针
+ * @param index 待删除节点的索引（从0开始计数）
+ * @param outData 输出参数，被删除节点的数据；传入NULL时丢弃
+ * @return enum SL_status 成功返回 SL_OK；链表为NULL返回 SL_ERR_NULL；
+ *         链表为空返回 SL_ERR_EMPTY；索引越界返回 SL_ERR_RANGE；
+ *         找不到前驱节点返回 SL_ERR_CORRUPT
+ */
+enum SL_status SL_tryDeleteIndex(SL_link *const linkedList, const uint32 index,
+                                 Elemtype *const outData) {
+  SL_STAT_SCOPE(SL_OP_DELETE_INDEX);
+  if (linkedList == NULL)
+    return SL_ERR_NULL;
+  // 检查单向链表是否为空
+  if (linkedList->length == 0)
+    return SL_ERR_EMPTY;
+  // 检查索引是否越界（索引需满足 0 <= index < length）
+  if (index >= linkedList->length)
+    return SL_ERR_RANGE;
+
+  if (linkedList->vector) {
+    Elemtype data = SV_deleteIndex(linkedList, index);
+    if (outData)
+      *outData = data;
+    return SL_OK;
   }
-  // 删除中间节点
-  else {
-    SL_node *prev = linkedList->headIndex;
-    // 找到node的前驱节点
-    while (prev != NULL && prev->next != node) {
-      prev = prev->next;
-    }
 
-    // 如果未找到前驱节点，说明node不在单向链表中
-    if (prev == NULL) {
-      printf("未找到目标节点，无法删除\n");
-      return UINT32_MAX;
-    }
+  // 删除头节点（索引0）
+  if (index == 0)
+    return SL_tryDelHead(linkedList, outData);
+  // 删除尾节点（索引 == length - 1）
+  if (index == linkedList->length - 1)
+    return SL_tryDelEnd(linkedList, outData);
+
+  // 删除中间节点：找到前驱节点（索引为 index - 1）
+  SL_node *prev = linkedList->headIndex;
+  for (uint32 i = 0; i < index - 1; i++) {
+    prev = prev->next;
+    // 防御性检查：防止单向链表结构损坏
+    if (prev == NULL)
+      return SL_ERR_CORRUPT;
+  }
+  SL_STAT_NODES(index);
 
-    // 更新前驱节点的next指针，跳过node
-    prev->next = node->next;
+  SL_node *deletedNode = prev->next; // 保存被删除节点
+  if (outData)
+    *outData = deletedNode->data;
 
-    // 如果删除的是尾节点，更新尾指针
-    if (node == linkedList->endIndex) {
-      linkedList->endIndex = prev;
-    }
+  // 更新前驱节点的next指针，跳过被删除节点
+  prev->next = deletedNode->next;
 
-    Elemtype outData = node->data;
-    free(node);           // 释放节点内存
-    linkedList->length--; // 更新单向链表长度
-    return outData;
+  // 如果删除的是尾节点，更新尾指针
+  if (deletedNode == linkedList->endIndex) {
+    linkedList->endIndex = prev;
   }
+
+  linkedList->length--; // 更新单向链表长度
+  SL_freeNode(linkedList, deletedNode); // 释放被删除节点的内存
+  return SL_OK;
 }
 
 /**
@@ -672,7 +1788,7 @@ Elemtype SL_deleteNode(SL_link *const linkedList, SL_node *const node) {
  * - 如果删除的是头节点，调用delHead函数处理；
  * - 如果删除的是尾节点，调用delEnd函数处理；
  * - 如果删除的是中间节点，找到其前驱节点，更新前驱节点的next指针。
- * 如果索引越界或单向链表为空，则打印错误信息并返回UINT32_MAX。
+ * 如果索引越界或单向链表为空，则经 SL_log() 报告错误并返回UINT32_MAX。
  *
  * @param linkedList 单向链表指针（需保证单向链表结构有效）
  * @param index 待删除节点的索引（从0开始计数）
@@ -681,55 +1797,100 @@ Elemtype SL_deleteNode(SL_link *const linkedList, SL_node *const node) {
  * @note 索引需满足 0 <= index < length，否则函数将返回错误
  */
 Elemtype SL_deleteIndex(SL_link *const linkedList, uint32_t index) {
-  // 检查单向链表是否为空
-  if (linkedList->headIndex == NULL || linkedList->length == 0) {
-    printf("单向链表为空，无法删除索引 %u 的节点\n", index);
+  Elemtype outData;
+  switch (SL_tryDeleteIndex(linkedList, index, &outData)) {
+  case SL_OK:
+    return outData;
+  case SL_ERR_EMPTY:
+    SL_log(SL_LOG_ERROR, "单向链表为空，无法删除索引 %u 的节点", index);
     return UINT32_MAX;
-  }
-
-  // 检查索引是否越界（索引需满足 0 <= index < length）
-  if (index >= linkedList->length) {
-    printf("错误：索引 %u 越界(单向链表长度为 %u)\n", index,
+  case SL_ERR_RANGE:
+    SL_log(SL_LOG_ERROR, "错误：索引 %u 越界(单向链表长度为 %u)", index,
            linkedList->length);
     return UINT32_MAX;
+  default:
+    SL_log(SL_LOG_ERROR, "错误：单向链表结构损坏，无法找到索引 %u 的前驱节点",
+           index);
+    return UINT32_MAX;
   }
+}
 
-  // 删除头节点（索引0）
-  if (index == 0) {
-    return SL_delHead(linkedList);
-  }
-  // 删除尾节点（索引 == length - 1）
-  else if (index == linkedList->length - 1) {
-    return SL_delEnd(linkedList);
-  }
-  // 删除中间节点
-  else {
-    SL_node *prev = linkedList->headIndex;
-    // 找到前驱节点（索引为 index - 1）
-    for (uint32_t i = 0; i < index - 1; i++) {
-      prev = prev->next;
-      // 防御性检查：防止单向链表结构损坏
-      if (prev == NULL) {
-        printf("错误：单向链表结构损坏，无法找到索引 %u 的前驱节点\n", index);
-        return UINT32_MAX;
-      }
-    }
+/**
+ * @brief 删除单向链表中指定数据的目标匹配项（状态码接口，不产生任何输出）
+ *
+ * 删除模式与 SL_deleteData() 相同。
+ *
+ * @param linkedList 单向链表指针
+ * @param targetData 待删除的目标数据值
+ * @param deleteCount 0：删除所有匹配项；>0：删除第 deleteCount 个匹配项
+ * @param outDeleted 输出参数，实际删除的节点数；传入NULL时丢弃
+ * @return enum SL_status 至少删除一个节点返回 SL_OK；链表为NULL返回
+ *         SL_ERR_NULL；链表为空返回 SL_ERR_EMPTY；没有（足够的）匹配项返回
+ *         SL_ERR_NOT_FOUND
+ */
+enum SL_status SL_tryDeleteData(SL_link *const linkedList,
+                                const Elemtype targetData,
+                                const uint32 deleteCount,
+                                uint32 *const outDeleted) {
+  SL_STAT_SCOPE(SL_OP_DELETE_DATA);
+  if (outDeleted)
+    *outDeleted = 0;
+  if (linkedList == NULL)
+    return SL_ERR_NULL;
+  // 检查单向链表是否为空
+  if (linkedList->length == 0)
+    return SL_ERR_EMPTY;
+
+  // 剩余匹配项数量（未启用哈希索引时视为不限）
+  uint32 remaining = linkedList->index
+                         ? SL_indexCount(linkedList->index, targetData)
+                         : UINT32_MAX;
+  uint32 deleted = 0; // 已删除的节点数
+
+  if (linkedList->vector) {
+    deleted = SV_deleteData(linkedList, targetData, deleteCount);
+  } else if (remaining != 0 &&
+             (deleteCount == 0 || deleteCount <= remaining)) {
+    SL_node *current = linkedList->headIndex; // 当前遍历节点
+    SL_node *prev = NULL;                     // 前驱节点（用于维护链接）
+    uint32 matchIndex = 0;                    // 当前匹配的序号（从1开始）
+
+    while (current != NULL && remaining != 0) {
+      SL_node *next = current->next;
+      SL_STAT_NODES(1);
+
+      if (current->data == targetData) {
+        matchIndex++;
+        remaining--;
+
+        if (deleteCount == 0 || matchIndex == deleteCount) {
+          // 从链表中摘除当前节点，前驱保持不变
+          if (prev)
+            prev->next = next;
+          else
+            linkedList->headIndex = next;
+          if (current == linkedList->endIndex)
+            linkedList->endIndex = prev;
 
-    SL_node *deletedNode = prev->next; // 保存被删除节点
-    Elemtype outData = deletedNode->data;
+          linkedList->length--;
+          SL_freeNode(linkedList, current); // 释放被删除节点的内存
+          deleted++;
 
-    // 更新前驱节点的next指针，跳过被删除节点
-    prev->next = deletedNode->next;
+          if (deleteCount > 0) // 只删除第 deleteCount 个匹配项
+            break;
+          current = next;
+          continue;
+        }
+      }
 
-    // 如果删除的是尾节点，更新尾指针
-    if (deletedNode == linkedList->endIndex) {
-      linkedList->endIndex = prev;
+      prev = current; // 更新前驱节点
+      current = next;
     }
-
-    linkedList->length--; // 更新单向链表长度
-    free(deletedNode);    // 释放被删除节点的内存
-    return outData;
   }
+
+  if (outDeleted)
+    *outDeleted = deleted;
+  return deleted ? SL_OK : SL_ERR_NOT_FOUND;
 }
 
 /**
@@ -749,163 +1910,309 @@ Elemtype SL_deleteIndex(SL_link *const linkedList, uint32_t index) {
  * @return Elemtype 被删除节点的数据；若失败（如未找到匹配项或参数无效），返回
  * UINT32_MAX
  * @note
- * 当deleteCount=0时，函数会删除所有匹配的节点，但只返回最后一个被删除节点的数据
+ * - 两种模式都只遍历一次链表，遍历时同步维护前驱节点，时间复杂度O(n)；
+ * - 当deleteCount=0时，函数会删除所有匹配的节点，但只返回最后一个被删除节点的数据；
+ * - 启用哈希索引时，匹配项不足的情况O(1)返回，删除完全部匹配项后提前结束遍历；
+ * - 需要删除的节点数或区分失败原因时使用 SL_tryDeleteData()。
  */
 Elemtype SL_deleteData(SL_link *const linkedList, const Elemtype targetData,
-                       uint32_t deleteCount) {
-  // 检查单向链表是否为空
-  if (linkedList->headIndex == NULL || linkedList->length == 0) {
-    printf("单向链表为空，无法删除数据 %u\n", targetData);
+                       uint32 deleteCount) {
+  switch (SL_tryDeleteData(linkedList, targetData, deleteCount, NULL)) {
+  case SL_OK:
+    return targetData; // 返回被删除的数据
+  case SL_ERR_EMPTY:
+    SL_log(SL_LOG_ERROR, "单向链表为空，无法删除数据 %d", targetData);
     return UINT32_MAX;
+  default: // 处理未找到匹配项的情况
+    if (deleteCount > 0) {
+      SL_log(SL_LOG_ERROR, "错误：未找到第 %u 个数据为 %d 的节点", deleteCount,
+             targetData);
+    } else {
+      SL_log(SL_LOG_ERROR, "错误：单向链表中未找到数据为 %d 的节点",
+             targetData);
+    }
+    return UINT32_MAX; // 未找到匹配项
   }
+}
 
-  SL_node *current = linkedList->headIndex; // 当前遍历节点
-  SL_node *prev = NULL;                     // 前驱节点（用于维护链接）
-  uint32_t matchIndex = 0;                  // 当前匹配的序号（从1开始）
-  Elemtype deletedData = UINT32_MAX;        // 记录被删除节点的数据
+/**
+ * @brief 释放批量删除摘下的节点串
+ *
+ * 启用哈希索引时逐个删除索引中的值；使用节点池时整串挂回空闲链表（O(1)），
+ * 否则逐个 free()。
+ *
+ * @param linkedList 节点所属的单向链表
+ * @param head 节点串首节点（经 next 串接）
+ * @param tail 节点串尾节点
+ * @param count 节点数
+ */
+static void SL_freeChain(SL_link *const linkedList, SL_node *head,
+                         SL_node *const tail, const uint32 count) {
+  if (count == 0)
+    return;
+  linkedList->version++;
+  SL_STAT_FREE(count);
 
-  // 遍历单向链表查找匹配项
-  while (current != NULL) {
-    if (current->data == targetData) {
-      matchIndex++; // 匹配序号+1
-
-      // 删除第 deleteCount 个匹配项（deleteCount > 0）
-      if (deleteCount > 0 && matchIndex == deleteCount) {
-        // 保存被删除节点及其数据
-        SL_node *toDelete = current;
-        deletedData = toDelete->data;
-
-        // 判断是否为头节点
-        if (toDelete == linkedList->headIndex) {
-          return SL_delHead(linkedList);
-        }
-        // 判断是否为尾节点
-        else if (toDelete == linkedList->endIndex) {
-          return SL_delEnd(linkedList);
-        }
-        // 否则为中间节点
-        else {
-          // 找到前驱节点
-          prev = linkedList->headIndex;
-          while (prev != NULL && prev->next != toDelete) {
-            prev = prev->next;
-            // 防御性检查：防止单向链表结构损坏
-            if (prev == NULL) {
-              printf("错误：单向链表结构损坏，无法找到匹配节点的前驱\n");
-              return UINT32_MAX;
-            }
-          }
-          if (prev == NULL) {
-            printf("错误：未找到匹配节点的前驱\n");
-            return UINT32_MAX;
-          }
-          // 更新前驱节点的next指针，跳过被删除节点
-          prev->next = toDelete->next;
-
-          // 如果删除的是尾节点，更新尾指针
-          if (toDelete == linkedList->endIndex) {
-            linkedList->endIndex = prev;
-          }
+  if (linkedList->index) {
+    for (SL_node *cur = head; cur; cur = cur->next)
+      SL_indexRemove(linkedList->index, cur->data);
+  }
 
-          linkedList->length--; // 更新单向链表长度
-          free(toDelete);       // 释放被删除节点的内存
-          return deletedData;   // 返回被删除的数据
-        }
+  if (linkedList->pool) {
+    SL_poolReleaseChain(linkedList->pool, head, tail);
+    return;
+  }
+  while (head) {
+    SL_node *next = head->next;
+    free(head);
+    head = next;
+  }
+}
 
-        // 删除所有匹配项（deleteCount == 0）
-      } else if (deleteCount == 0) {
-        SL_node *toDelete = current;
-        Elemtype dataDelete = toDelete->data;
+/**
+ * @brief 一次遍历删除满足（或不满足）条件的节点
+ *
+ * @param linkedList 单向链表指针
+ * @param predicate 条件
+ * @param context 透传给 predicate 的用户上下文
+ * @param keep 为0时删除满足条件的节点，为1时删除不满足条件的节点
+ * @return uint32 删除的节点数
+ */
+static uint32 SL_removeWhere(SL_link *const linkedList,
+                             SL_predicateFn predicate, void *const context,
+                             const uint16 keep) {
+  uint32 length = linkedList->length;
+
+  if (linkedList->vector) { // 顺序存储：单次压缩
+    Elemtype *data = SV_DATA(linkedList);
+    uint32 write = 0;
+    for (uint32 i = 0; i < length; i++) {
+      if ((predicate(data[i], context) != 0) == keep)
+        data[write++] = data[i];
+    }
+    linkedList->length = write;
+    if (write != length)
+      linkedList->version++;
+    return length - write;
+  }
 
-        // 判断是否为头节点
-        if (toDelete == linkedList->headIndex) {
-          SL_delHead(linkedList);
-        }
-        // 判断是否为尾节点
-        else if (toDelete == linkedList->endIndex) {
-          SL_delEnd(linkedList);
-        }
-        // 否则为中间节点
-        else {
-          // 找到前驱节点
-          prev = linkedList->headIndex;
-          while (prev != NULL && prev->next != toDelete) {
-            prev = prev->next;
-            // 防御性检查：防止单向链表结构损坏
-            if (prev == NULL) {
-              printf("错误：单向链表结构损坏，无法找到匹配节点的前驱\n");
-              return UINT32_MAX;
-            }
-          }
-          if (prev == NULL) {
-            printf("错误：未找到匹配节点的前驱\n");
-            return UINT32_MAX;
-          }
-          // 更新前驱节点的next指针，跳过被删除节点
-          prev->next = toDelete->next;
-
-          // 如果删除的是尾节点，更新尾指针
-          if (toDelete == linkedList->endIndex) {
-            linkedList->endIndex = prev;
-          }
+  SL_node **link = &linkedList->headIndex; // 指向当前节点的链接
+  SL_node *prev = NULL;                    // 最后一个保留的节点
+  SL_node *removed = NULL;                 // 摘下的节点串（逆序）
+  SL_node *removedTail = NULL;
+  uint32 count = 0;
+
+  for (SL_node *cur = *link; cur; cur = *link) {
+    if ((predicate(cur->data, context) != 0) == keep) {
+      prev = cur;
+      link = &cur->next;
+      continue;
+    }
+    *link = cur->next; // 摘下当前节点，链接位置不变
+    cur->next = removed;
+    removed = cur;
+    if (!removedTail)
+      removedTail = cur;
+    count++;
+  }
+  SL_STAT_NODES(length);
 
-          linkedList->length--; // 更新单向链表长度
-          free(toDelete);       // 释放被删除节点的内存
-          // 继续循环以删除下一个匹配项（不立即返回）
-          current = linkedList->headIndex;
-          matchIndex = 0; // 重置匹配序号
-          continue;
-        }
+  linkedList->endIndex = prev;
+  linkedList->length -= count;
+  SL_freeChain(linkedList, removed, removedTail, count);
+  return count;
+}
 
-        // 如果是中间节点，删除并继续
-        dataDelete = toDelete->data;
-        if (toDelete == linkedList->headIndex) {
-          SL_delHead(linkedList);
-        } else if (toDelete == linkedList->endIndex) {
-          SL_delEnd(linkedList);
-        } else {
-          prev = linkedList->headIndex;
-          while (prev != NULL && prev->next != toDelete) {
-            prev = prev->next;
-            if (prev == NULL) {
-              printf("错误：单向链表结构损坏，无法找到匹配节点的前驱\n");
-              return UINT32_MAX;
-            }
-          }
-          if (prev == NULL) {
-            printf("错误：未找到匹配节点的前驱\n");
-            return UINT32_MAX;
-          }
-          prev->next = toDelete->next;
-          if (toDelete == linkedList->endIndex) {
-            linkedList->endIndex = prev;
-          }
-          linkedList->length--;
-          free(toDelete);
-        }
-        // 继续循环以删除下一个匹配项
-        current = linkedList->headIndex;
-        matchIndex = 0; // 重置匹配序号
-        continue;
+/**
+ * @brief 一次遍历删除一组下标对应的节点
+ *
+ * 下标按原链表位置计算，只遍历到最后一个待删除下标为止，时间复杂度
+ * O(最大下标 + count)，而逐个调用 SL_deleteIndex() 为O(n·count)。
+ * 摘下的节点最后统一释放（使用节点池时整串归还）。
+ *
+ * @param linkedList 单向链表指针
+ * @param indices 待删除的下标，必须按升序排列；重复的下标只删除一次，
+ *                大于等于链表长度的下标被忽略
+ * @param count 下标个数
+ * @return uint32 删除的节点数；参数无效或下标未按升序排列时返回0且不修改链表
+ */
+uint32 SL_deleteIndices(SL_link *const linkedList, const uint32 *const indices,
+                        const uint32 count) {
+  SL_STAT_SCOPE(SL_OP_DELETE_BATCH);
+  if (linkedList == NULL || (indices == NULL && count != 0)) {
+    SL_log(SL_LOG_ERROR, "错误：链表或下标数组为NULL");
+    return 0;
+  }
+  for (uint32 i = 1; i < count; i++) {
+    if (indices[i] < indices[i - 1]) {
+      SL_log(SL_LOG_ERROR, "错误：下标数组未按升序排列（第 %u 个）", i);
+      return 0;
+    }
+  }
 
-        // 当前节点不匹配或未找到目标序号（继续遍历）
-      } else {
-        prev = current; // 更新前驱节点
-        current = current->next;
+  uint32 length = linkedList->length;
+  uint32 next = 0; // 下一个待处理的下标
+  if (count == 0 || indices[0] >= length)
+    return 0;
+
+  if (linkedList->vector) { // 顺序存储：从第一个下标开始单次压缩
+    Elemtype *data = SV_DATA(linkedList);
+    uint32 write = indices[0];
+    for (uint32 read = indices[0]; read < length; read++) {
+      if (next < count && indices[next] == read) {
+        while (next < count && indices[next] == read)
+          next++;
+        continue;
       }
-    } else {
-      prev = current; // 更新前驱节点
-      current = current->next;
+      data[write++] = data[read];
     }
+    linkedList->length = write;
+    linkedList->version++;
+    return length - write;
   }
 
-  // 处理未找到匹配项的情况
-  if (deleteCount > 0) {
-    printf("错误：未找到第 %u 个数据为 %u 的节点\n", deleteCount, targetData);
-  } else {
-    printf("错误：单向链表中未找到数据为 %u 的节点\n", targetData);
+  SL_node **link = &linkedList->headIndex; // 指向原位置 position 节点的链接
+  SL_node *prev = NULL;                    // 原位置 position 的前驱
+  SL_node *removed = NULL;                 // 摘下的节点串（逆序）
+  SL_node *removedTail = NULL;
+  uint32 position = 0;
+  uint32 deleted = 0;
+
+  for (; next < count && indices[next] < length; next++) {
+    if (next && indices[next] == indices[next - 1])
+      continue; // 重复的下标
+    for (; position < indices[next]; position++) {
+      prev = *link;
+      link = &prev->next;
+    }
+
+    SL_node *cur = *link;
+    *link = cur->next; // 摘下后 *link 即原位置 position + 1 的节点
+    if (cur == linkedList->endIndex)
+      linkedList->endIndex = prev;
+    cur->next = removed;
+    removed = cur;
+    if (!removedTail)
+      removedTail = cur;
+    position++;
+    deleted++;
+  }
+  SL_STAT_NODES(position);
+
+  linkedList->length -= deleted;
+  SL_freeChain(linkedList, removed, removedTail, deleted);
+  return deleted;
+}
+
+/**
+ * @brief 值集合：Fibonacci 哈希 + 线性探测，负载因子不超过 1/2
+ *
+ * 槽位高32位为占用标记，低32位为值，0 表示空槽（与 sl_distinct.c 相同）。
+ */
+typedef struct SL_valueSet {
+  uint64 *slots; ///< 槽位数组
+  uint64 mask;   ///< 槽位数 - 1
+  uint32 shift;  ///< 哈希右移位数
+} SL_valueSet;
+
+/**
+ * @brief 判断值是否在集合中（SL_predicateFn）
+ */
+static uint16 SL_valueSetHas(const Elemtype data, void *const context) {
+  const SL_valueSet *set = (const SL_valueSet *)context;
+  uint64 entry = (1ull << 32) | (uint32)data;
+  uint64 slot = (uint32)((uint32)data * 2654435769u) >> set->shift;
+  while (set->slots[slot]) {
+    if (set->slots[slot] == entry)
+      return 1;
+    slot = (slot + 1) & set->mask;
+  }
+  return 0;
+}
+
+/**
+ * @brief 一次遍历删除值属于给定集合的全部节点
+ *
+ * 先把 values 放入哈希集合（O(count)），再遍历链表一次，每个节点O(1)判断，
+ * 总代价O(n + count)；逐个值调用 SL_deleteData() 为O(n·count)。
+ *
+ * @param linkedList 单向链表指针
+ * @param values 待删除的值（可以重复，无需排序）
+ * @param count 值的个数
+ * @return uint32 删除的节点数；参数无效或内存分配失败返回0且不修改链表
+ */
+uint32 SL_deleteValues(SL_link *const linkedList, const Elemtype *const values,
+                       const uint32 count) {
+  SL_STAT_SCOPE(SL_OP_DELETE_BATCH);
+  if (linkedList == NULL || (values == NULL && count != 0)) {
+    SL_log(SL_LOG_ERROR, "错误：链表或数据数组为NULL");
+    return 0;
+  }
+  if (count == 0 || linkedList->length == 0)
+    return 0;
+
+  SL_valueSet set = {.shift = 32 - 4}; // 至少16个槽位
+  uint64 capacity = 16;
+  while (capacity < (uint64)count * 2) {
+    capacity <<= 1;
+    set.shift--;
+  }
+  set.mask = capacity - 1;
+  set.slots = (uint64 *)calloc((size_t)capacity, sizeof(uint64));
+  if (!set.slots) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return 0;
+  }
+
+  for (uint32 i = 0; i < count; i++) {
+    uint64 entry = (1ull << 32) | (uint32)values[i];
+    uint64 slot = (uint32)((uint32)values[i] * 2654435769u) >> set.shift;
+    while (set.slots[slot] && set.slots[slot] != entry)
+      slot = (slot + 1) & set.mask;
+    set.slots[slot] = entry;
+  }
+
+  uint32 deleted = SL_removeWhere(linkedList, SL_valueSetHas, &set, 0);
+  free(set.slots);
+  return deleted;
+}
+
+/**
+ * @brief 一次遍历删除满足条件的全部节点
+ *
+ * 摘下的节点最后统一释放（使用节点池时整串归还），时间复杂度O(n)。
+ *
+ * @param linkedList 单向链表指针
+ * @param predicate 条件，返回非0表示删除该节点
+ * @param context 透传给 predicate 的用户上下文
+ * @return uint32 删除的节点数；参数无效返回0
+ */
+uint32 SL_removeIf(SL_link *const linkedList, SL_predicateFn predicate,
+                   void *const context) {
+  SL_STAT_SCOPE(SL_OP_DELETE_BATCH);
+  if (linkedList == NULL || predicate == NULL) {
+    SL_log(SL_LOG_ERROR, "错误：链表或条件函数为NULL");
+    return 0;
+  }
+  return SL_removeWhere(linkedList, predicate, context, 0);
+}
+
+/**
+ * @brief 一次遍历只保留满足条件的节点，删除其余节点
+ *
+ * @param linkedList 单向链表指针
+ * @param predicate 条件，返回非0表示保留该节点
+ * @param context 透传给 predicate 的用户上下文
+ * @return uint32 删除的节点数；参数无效返回0
+ */
+uint32 SL_retainIf(SL_link *const linkedList, SL_predicateFn predicate,
+                   void *const context) {
+  SL_STAT_SCOPE(SL_OP_DELETE_BATCH);
+  if (linkedList == NULL || predicate == NULL) {
+    SL_log(SL_LOG_ERROR, "错误：链表或条件函数为NULL");
+    return 0;
   }
-  return UINT32_MAX; // 未找到匹配项
+  return SL_removeWhere(linkedList, predicate, context, 1);
 }
 
 /** @} */ // 单向链表删除操作
@@ -925,23 +2232,55 @@ Elemtype SL_deleteData(SL_link *const linkedList, const Elemtype targetData,
  *
  * @param linkedList 指向要遍历的单向链表的指针
  * @return uint32 返回单向链表的当前长度
- * @note 函数会打印每个节点的数据，格式为"数据值\t"，每20个数据后换行
+ * @note 函数会打印每个节点的数据，格式为"数据值\t"，每20个数据后换行。
+ *       输出经 sl_writer.h 的缓冲输出器格式化，每 SW_DEFAULT_CAPACITY
+ *       字节才调用一次 fwrite()；需要其它格式或输出目标时直接使用 SW_writeLink()。
  */
 uint32 SL_traverseLink(SL_link *const linkedList) {
-  SL_node *cursor = linkedList->headIndex; // 创建临时节点，指向单向链表头节点
-  uint16 number = 0;                        // 创建计数器
-
-  for (; cursor; printf("%d\t", cursor->data), cursor = cursor->next, number++) {
-    if (number == 20) {
-      number = 0;
-      printf("\n");
-    }
+  SL_STAT_SCOPE(SL_OP_TRAVERSE);
+  SW_writer *writer = SW_inifWriterFile(stdout, 0);
+  if (writer) {
+    SW_writeLink(writer, linkedList, NULL);
+    SW_freeWriter(writer);
   }
-  printf("\n");
+  SL_STAT_NODES(linkedList->length);
 
   return linkedList->length;
 }
 
+/**
+ * @brief 将单向链表中的数据按顺序导出到数组
+ *
+ * 该函数从链表头开始遍历，把节点数据依次写入 outArray，
+ * 最多写入 capacity 个元素。
+ *
+ * @param linkedList 单向链表指针
+ * @param outArray 输出数组，由调用者分配
+ * @param capacity 输出数组容量（元素个数）
+ * @return uint32 实际写入的元素个数
+ * @note 容量不小于 linkedList->length 时可导出全部数据。
+ */
+uint32 SL_toArray(SL_link *const linkedList, Elemtype *const outArray,
+                  const uint32 capacity) {
+  SL_STAT_SCOPE(SL_OP_TO_ARRAY);
+  if (linkedList == NULL || outArray == NULL)
+    return 0;
+  if (linkedList->vector) {
+    uint32 count = linkedList->length < capacity ? linkedList->length : capacity;
+    memcpy(outArray, SV_DATA(linkedList), sizeof(Elemtype) * count);
+    return count;
+  }
+
+  SL_node *cursor = linkedList->headIndex;
+  uint32 count = 0;
+
+  for (; cursor && count < capacity; cursor = cursor->next)
+    outArray[count++] = cursor->data;
+  SL_STAT_NODES(count);
+
+  return count;
+}
+
 /** @} */ // 单向链表遍历操作
 
 /**
@@ -958,19 +2297,41 @@ uint32 SL_traverseLink(SL_link *const linkedList) {
  * 说明：该函数遍历链表，从 headIndex 开始，逐个释放所有 SL_node 节点，
  *      并将链表头尾指针置空，长度置零。
  *      但它不会释放 SL_link 结构体本身。
+ *      - 私有节点池：直接整池回收，代价为O(块数)，不逐个遍历节点；
+ *      - 共享节点池：逐个把节点挂回节点池空闲链表，不调用 free()。
  */
 void SL_freeNodes(SL_link *const linkedList) {
+  SL_STAT_SCOPE(SL_OP_FREE);
   if (linkedList == NULL) {
-    printf("警告：传入的链表指针为 NULL，无节点可释放。\n");
+    SL_log(SL_LOG_WARN, "警告：传入的链表指针为 NULL，无节点可释放。");
     return;
   }
 
   SL_node *current = linkedList->headIndex;
   SL_node *nextNode = NULL;
 
+  if (linkedList->index) { // 哈希索引整体清空
+    SL_indexClear(linkedList->index);
+  }
+
+  if (linkedList->vector) { // 顺序存储只需清空长度
+    SV_clear(linkedList);
+    current = NULL;
+  }
+
+  if (linkedList->ownPool) { // 私有节点池整池回收
+    SL_STAT_FREE(linkedList->length);
+    SL_poolReset(linkedList->pool);
+    current = NULL;
+  }
+
   while (current != NULL) {
     nextNode = current->next;
-    free(current);
+    SL_STAT_FREE(1);
+    if (linkedList->pool)
+      SL_poolRelease(linkedList->pool, current);
+    else
+      free(current);
     current = nextNode;
   }
 
@@ -978,8 +2339,9 @@ void SL_freeNodes(SL_link *const linkedList) {
   linkedList->headIndex = NULL;
   linkedList->endIndex = NULL;
   linkedList->length = 0;
+  linkedList->version++;
 
-  printf("链表所有节点内存已释放。\n");
+  SL_log(SL_LOG_INFO, "链表所有节点内存已释放。");
 }
 
 /**
@@ -992,17 +2354,27 @@ void SL_freeNodes(SL_link *const linkedList) {
  */
 void SL_freeLinks(SL_link *linkedList) {
   if (linkedList == NULL) {
-    printf("警告：传入的链表指针无效，无内存可释放。\n");
+    SL_log(SL_LOG_WARN, "警告：传入的链表指针无效，无内存可释放。");
     return;
   }
 
   // 调用 freeLinkedListNodes() 释放所有节点
   SL_freeNodes(linkedList);
 
+  // 释放哈希索引
+  SL_freeIndex(linkedList->index);
+
+  // 释放私有节点池
+  if (linkedList->ownPool)
+    SL_freePool(linkedList->pool);
+
+  // 释放顺序存储
+  SV_freeVector(linkedList->vector);
+
   // 释放链表管理结构体本身（link）
   free(linkedList);
 
-  printf("链表管理结构体和所有节点内存已完全释放。\n");
+  SL_log(SL_LOG_INFO, "链表管理结构体和所有节点内存已完全释放。");
 }
 
 /** @} */ // 单向链表释放操作
@@ -1024,6 +2396,8 @@ void SL_freeLinks(SL_link *linkedList) {
  *         特殊情况：索引为链表长度时返回头节点，索引为1时返回尾节点
  */
 SL_node *fast_slow_find(SL_link *const linkedList, const uint32 findIndex) {
+  if (SL_rejectVector(linkedList))
+    return NULL;
   if (findIndex > linkedList->length || findIndex == 0)
     return NULL;
   else if (findIndex == linkedList->length)
@@ -1058,6 +2432,9 @@ SL_node *fast_slow_find(SL_link *const linkedList, const uint32 findIndex) {
  */
 SL_node *same_suffix(SL_link *const link1, SL_link *const link2,
                      uint32 *const count) {
+  if (SL_rejectVector(link1) || SL_rejectVector(link2))
+    return NULL;
+
   uint32 ca = link1->length - link2->length;
   ca = ((ca > 0) ? ca : -ca);
 
@@ -0,0 +1,923 @@
+/*
+ * @file dl_link.c
+ * @brief 双向链表实现文件
+ * @author ringtree
+ * @date 2025-09-28
+ * @version 1.0
+ *
+ * 本文件实现了 dl_link.h 中声明的 DL_* 函数。
+ * 所有修改操作都同时维护 prev / next 指针以及 headIndex、endIndex、length，
+ * 需要前驱节点的删除操作因此不再遍历链表。
+ */
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dl_link.h"
+#include "sl_log.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 基数排序每轮处理的位数（32位键分3轮：11 + 11 + 10）
+ */
+#define DL_RADIX_BITS 11
+#define DL_RADIX_BUCKETS (1u << DL_RADIX_BITS)
+#define DL_RADIX_PASSES 3
+
+/**
+ * @addtogroup 双向链表模块
+ * @{
+ */
+
+/**
+ * @brief 创建并初始化一个双向链表结构
+ *
+ * @return DL_link* 新的空双向链表，内存分配失败返回NULL
+ * @note 使用完毕后需调用 DL_freeLinks() 释放。
+ */
+DL_link *DL_inifLink(void) {
+  DL_link *cur = (DL_link *)malloc(sizeof(DL_link));
+  if (!cur) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  cur->headIndex = NULL;
+  cur->endIndex = NULL;
+  cur->length = 0;
+
+  return cur;
+}
+
+/**
+ * @brief 创建一个前驱、后继均为NULL的节点
+ *
+ * @param inputData 节点数据
+ * @return DL_node* 新节点，内存分配失败返回NULL
+ */
+static inline DL_node *DL_inifNode(const Elemtype inputData) {
+  DL_node *node = (DL_node *)malloc(sizeof(DL_node));
+  if (!node) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  node->data = inputData;
+  node->prev = NULL;
+  node->next = NULL;
+  return node;
+}
+
+/**
+ * @brief 把节点连接到 prev 与 prev 的后继之间
+ *
+ * @param linkedList 双向链表
+ * @param prev 前驱节点，为NULL时连接到头部
+ * @param node 待连接的节点
+ */
+static inline void DL_linkAfter(DL_link *const linkedList, DL_node *const prev,
+                                DL_node *const node) {
+  DL_node *next = prev ? prev->next : linkedList->headIndex;
+
+  node->prev = prev;
+  node->next = next;
+  if (prev)
+    prev->next = node;
+  else
+    linkedList->headIndex = node;
+  if (next)
+    next->prev = node;
+  else
+    linkedList->endIndex = node;
+
+  linkedList->length++;
+}
+
+/**
+ * @brief 把节点从链表中摘除并释放，返回节点数据
+ *
+ * @param linkedList 双向链表
+ * @param node 链表中的有效节点
+ * @return Elemtype 被删除节点的数据
+ */
+static inline Elemtype DL_unlink(DL_link *const linkedList,
+                                 DL_node *const node) {
+  if (node->prev)
+    node->prev->next = node->next;
+  else
+    linkedList->headIndex = node->next;
+  if (node->next)
+    node->next->prev = node->prev;
+  else
+    linkedList->endIndex = node->prev;
+
+  Elemtype outData = node->data;
+  linkedList->length--;
+  free(node);
+  return outData;
+}
+
+/**
+ * @brief 按 next 指针重建全部 prev 指针与尾指针
+ *
+ * 排序只按单向链表的方式调整 next 指针，结束后调用本函数一次遍历修复。
+ *
+ * @param linkedList 双向链表
+ */
+static void DL_relinkPrev(DL_link *const linkedList) {
+  DL_node *prev = NULL;
+  for (DL_node *cur = linkedList->headIndex; cur; cur = cur->next) {
+    cur->prev = prev;
+    prev = cur;
+  }
+  linkedList->endIndex = prev;
+}
+
+/**
+ * @defgroup 双向链表插入操作
+ * @brief 双向链表节点插入相关函数
+ * @{
+ */
+
+/**
+ * @brief 在双向链表头部插入一个新节点
+ *
+ * @param linkedList 双向链表指针
+ * @param inputData 要插入的数据
+ */
+void DL_insertHead(DL_link *const linkedList, const Elemtype inputData) {
+  DL_node *newNode = DL_inifNode(inputData);
+  if (newNode)
+    DL_linkAfter(linkedList, NULL, newNode);
+}
+
+/**
+ * @brief 在双向链表尾部插入一个新节点
+ *
+ * @param linkedList 双向链表指针
+ * @param inputData 要插入的数据
+ */
+void DL_add(DL_link *const linkedList, const Elemtype inputData) {
+  DL_node *newNode = DL_inifNode(inputData);
+  if (newNode)
+    DL_linkAfter(linkedList, linkedList->endIndex, newNode);
+}
+
+/**
+ * @brief 尾插法连续插入多个数据
+ *
+ * @param linkedList 双向链表指针
+ * @param count 插入的数据个数
+ * @param ... 可变参数列表，包含要插入的数据（int32类型）
+ */
+void DL_extind(DL_link *const linkedList, const uint32 count, ...) {
+  va_list args;
+  va_start(args, count);
+
+  for (uint32 i = 0; i < count; i++)
+    DL_add(linkedList, va_arg(args, int32));
+
+  va_end(args);
+}
+
+/**
+ * @brief 在双向链表的指定位置插入新节点
+ *
+ * 与 SL_insert 相同：索引为0时插入头部，索引大于等于链表长度时
+ * 经 SL_log() 报告错误。定位时从较近的一端开始遍历。
+ *
+ * @param linkedList 双向链表指针
+ * @param inputData 要插入的数据
+ * @param index 插入位置的索引（从0开始计数）
+ */
+void DL_insert(DL_link *const linkedList, const Elemtype inputData,
+               const uint32 index) {
+  if (!index) {
+    DL_insertHead(linkedList, inputData);
+    return;
+  } else if (index >= linkedList->length) {
+    SL_log(SL_LOG_ERROR, "Error: Index out of range");
+    return;
+  }
+
+  DL_insertBefore(linkedList, DL_getNode(linkedList, index), inputData);
+}
+
+/**
+ * @brief 在指定节点之后插入新节点，O(1)
+ *
+ * @param linkedList 双向链表指针
+ * @param prev 前驱节点，为NULL时插入到头部
+ * @param inputData 要插入的数据
+ * @return DL_node* 新节点，内存分配失败返回NULL
+ * @warning prev 必须是该双向链表中的有效节点。
+ */
+DL_node *DL_insertAfter(DL_link *const linkedList, DL_node *const prev,
+                        const Elemtype inputData) {
+  DL_node *newNode = DL_inifNode(inputData);
+  if (newNode)
+    DL_linkAfter(linkedList, prev, newNode);
+  return newNode;
+}
+
+/**
+ * @brief 在指定节点之前插入新节点，O(1)
+ *
+ * @param linkedList 双向链表指针
+ * @param next 后继节点，为NULL时插入到尾部
+ * @param inputData 要插入的数据
+ * @return DL_node* 新节点，内存分配失败返回NULL
+ * @warning next 必须是该双向链表中的有效节点。
+ */
+DL_node *DL_insertBefore(DL_link *const linkedList, DL_node *const next,
+                         const Elemtype inputData) {
+  return DL_insertAfter(linkedList, next ? next->prev : linkedList->endIndex,
+                        inputData);
+}
+
+/**
+ * @brief 由数组一次性构建双向链表
+ *
+ * @param array 源数据数组
+ * @param count 数组元素个数
+ * @return DL_link* 新链表指针，内存分配失败返回NULL
+ * @note 返回的链表需使用 DL_freeLinks() 释放。
+ */
+DL_link *DL_fromArray(const Elemtype *const array, const uint32 count) {
+  DL_link *linkedList = DL_inifLink();
+  if (!linkedList)
+    return NULL;
+
+  if (count && DL_appendArray(linkedList, array, count) != count) {
+    DL_freeLinks(linkedList);
+    return NULL;
+  }
+
+  return linkedList;
+}
+
+/**
+ * @brief 将数组中的数据批量追加到双向链表尾部
+ *
+ * @param linkedList 双向链表指针
+ * @param array 源数据数组
+ * @param count 数组元素个数
+ * @return uint32 实际追加的元素个数（内存分配失败时停止追加）
+ */
+uint32 DL_appendArray(DL_link *const linkedList, const Elemtype *const array,
+                      const uint32 count) {
+  if (linkedList == NULL || array == NULL)
+    return 0;
+
+  uint32 appended = 0;
+  for (; appended < count; appended++) {
+    DL_node *newNode = DL_inifNode(array[appended]);
+    if (!newNode)
+      break;
+    DL_linkAfter(linkedList, linkedList->endIndex, newNode);
+  }
+
+  return appended;
+}
+
+/** @} */ // 双向链表插入操作
+
+/**
+ * @defgroup 双向链表查找操作
+ * @brief 双向链表节点查找相关函数
+ * @{
+ */
+
+/**
+ * @brief 计算指定值在双向链表中出现的次数
+ *
+ * @param linkedList 双向链表指针
+ * @param findData 要查找的数据
+ * @return uint32 数据出现的次数
+ */
+uint32 DL_count(DL_link *const linkedList, const Elemtype findData) {
+  if (linkedList == NULL)
+    return 0;
+
+  uint32 count = 0;
+  for (DL_node *cur = linkedList->headIndex; cur; cur = cur->next)
+    count += cur->data == findData;
+
+  return count;
+}
+
+/**
+ * @brief 查找所有匹配数据的节点指针
+ *
+ * @param linkedList 双向链表指针
+ * @param findData 要查找的目标数据
+ * @param outCount 输出参数，返回匹配的节点数量
+ * @return DL_node** 匹配节点指针数组（未找到或内存分配失败时返回NULL）
+ * @note 调用者需使用 free() 释放返回的数组。返回的节点可直接传给
+ *       DL_deleteNode()，每次删除O(1)。
+ */
+DL_node **DL_find(DL_link *const linkedList, const Elemtype findData,
+                  uint32 *outCount) {
+  *outCount = 0;
+  if (linkedList == NULL)
+    return NULL;
+
+  uint32 capacity = 16; // 初始容量，不足时翻倍，但不超过链表长度
+  DL_node **result = NULL;
+
+  for (DL_node *cur = linkedList->headIndex; cur; cur = cur->next) {
+    if (cur->data != findData)
+      continue;
+
+    if (result == NULL || *outCount == capacity) {
+      if (result) // 匹配数不超过链表长度，翻倍前截断以防 uint32 溢出
+        capacity = capacity > linkedList->length / 2 ? linkedList->length
+                                                     : capacity * 2;
+      DL_node **grown = (DL_node **)realloc(
+          result, sizeof(DL_node *) * (size_t)capacity);
+      if (!grown) {
+        SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+        free(result);
+        *outCount = 0;
+        return NULL;
+      }
+      result = grown;
+    }
+    result[(*outCount)++] = cur;
+  }
+
+  return result;
+}
+
+/**
+ * @brief 查找数据第一次出现的下标
+ *
+ * @param linkedList 双向链表指针
+ * @param findData 要查找的数据
+ * @return uint32 下标（从0开始），未找到返回UINT32_MAX
+ */
+uint32 DL_getIndex(DL_link *const linkedList, const Elemtype findData) {
+  if (linkedList == NULL)
+    return UINT32_MAX;
+
+  uint32 index = 0;
+  for (DL_node *cur = linkedList->headIndex; cur; cur = cur->next, index++) {
+    if (cur->data == findData)
+      return index;
+  }
+
+  return UINT32_MAX;
+}
+
+/**
+ * @brief 获取指定下标的节点
+ *
+ * 下标位于前半段时从头部向后遍历，否则从尾部向前遍历，最多 length / 2 步。
+ *
+ * @param linkedList 双向链表指针
+ * @param index 节点下标（从0开始）
+ * @return DL_node* 对应节点，下标越界返回NULL
+ */
+DL_node *DL_getNode(DL_link *const linkedList, const uint32 index) {
+  if (linkedList == NULL || index >= linkedList->length)
+    return NULL;
+
+  DL_node *cur;
+  if (index < linkedList->length / 2) {
+    cur = linkedList->headIndex;
+    for (uint32 i = 0; i < index; i++)
+      cur = cur->next;
+  } else {
+    cur = linkedList->endIndex;
+    for (uint32 i = linkedList->length - 1; i > index; i--)
+      cur = cur->prev;
+  }
+
+  return cur;
+}
+
+/**
+ * @brief 求解约瑟夫环问题：从头部开始每数到第 n 个节点就删除该节点，
+ * 返回最后剩下节点的数据。
+ *
+ * 每次删除只需O(1)，步数按当前长度取模，
+ * 总时间复杂度为 O(m * min(n, m))，其中 m 为初始节点个数。
+ *
+ * @param link 双向链表指针（结束时只剩一个节点）
+ * @param n 每数到第 n 个节点时删除该节点，n 必须 >= 1
+ * @return uint32 最后剩下节点的数据；链表为空或 n 为0时返回UINT32_MAX
+ */
+uint32 DL_josephusSurvivor(DL_link *const link, uint32 n) {
+  if (link == NULL || link->length == 0 || n == 0) {
+    SL_log(SL_LOG_ERROR, "错误：链表为空或报数间隔为0");
+    return UINT32_MAX;
+  }
+
+  DL_node *cur = link->headIndex;
+  while (link->length > 1) {
+    uint32 steps = (n - 1) % link->length;
+    for (uint32 i = 0; i < steps; i++) // 单向推进模拟循环链表
+      cur = cur->next ? cur->next : link->headIndex;
+
+    DL_node *next = cur->next ? cur->next : link->headIndex;
+    DL_unlink(link, cur);
+    cur = next;
+  }
+
+  return link->headIndex->data;
+}
+
+/** @} */ // 双向链表查找操作
+
+/**
+ * @defgroup 双向链表修改操作
+ * @brief 双向链表修改相关函数
+ * @{
+ */
+
+/**
+ * @brief 对双向链表进行插入排序（支持升序 / 降序）
+ *
+ * 与数组插入排序相同：每个节点沿 prev 指针向前寻找插入位置，
+ * 已有序的输入只需O(n)，稳定排序。
+ *
+ * @param linkedList 双向链表指针
+ * @param way 排序方式：ASC（升序）或 DESC（降序）
+ */
+void DL_sort_Insertion(DL_link *const linkedList, enum sort way) {
+  if (linkedList == NULL || linkedList->length <= 1)
+    return;
+
+  DL_node *cur = linkedList->headIndex->next;
+  while (cur) {
+    DL_node *next = cur->next;
+    DL_node *pos = cur->prev;
+    while (pos && (way == ASC ? pos->data > cur->data
+                              : pos->data < cur->data))
+      pos = pos->prev;
+
+    if (pos != cur->prev) { // 需要移动：摘下后接到 pos 之后
+      cur->prev->next = cur->next;
+      if (cur->next)
+        cur->next->prev = cur->prev;
+      else
+        linkedList->endIndex = cur->prev;
+      linkedList->length--;
+      DL_linkAfter(linkedList, pos, cur);
+    }
+    cur = next;
+  }
+}
+
+/**
+ * @brief 从片段头部切下前 step 个节点（只处理 next 指针）
+ *
+ * @return DL_node* 剩余部分的头节点（不足 step 个节点时返回NULL）
+ */
+static inline DL_node *DL_cutRun(DL_node *head, uint32 step) {
+  for (; head && step > 1; step--)
+    head = head->next;
+  if (!head)
+    return NULL;
+
+  DL_node *rest = head->next;
+  head->next = NULL;
+  return rest;
+}
+
+/**
+ * @brief 稳定合并两个有序片段并接到 tail 之后（只处理 next 指针）
+ *
+ * @return DL_node* 合并结果的尾节点
+ */
+static inline DL_node *DL_mergeRuns(DL_node *left, DL_node *right,
+                                    DL_node *tail, enum sort way) {
+  while (left && right) {
+    if ((!way && left->data <= right->data) ||
+        (way && left->data >= right->data)) {
+      tail->next = left;
+      left = left->next;
+    } else {
+      tail->next = right;
+      right = right->next;
+    }
+    tail = tail->next;
+  }
+
+  tail->next = left ? left : right;
+  while (tail->next)
+    tail = tail->next;
+  return tail;
+}
+
+/**
+ * @brief 对双向链表进行归并排序（支持升序 / 降序）
+ *
+ * 与 SL_sort_Merge 相同的自底向上归并，排序过程只调整 next 指针，
+ * 结束后一次遍历重建 prev 指针。时间复杂度O(n log n)，稳定排序。
+ *
+ * @param linkedList 双向链表指针
+ * @param way 排序方式：ASC（升序）或 DESC（降序）
+ */
+void DL_sort_Merge(DL_link *const linkedList, enum sort way) {
+  if (linkedList == NULL || linkedList->length <= 1)
+    return;
+
+  DL_node dummy = {0, NULL, linkedList->headIndex}; // 栈上虚拟头节点
+
+  for (uint32 step = 1; step < linkedList->length; step <<= 1) {
+    DL_node *cur = dummy.next;
+    DL_node *tail = &dummy;
+    while (cur) {
+      DL_node *left = cur;
+      DL_node *right = DL_cutRun(left, step);
+      cur = DL_cutRun(right, step);
+      tail = DL_mergeRuns(left, right, tail, way);
+    }
+    if (step > UINT32_MAX / 2) // 防止 step 溢出
+      break;
+  }
+
+  linkedList->headIndex = dummy.next;
+  DL_relinkPrev(linkedList);
+}
+
+/**
+ * @brief 对双向链表进行基数排序（支持升序 / 降序）
+ *
+ * 与 SL_sort_Radix 相同的 LSD 基数排序（11/11/10位三轮，同桶轮次跳过），
+ * 按排好的顺序重新连接 prev / next 指针。时间复杂度O(n)，稳定排序。
+ *
+ * @param linkedList 双向链表指针
+ * @param way 排序方式：ASC（升序）或 DESC（降序）
+ * @note 临时分配约 24 * length 字节，分配失败时退回 DL_sort_Merge()。
+ */
+void DL_sort_Radix(DL_link *const linkedList, enum sort way) {
+  if (linkedList == NULL || linkedList->length <= 1)
+    return;
+
+  uint32 n = linkedList->length;
+  DL_node **nodes = (DL_node **)malloc(sizeof(DL_node *) * n);
+  uint64 *items = (uint64 *)malloc(sizeof(uint64) * n);
+  uint64 *buffer = (uint64 *)malloc(sizeof(uint64) * n);
+  if (!(nodes && items && buffer)) {
+    free(nodes);
+    free(items);
+    free(buffer);
+    DL_sort_Merge(linkedList, way);
+    return;
+  }
+
+  // 元素高32位为排序键，低32位为节点下标
+  uint32 flip = way ? 0x7FFFFFFFu : 0x80000000u; // 降序：翻转符号位后再取反
+  DL_node *cur = linkedList->headIndex;
+  for (uint32 i = 0; i < n; i++, cur = cur->next) {
+    nodes[i] = cur;
+    items[i] = ((uint64)((uint32)cur->data ^ flip) << 32) | i;
+  }
+
+  uint32 hist[DL_RADIX_BUCKETS];
+  for (uint32 p = 0; p < DL_RADIX_PASSES; p++) {
+    uint32 shift = 32 + p * DL_RADIX_BITS;
+    memset(hist, 0, sizeof(hist));
+    for (uint32 i = 0; i < n; i++)
+      hist[(items[i] >> shift) & (DL_RADIX_BUCKETS - 1)]++;
+    if (hist[(items[0] >> shift) & (DL_RADIX_BUCKETS - 1)] == n)
+      continue; // 本轮所有元素同桶，无需分发
+
+    uint32 offset = 0;
+    for (uint32 b = 0; b < DL_RADIX_BUCKETS; b++) {
+      uint32 count = hist[b];
+      hist[b] = offset;
+      offset += count;
+    }
+    for (uint32 i = 0; i < n; i++)
+      buffer[hist[(items[i] >> shift) & (DL_RADIX_BUCKETS - 1)]++] = items[i];
+
+    uint64 *temp = items;
+    items = buffer;
+    buffer = temp;
+  }
+
+  // 按排序结果重新连接节点
+  DL_node *prev = NULL;
+  for (uint32 i = 0; i < n; i++) {
+    DL_node *node = nodes[(uint32)items[i]];
+    node->prev = prev;
+    if (prev)
+      prev->next = node;
+    else
+      linkedList->headIndex = node;
+    prev = node;
+  }
+  prev->next = NULL;
+  linkedList->endIndex = prev;
+
+  free(nodes);
+  free(items);
+  free(buffer);
+}
+
+/**
+ * @brief 反转双向链表（交换每个节点的 prev / next 指针）
+ *
+ * @param linked 双向链表指针
+ * @return uint16 反转成功返回1；链表为空或只有一个节点时返回0
+ */
+uint16 DL_reverse(DL_link *const linked) {
+  if (linked == NULL || linked->length <= 1)
+    return 0;
+
+  for (DL_node *cur = linked->headIndex; cur; cur = cur->prev) {
+    DL_node *temp = cur->next;
+    cur->next = cur->prev;
+    cur->prev = temp;
+  }
+
+  DL_node *temp = linked->headIndex;
+  linked->headIndex = linked->endIndex;
+  linked->endIndex = temp;
+
+  return 1;
+}
+
+/** @} */ // 双向链表修改操作
+
+/**
+ * @defgroup 双向链表删除操作
+ * @brief 双向链表节点删除相关函数
+ * @{
+ */
+
+/**
+ * @brief 删除双向链表的头节点
+ *
+ * @param linkedList 双向链表指针
+ * @return Elemtype 被删除节点的数据；链表为空时返回UINT32_MAX
+ */
+Elemtype DL_delHead(DL_link *const linkedList) {
+  if (linkedList->length == 0) {
+    SL_log(SL_LOG_ERROR, "错误：双向链表为空，无法删除头节点");
+    return UINT32_MAX;
+  }
+
+  return DL_unlink(linkedList, linkedList->headIndex);
+}
+
+/**
+ * @brief 删除双向链表的尾节点
+ *
+ * 尾节点的 prev 指针直接给出新的尾节点，时间复杂度O(1)。
+ *
+ * @param linkedList 双向链表指针
+ * @return Elemtype 被删除节点的数据；链表为空时返回UINT32_MAX
+ */
+Elemtype DL_delEnd(DL_link *const linkedList) {
+  if (linkedList->length == 0) {
+    SL_log(SL_LOG_ERROR, "错误：双向链表为空，无法删除尾节点");
+    return UINT32_MAX;
+  }
+
+  return DL_unlink(linkedList, linkedList->endIndex);
+}
+
+/**
+ * @brief 从双向链表中删除指定节点，O(1)
+ *
+ * @param linkedList 双向链表指针
+ * @param node 待删除的节点
+ * @return Elemtype 被删除节点的数据；链表为空或节点为NULL时返回UINT32_MAX
+ * @warning 传入的节点必须是该双向链表中的有效节点，函数不再遍历校验。
+ */
+Elemtype DL_deleteNode(DL_link *const linkedList, DL_node *const node) {
+  if (linkedList->length == 0) {
+    SL_log(SL_LOG_ERROR, "错误：双向链表为空，无法删除节点");
+    return UINT32_MAX;
+  }
+  if (node == NULL) {
+    SL_log(SL_LOG_ERROR, "传入的节点指针为NULL");
+    return UINT32_MAX;
+  }
+
+  return DL_unlink(linkedList, node);
+}
+
+/**
+ * @brief 删除指定下标的节点（从较近的一端定位）
+ *
+ * @param linkedList 双向链表指针
+ * @param index 待删除节点的下标（从0开始）
+ * @return Elemtype 被删除节点的数据；链表为空或下标越界时返回UINT32_MAX
+ */
+Elemtype DL_deleteIndex(DL_link *const linkedList, const uint32 index) {
+  if (linkedList->length == 0) {
+    SL_log(SL_LOG_ERROR, "双向链表为空，无法删除索引 %u 的节点", index);
+    return UINT32_MAX;
+  }
+  if (index >= linkedList->length) {
+    SL_log(SL_LOG_ERROR, "错误：索引 %u 越界(双向链表长度为 %u)", index,
+           linkedList->length);
+    return UINT32_MAX;
+  }
+
+  return DL_unlink(linkedList, DL_getNode(linkedList, index));
+}
+
+/**
+ * @brief 删除双向链表中指定数据的目标匹配项
+ *
+ * 与 SL_deleteData 语义相同：
+ * - deleteCount = 0：删除所有匹配的节点；
+ * - deleteCount > 0：删除第 deleteCount 个匹配的节点（从1开始计数）。
+ *
+ * @param linkedList 双向链表指针
+ * @param targetData 待删除的目标数据
+ * @param deleteCount 删除模式，见上
+ * @return Elemtype 删除成功返回 targetData；未找到匹配项返回UINT32_MAX
+ */
+Elemtype DL_deleteData(DL_link *const linkedList, const Elemtype targetData,
+                       const uint32 deleteCount) {
+  if (linkedList->length == 0) {
+    SL_log(SL_LOG_ERROR, "双向链表为空，无法删除数据 %d", targetData);
+    return UINT32_MAX;
+  }
+
+  uint32 matchIndex = 0;
+  uint32 deleted = 0;
+  DL_node *cur = linkedList->headIndex;
+  while (cur) {
+    DL_node *next = cur->next;
+    if (cur->data == targetData &&
+        (deleteCount == 0 || ++matchIndex == deleteCount)) {
+      DL_unlink(linkedList, cur);
+      deleted++;
+      if (deleteCount > 0)
+        break;
+    }
+    cur = next;
+  }
+
+  if (deleted)
+    return targetData;
+
+  if (deleteCount > 0)
+    SL_log(SL_LOG_ERROR, "错误：未找到第 %u 个数据为 %d 的节点", deleteCount,
+           targetData);
+  else
+    SL_log(SL_LOG_ERROR, "错误：双向链表中未找到数据为 %d 的节点", targetData);
+  return UINT32_MAX;
+}
+
+/** @} */ // 双向链表删除操作
+
+/**
+ * @defgroup 双向链表遍历操作
+ * @brief 双向链表遍历相关函数
+ * @{
+ */
+
+/**
+ * @brief 从头到尾打印所有节点的数据（每20个数据换行）
+ *
+ * @param linkedList 双向链表指针
+ * @return uint32 双向链表的当前长度
+ */
+uint32 DL_traverseLink(DL_link *const linkedList) {
+  uint32 number = 0;
+  for (DL_node *cur = linkedList->headIndex; cur; cur = cur->next, number++) {
+    if (number && number % 20 == 0)
+      printf("\n");
+    printf("%d\t", cur->data);
+  }
+  printf("\n");
+
+  return linkedList->length;
+}
+
+/**
+ * @brief 从尾到头打印所有节点的数据（每20个数据换行）
+ *
+ * @param linkedList 双向链表指针
+ * @return uint32 双向链表的当前长度
+ */
+uint32 DL_traverseReverse(DL_link *const linkedList) {
+  uint32 number = 0;
+  for (DL_node *cur = linkedList->endIndex; cur; cur = cur->prev, number++) {
+    if (number && number % 20 == 0)
+      printf("\n");
+    printf("%d\t", cur->data);
+  }
+  printf("\n");
+
+  return linkedList->length;
+}
+
+/**
+ * @brief 将双向链表中的数据按顺序导出到数组
+ *
+ * @param linkedList 双向链表指针
+ * @param outArray 输出数组，由调用者分配
+ * @param capacity 输出数组容量（元素个数）
+ * @return uint32 实际写入的元素个数
+ */
+uint32 DL_toArray(DL_link *const linkedList, Elemtype *const outArray,
+                  const uint32 capacity) {
+  if (linkedList == NULL || outArray == NULL)
+    return 0;
+
+  uint32 count = 0;
+  for (DL_node *cur = linkedList->headIndex; cur && count < capacity;
+       cur = cur->next)
+    outArray[count++] = cur->data;
+
+  return count;
+}
+
+/** @} */ // 双向链表遍历操作
+
+/**
+ * @defgroup 双向链表释放操作
+ * @brief 释放双向链表所占内存
+ * @{
+ */
+
+/**
+ * @brief 释放链表中的所有节点（不释放 DL_link 结构体本身）
+ *
+ * @param linkedList 双向链表指针
+ */
+void DL_freeNodes(DL_link *const linkedList) {
+  if (linkedList == NULL) {
+    SL_log(SL_LOG_WARN, "警告：传入的链表指针为 NULL，无节点可释放。");
+    return;
+  }
+
+  DL_node *cur = linkedList->headIndex;
+  while (cur) {
+    DL_node *next = cur->next;
+    free(cur);
+    cur = next;
+  }
+
+  linkedList->headIndex = NULL;
+  linkedList->endIndex = NULL;
+  linkedList->length = 0;
+
+  SL_log(SL_LOG_INFO, "链表所有节点内存已释放。");
+}
+
+/**
+ * @brief 完全释放整个链表，包括所有节点与链表管理结构体
+ *
+ * @param linkedList 双向链表指针
+ */
+void DL_freeLinks(DL_link *linkedList) {
+  if (linkedList == NULL) {
+    SL_log(SL_LOG_WARN, "警告：传入的链表指针无效，无内存可释放。");
+    return;
+  }
+
+  DL_freeNodes(linkedList);
+  free(linkedList);
+
+  SL_log(SL_LOG_INFO, "链表管理结构体和所有节点内存已完全释放。");
+}
+
+/** @} */ // 双向链表释放操作
+
+/**
+ * @defgroup 双向链表其它操作
+ * @brief 双向链表其它操作相关函数
+ * @{
+ */
+
+/**
+ * @brief 查找两个双向链表数据相同的最长后缀
+ *
+ * 从两个链表的尾节点同时沿 prev 指针向前比较，无需对齐长度。
+ *
+ * @param link1 第一个双向链表
+ * @param link2 第二个双向链表
+ * @param count 输出参数，返回相同后缀的长度
+ * @return DL_node* link1 中相同后缀的第一个节点，没有相同后缀时返回NULL
+ */
+DL_node *DL_sameSuffix(DL_link *const link1, DL_link *const link2,
+                       uint32 *const count) {
+  *count = 0;
+  DL_node *a = link1->endIndex;
+  DL_node *b = link2->endIndex;
+  DL_node *first = NULL;
+
+  for (; a && b && a->data == b->data; a = a->prev, b = b->prev) {
+    first = a;
+    (*count)++;
+  }
+
+  return first;
+}
+
+/** @} */ // 双向链表其它操作
+
+/** @} */ // 双向链表模块
@@ -1,15 +1,20 @@
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "data_struct.h"
 #include "main.h"
 #include "other.h"
 
 int main(int argc, char *argv[]) {
+#ifdef _WIN32
 //   SetConsoleCP(65001);
 //   SetConsoleOutputCP(65001);
   system("chcp 65001");
   system("cls");
+#endif
 
 
   return 0;
@@ -23,6 +23,36 @@ void SL_randLink(SL_link *const link, const uint32 len, const int32 min,
 }
 
 
+/**
+ * @brief 按指定对齐方式分配内存
+ *
+ * @param size 分配字节数
+ * @param alignment 对齐字节数（2的幂，且为 sizeof(void*) 的倍数）
+ * @return void* 对齐的内存首地址，分配失败返回NULL
+ * @note 返回的内存必须使用 SL_alignedFree() 释放。
+ */
+void *SL_alignedAlloc(const size_t size, const size_t alignment) {
+#ifdef _WIN32
+  return _aligned_malloc(size, alignment);
+#else
+  // aligned_alloc 要求 size 为 alignment 的整数倍
+  return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+/**
+ * @brief 释放 SL_alignedAlloc() 分配的内存
+ *
+ * @param ptr 内存首地址，传入NULL时不做任何操作
+ */
+void SL_alignedFree(void *ptr) {
+#ifdef _WIN32
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
 /*
 n % (max- min + 1)
 
@@ -0,0 +1,530 @@
+/*
+ * @file sl_clist.c
+ * @brief 并发有序链表实现文件
+ * @author ringtree
+ * @date 2025-09-25
+ * @version 1.0
+ *
+ * 本文件实现了 sl_clist.h 中声明的三种同步策略。风险指针槽位用法：
+ * - CL_LAZY     ：槽位0 为前驱节点，槽位1 为当前节点；
+ * - CL_LOCKFREE ：槽位0 为后继节点，槽位1 为当前节点，槽位2 为前驱节点。
+ * 校验失败（读取到的节点已被其他线程摘除）时从头哨兵重新遍历。
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "sl_clist.h"
+#include "sl_log.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief next 指针最低位的删除标记（CL_LOCKFREE）
+ */
+#define CL_MARK(ptr) ((CL_node *)((uintptr_t)(ptr) | (uintptr_t)1))
+#define CL_UNMARK(ptr) ((CL_node *)((uintptr_t)(ptr) & ~(uintptr_t)1))
+#define CL_IS_MARKED(ptr) ((uintptr_t)(ptr) & (uintptr_t)1)
+
+/**
+ * @brief 查找结果：data 应处的位置
+ */
+typedef struct CL_window {
+  _Atomic(CL_node *) *prev; ///< 前驱节点的 next 域
+  CL_node *pred;            ///< 前驱节点（可能为头哨兵）
+  CL_node *cur;             ///< 第一个 >= data 的节点，不存在时为NULL
+} CL_window;
+
+/**
+ * @addtogroup 并发有序链表
+ * @{
+ */
+
+/**
+ * @brief 创建新节点
+ *
+ * @param data 节点数据
+ * @return CL_node* 新节点，内存分配失败返回NULL
+ */
+static CL_node *CL_inifNode(const Elemtype data) {
+  CL_node *node = (CL_node *)malloc(sizeof(CL_node));
+  if (!node) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+  node->data = data;
+  atomic_init(&node->next, NULL);
+  atomic_init(&node->marked, 0);
+  pthread_mutex_init(&node->lock, NULL);
+  return node;
+}
+
+/**
+ * @brief 释放节点（同时作为风险指针域的回收函数）
+ */
+static void CL_freeNode(void *ptr) {
+  CL_node *node = (CL_node *)ptr;
+  pthread_mutex_destroy(&node->lock);
+  free(node);
+}
+
+/**
+ * @brief 解锁查找窗口中的前驱与当前节点
+ */
+static void CL_unlockWindow(const CL_window *const window) {
+  if (window->cur)
+    pthread_mutex_unlock(&window->cur->lock);
+  pthread_mutex_unlock(&window->pred->lock);
+}
+
+/*
+ * ---------------------------------------------------------------
+ * CL_COUPLING：手递手加锁
+ * ---------------------------------------------------------------
+ */
+
+/**
+ * @brief 手递手加锁查找 data 的位置，返回时持有前驱与当前节点的锁
+ */
+static void CL_couplingLocate(CL_list *const list, const Elemtype data,
+                              CL_window *const window) {
+  CL_node *pred = list->head;
+  pthread_mutex_lock(&pred->lock);
+  CL_node *cur = atomic_load(&pred->next);
+  if (cur)
+    pthread_mutex_lock(&cur->lock);
+
+  while (cur && cur->data < data) {
+    pthread_mutex_unlock(&pred->lock);
+    pred = cur;
+    cur = atomic_load(&cur->next);
+    if (cur)
+      pthread_mutex_lock(&cur->lock);
+  }
+
+  window->pred = pred;
+  window->cur = cur;
+}
+
+static uint16 CL_couplingInsert(CL_list *const list, const Elemtype data) {
+  CL_window window;
+  CL_couplingLocate(list, data, &window);
+  if (window.cur && window.cur->data == data) {
+    CL_unlockWindow(&window);
+    return 0;
+  }
+
+  CL_node *node = CL_inifNode(data);
+  if (node) {
+    atomic_store(&node->next, window.cur);
+    atomic_store(&window.pred->next, node);
+  }
+  CL_unlockWindow(&window);
+  return node != NULL;
+}
+
+static uint16 CL_couplingDelete(CL_list *const list, const Elemtype data) {
+  CL_window window;
+  CL_couplingLocate(list, data, &window);
+  if (!window.cur || window.cur->data != data) {
+    CL_unlockWindow(&window);
+    return 0;
+  }
+
+  atomic_store(&window.pred->next, atomic_load(&window.cur->next));
+  CL_unlockWindow(&window);
+  // 等待 cur 锁的线程必然持有 pred 锁，此时已无其他线程能到达 cur
+  CL_freeNode(window.cur);
+  return 1;
+}
+
+static uint16 CL_couplingContains(CL_list *const list, const Elemtype data) {
+  CL_window window;
+  CL_couplingLocate(list, data, &window);
+  uint16 found = window.cur && window.cur->data == data;
+  CL_unlockWindow(&window);
+  return found;
+}
+
+/*
+ * ---------------------------------------------------------------
+ * CL_LAZY：惰性链表
+ * ---------------------------------------------------------------
+ */
+
+/**
+ * @brief 不加锁遍历一次，查找 data 的位置
+ *
+ * @return uint16 成功返回1；途中前驱节点已被删除时返回0，需从头重试
+ */
+static uint16 CL_lazyTryLocate(CL_list *const list, SL_hpRecord *const record,
+                               const Elemtype data, CL_window *const window) {
+  CL_node *pred = list->head;
+  CL_node *cur = atomic_load(&pred->next);
+  SL_hpSet(record, 1, cur);
+  if (atomic_load(&pred->next) != cur)
+    return 0;
+
+  while (cur && cur->data < data) {
+    SL_hpSet(record, 0, cur);
+    pred = cur;
+    cur = atomic_load(&pred->next);
+    SL_hpSet(record, 1, cur);
+    // pred 未被删除且仍指向 cur，说明登记风险指针时 cur 尚未被回收
+    if (atomic_load(&pred->marked) || atomic_load(&pred->next) != cur)
+      return 0;
+  }
+
+  window->pred = pred;
+  window->cur = cur;
+  return 1;
+}
+
+static void CL_lazyLocate(CL_list *const list, SL_hpRecord *const record,
+                          const Elemtype data, CL_window *const window) {
+  while (!CL_lazyTryLocate(list, record, data, window))
+    ;
+}
+
+/**
+ * @brief 加锁后校验窗口仍然有效
+ */
+static uint16 CL_lazyValidate(const CL_window *const window) {
+  return !atomic_load(&window->pred->marked) &&
+         (window->cur == NULL || !atomic_load(&window->cur->marked)) &&
+         atomic_load(&window->pred->next) == window->cur;
+}
+
+/**
+ * @brief 加锁查找窗口，校验失败时解锁并重新查找
+ */
+static void CL_lazyLock(CL_list *const list, SL_hpRecord *const record,
+                        const Elemtype data, CL_window *const window) {
+  for (;;) {
+    CL_lazyLocate(list, record, data, window);
+    pthread_mutex_lock(&window->pred->lock);
+    if (window->cur)
+      pthread_mutex_lock(&window->cur->lock);
+    if (CL_lazyValidate(window))
+      return;
+    CL_unlockWindow(window);
+  }
+}
+
+static uint16 CL_lazyInsert(CL_list *const list, SL_hpRecord *const record,
+                            const Elemtype data) {
+  CL_window window;
+  CL_lazyLock(list, record, data, &window);
+
+  CL_node *node = NULL;
+  if (!window.cur || window.cur->data != data) {
+    node = CL_inifNode(data);
+    if (node) {
+      atomic_store(&node->next, window.cur);
+      atomic_store(&window.pred->next, node);
+    }
+  }
+  CL_unlockWindow(&window);
+  SL_hpClear(record);
+  return node != NULL;
+}
+
+static uint16 CL_lazyDelete(CL_list *const list, SL_hpRecord *const record,
+                            const Elemtype data) {
+  CL_window window;
+  CL_lazyLock(list, record, data, &window);
+
+  uint16 found = window.cur && window.cur->data == data;
+  if (found) {
+    atomic_store(&window.cur->marked, 1); // 先逻辑删除，再摘链
+    atomic_store(&window.pred->next, atomic_load(&window.cur->next));
+  }
+  CL_unlockWindow(&window);
+  if (found)
+    SL_hpRetire(list->hp, record, window.cur);
+  SL_hpClear(record);
+  return found;
+}
+
+static uint16 CL_lazyContains(CL_list *const list, SL_hpRecord *const record,
+                              const Elemtype data) {
+  CL_window window;
+  CL_lazyLocate(list, record, data, &window);
+  uint16 found = window.cur && window.cur->data == data &&
+                 !atomic_load(&window.cur->marked);
+  SL_hpClear(record);
+  return found;
+}
+
+/*
+ * ---------------------------------------------------------------
+ * CL_LOCKFREE：Harris-Michael 无锁链表
+ * ---------------------------------------------------------------
+ */
+
+/**
+ * @brief 查找 data 的位置，顺带摘除途中遇到的已标记节点
+ *
+ * @return uint16 找到 data 返回1，否则返回0
+ */
+static uint16 CL_harrisFind(CL_list *const list, SL_hpRecord *const record,
+                            const Elemtype data, CL_window *const window) {
+  for (;;) { // 校验失败时从头重试
+    CL_node *pred = list->head;
+    _Atomic(CL_node *) *prev = &pred->next;
+    CL_node *cur = atomic_load(prev);
+    SL_hpSet(record, 1, cur);
+    if (atomic_load(prev) != cur)
+      continue;
+
+    for (;;) {
+      if (cur == NULL) {
+        window->prev = prev;
+        window->pred = pred;
+        window->cur = NULL;
+        return 0;
+      }
+
+      CL_node *next = atomic_load(&cur->next);
+      SL_hpSet(record, 0, CL_UNMARK(next));
+      // *prev 带标记位比较：pred 被删除时同样校验失败
+      if (atomic_load(&cur->next) != next || atomic_load(prev) != cur)
+        break;
+
+      if (!CL_IS_MARKED(next)) {
+        if (cur->data >= data) {
+          window->prev = prev;
+          window->pred = pred;
+          window->cur = cur;
+          return cur->data == data;
+        }
+        SL_hpSet(record, 2, cur);
+        pred = cur;
+        prev = &cur->next;
+      } else {
+        CL_node *expected = cur;
+        if (!atomic_compare_exchange_strong(prev, &expected, CL_UNMARK(next)))
+          break;
+        SL_hpRetire(list->hp, record, cur);
+      }
+
+      cur = CL_UNMARK(next);
+      SL_hpSet(record, 1, cur);
+    }
+  }
+}
+
+static uint16 CL_harrisInsert(CL_list *const list, SL_hpRecord *const record,
+                              const Elemtype data) {
+  CL_node *node = NULL;
+  CL_window window;
+
+  for (;;) {
+    if (CL_harrisFind(list, record, data, &window)) {
+      if (node)
+        CL_freeNode(node);
+      SL_hpClear(record);
+      return 0;
+    }
+
+    if (!node && !(node = CL_inifNode(data))) {
+      SL_hpClear(record);
+      return 0;
+    }
+    atomic_store(&node->next, window.cur);
+    CL_node *expected = window.cur;
+    if (atomic_compare_exchange_strong(window.prev, &expected, node)) {
+      SL_hpClear(record);
+      return 1;
+    }
+  }
+}
+
+static uint16 CL_harrisDelete(CL_list *const list, SL_hpRecord *const record,
+                              const Elemtype data) {
+  CL_window window;
+
+  for (;;) {
+    if (!CL_harrisFind(list, record, data, &window)) {
+      SL_hpClear(record);
+      return 0;
+    }
+
+    CL_node *next = atomic_load(&window.cur->next);
+    if (CL_IS_MARKED(next))
+      continue; // 已被其他线程逻辑删除，重新查找
+    if (!atomic_compare_exchange_strong(&window.cur->next, &next,
+                                        CL_MARK(next)))
+      continue;
+
+    CL_node *expected = window.cur;
+    if (atomic_compare_exchange_strong(window.prev, &expected, next))
+      SL_hpRetire(list->hp, record, window.cur);
+    else
+      CL_harrisFind(list, record, data, &window); // 由查找过程摘除
+
+    SL_hpClear(record);
+    return 1;
+  }
+}
+
+static uint16 CL_harrisContains(CL_list *const list, SL_hpRecord *const record,
+                                const Elemtype data) {
+  CL_window window;
+  uint16 found = CL_harrisFind(list, record, data, &window);
+  SL_hpClear(record);
+  return found;
+}
+
+/*
+ * ---------------------------------------------------------------
+ * 公共接口
+ * ---------------------------------------------------------------
+ */
+
+/**
+ * @brief 创建空的并发有序链表
+ *
+ * @param mode 同步策略
+ * @return CL_list* 新链表，内存分配失败返回NULL
+ */
+CL_list *CL_inifList(const enum CL_mode mode) {
+  CL_list *list = (CL_list *)malloc(sizeof(CL_list));
+  CL_node *head = CL_inifNode(0);
+  SL_hpDomain *hp = SL_inifHpDomain(CL_freeNode);
+  if (!list || !head || !hp) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    free(list);
+    if (head)
+      CL_freeNode(head);
+    SL_freeHpDomain(hp);
+    return NULL;
+  }
+
+  list->mode = mode;
+  list->head = head;
+  list->hp = hp;
+  return list;
+}
+
+/**
+ * @brief 为当前线程取得访问链表所需的线程记录
+ *
+ * @param list 并发有序链表
+ * @return SL_hpRecord* 线程记录，线程数超过 SL_HP_MAX_THREADS 时返回NULL
+ * @note CL_COUPLING 不使用风险指针，但为了接口一致同样需要线程记录。
+ */
+SL_hpRecord *CL_attach(CL_list *const list) { return SL_hpAcquire(list->hp); }
+
+/**
+ * @brief 归还线程记录
+ *
+ * @param list 并发有序链表
+ * @param record CL_attach() 返回的线程记录
+ */
+void CL_detach(CL_list *const list, SL_hpRecord *const record) {
+  SL_hpRelease(list->hp, record);
+}
+
+/**
+ * @brief 按升序插入数据（SL_insert 的并发版本）
+ *
+ * @param list 并发有序链表
+ * @param record 当前线程的记录
+ * @param data 要插入的数据
+ * @return uint16 插入成功返回1；数据已存在或内存分配失败返回0
+ */
+uint16 CL_insert(CL_list *const list, SL_hpRecord *const record,
+                 const Elemtype data) {
+  switch (list->mode) {
+  case CL_COUPLING:
+    return CL_couplingInsert(list, data);
+  case CL_LAZY:
+    return CL_lazyInsert(list, record, data);
+  default:
+    return CL_harrisInsert(list, record, data);
+  }
+}
+
+/**
+ * @brief 删除指定数据（SL_deleteData 的并发版本）
+ *
+ * @param list 并发有序链表
+ * @param record 当前线程的记录
+ * @param data 要删除的数据
+ * @return uint16 删除成功返回1，数据不存在返回0
+ */
+uint16 CL_deleteData(CL_list *const list, SL_hpRecord *const record,
+                     const Elemtype data) {
+  switch (list->mode) {
+  case CL_COUPLING:
+    return CL_couplingDelete(list, data);
+  case CL_LAZY:
+    return CL_lazyDelete(list, record, data);
+  default:
+    return CL_harrisDelete(list, record, data);
+  }
+}
+
+/**
+ * @brief 判断数据是否存在（SL_getIndex 的并发版本）
+ *
+ * 并发修改下节点下标没有意义，因此只返回是否存在。
+ * CL_LAZY 与 CL_LOCKFREE 的查找不加锁。
+ *
+ * @param list 并发有序链表
+ * @param record 当前线程的记录
+ * @param data 要查找的数据
+ * @return uint16 存在返回1，否则返回0
+ */
+uint16 CL_contains(CL_list *const list, SL_hpRecord *const record,
+                   const Elemtype data) {
+  switch (list->mode) {
+  case CL_COUPLING:
+    return CL_couplingContains(list, data);
+  case CL_LAZY:
+    return CL_lazyContains(list, record, data);
+  default:
+    return CL_harrisContains(list, record, data);
+  }
+}
+
+/**
+ * @brief 统计链表中的元素个数（不计已逻辑删除的节点）
+ *
+ * @param list 并发有序链表
+ * @return uint32 元素个数
+ * @warning 只在没有其他线程修改链表时结果准确。
+ */
+uint32 CL_length(CL_list *const list) {
+  uint32 length = 0;
+  CL_node *cur = CL_UNMARK(atomic_load(&list->head->next));
+  while (cur) {
+    CL_node *next = atomic_load(&cur->next);
+    if (!CL_IS_MARKED(next) && !atomic_load(&cur->marked))
+      length++;
+    cur = CL_UNMARK(next);
+  }
+  return length;
+}
+
+/**
+ * @brief 释放链表、剩余节点及所有待回收节点
+ *
+ * @param list 并发有序链表，传入NULL时直接返回
+ * @warning 调用时所有线程都必须已停止访问该链表。
+ */
+void CL_freeList(CL_list *list) {
+  if (list == NULL)
+    return;
+
+  CL_node *cur = list->head;
+  while (cur) {
+    CL_node *next = CL_UNMARK(atomic_load(&cur->next));
+    CL_freeNode(cur);
+    cur = next;
+  }
+
+  SL_freeHpDomain(list->hp);
+  free(list);
+}
+
+/** @} */ // 并发有序链表
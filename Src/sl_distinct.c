@@ -0,0 +1,288 @@
+/*
+ * @file sl_distinct.c
+ * @brief 单向链表去重实现文件
+ * @author ringtree
+ * @date 2025-09-29
+ * @version 1.0
+ *
+ * 本文件实现了 sl_distinct.h 中声明的去重操作。
+ * 所有实现先把数据转换为32位无符号键：
+ * - 原值模式翻转符号位，使无符号顺序与有符号顺序一致；
+ * - 绝对值模式直接取绝对值（INT32_MIN 的绝对值 2^31 仍可表示）。
+ * 输出按每个键第一次出现的顺序排列，与所选实现无关。
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sl_distinct.h"
+#include "sl_log.h"
+#include "sl_vector.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 基数排序每轮处理的位数（32位键分3轮：11 + 11 + 10）
+ */
+#define SL_DISTINCT_RADIX_BITS 11
+#define SL_DISTINCT_RADIX_BUCKETS (1u << SL_DISTINCT_RADIX_BITS)
+#define SL_DISTINCT_RADIX_PASSES 3
+
+/**
+ * @addtogroup 单向链表去重
+ * @{
+ */
+
+/**
+ * @brief 把数据转换为去重键
+ */
+static inline uint32 SL_distinctKey(const Elemtype data, enum distinct mode) {
+  if (mode == DISTINCT_ABS)
+    return data < 0 ? 0u - (uint32)data : (uint32)data;
+  return (uint32)data ^ 0x80000000u;
+}
+
+/**
+ * @brief 把去重键还原为输出数据
+ */
+static inline Elemtype SL_distinctValue(const uint32 key, enum distinct mode) {
+  return (Elemtype)(mode == DISTINCT_ABS ? key : key ^ 0x80000000u);
+}
+
+/**
+ * @brief 位图去重：取值范围 [minKey, minKey + range) 内每个键占1位
+ *
+ * @return uint32 不同键的个数，内存分配失败返回UINT32_MAX
+ */
+static uint32 SL_distinctBitset(const uint32 *const keys, const uint32 n,
+                                const uint32 minKey, const uint64 range,
+                                enum distinct mode, Elemtype *const out) {
+  uint64 *bits = (uint64 *)calloc((size_t)((range + 63) / 64), sizeof(uint64));
+  if (!bits) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return UINT32_MAX;
+  }
+
+  uint32 count = 0;
+  for (uint32 i = 0; i < n; i++) {
+    uint32 offset = keys[i] - minKey;
+    uint64 mask = 1ull << (offset & 63);
+    if (!(bits[offset >> 6] & mask)) {
+      bits[offset >> 6] |= mask;
+      out[count++] = SL_distinctValue(keys[i], mode);
+    }
+  }
+
+  free(bits);
+  return count;
+}
+
+/**
+ * @brief 哈希集合去重：Fibonacci 哈希 + 线性探测，负载因子不超过 1/2
+ *
+ * 槽位高32位为占用标记，低32位为键，0 表示空槽。
+ *
+ * @return uint32 不同键的个数，内存分配失败返回UINT32_MAX
+ */
+static uint32 SL_distinctHash(const uint32 *const keys, const uint32 n,
+                              enum distinct mode, Elemtype *const out) {
+  uint32 shift = 32 - 4; // 至少16个槽位
+  uint64 capacity = 16;
+  while (capacity < (uint64)n * 2) {
+    capacity <<= 1;
+    shift--;
+  }
+
+  uint64 *slots = (uint64 *)calloc((size_t)capacity, sizeof(uint64));
+  if (!slots) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return UINT32_MAX;
+  }
+
+  uint32 count = 0;
+  for (uint32 i = 0; i < n; i++) {
+    uint64 entry = (1ull << 32) | keys[i];
+    uint64 slot = (uint32)(keys[i] * 2654435769u) >> shift;
+    while (slots[slot] && slots[slot] != entry)
+      slot = (slot + 1) & (capacity - 1);
+    if (!slots[slot]) {
+      slots[slot] = entry;
+      out[count++] = SL_distinctValue(keys[i], mode);
+    }
+  }
+
+  free(slots);
+  return count;
+}
+
+/**
+ * @brief 排序去重：按键稳定基数排序，每组相同键中下标最小者即第一次出现，
+ *        标记后再按原顺序输出
+ *
+ * @return uint32 不同键的个数，内存分配失败返回UINT32_MAX
+ */
+static uint32 SL_distinctSort(const uint32 *const keys, const uint32 n,
+                              enum distinct mode, Elemtype *const out) {
+  uint64 *items = (uint64 *)malloc(sizeof(uint64) * n);
+  uint64 *buffer = (uint64 *)malloc(sizeof(uint64) * n);
+  uint64 *first = (uint64 *)calloc(((size_t)n + 63) / 64, sizeof(uint64));
+  if (!(items && buffer && first)) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    free(items);
+    free(buffer);
+    free(first);
+    return UINT32_MAX;
+  }
+
+  // 元素高32位为键，低32位为下标
+  for (uint32 i = 0; i < n; i++)
+    items[i] = ((uint64)keys[i] << 32) | i;
+
+  uint32 hist[SL_DISTINCT_RADIX_BUCKETS];
+  for (uint32 p = 0; p < SL_DISTINCT_RADIX_PASSES; p++) {
+    uint32 shift = 32 + p * SL_DISTINCT_RADIX_BITS;
+    memset(hist, 0, sizeof(hist));
+    for (uint32 i = 0; i < n; i++)
+      hist[(items[i] >> shift) & (SL_DISTINCT_RADIX_BUCKETS - 1)]++;
+    if (hist[(items[0] >> shift) & (SL_DISTINCT_RADIX_BUCKETS - 1)] == n)
+      continue; // 本轮所有元素同桶，无需分发
+
+    uint32 offset = 0;
+    for (uint32 b = 0; b < SL_DISTINCT_RADIX_BUCKETS; b++) {
+      uint32 c = hist[b];
+      hist[b] = offset;
+      offset += c;
+    }
+    for (uint32 i = 0; i < n; i++)
+      buffer[hist[(items[i] >> shift) & (SL_DISTINCT_RADIX_BUCKETS - 1)]++] =
+          items[i];
+
+    uint64 *temp = items;
+    items = buffer;
+    buffer = temp;
+  }
+
+  // 稳定排序保证每组相同键的第一个元素下标最小
+  for (uint32 i = 0; i < n; i++) {
+    if (i == 0 || (items[i] >> 32) != (items[i - 1] >> 32)) {
+      uint32 index = (uint32)items[i];
+      first[index >> 6] |= 1ull << (index & 63);
+    }
+  }
+
+  uint32 count = 0;
+  for (uint32 i = 0; i < n; i++) {
+    if (first[i >> 6] & (1ull << (i & 63)))
+      out[count++] = SL_distinctValue(keys[i], mode);
+  }
+
+  free(items);
+  free(buffer);
+  free(first);
+  return count;
+}
+
+/**
+ * @brief 取出链表中的不同值，返回数组
+ *
+ * 输出按每个值第一次出现的顺序排列。DISTINCT_AUTO 的选择规则：
+ * - 键的取值范围不超过 SL_DISTINCT_BITSET_RATIO * n：位图；
+ * - 否则 n 不小于 SL_DISTINCT_SORT_MIN：基数排序；
+ * - 否则：哈希集合。
+ * 指定 DISTINCT_BITSET 但取值范围超出上述限制时改用哈希集合，
+ * 保证额外内存始终为O(n)。
+ *
+ * @param linkedList 单向链表指针（节点存储或顺序存储均可）
+ * @param mode 取值方式：DISTINCT_RAW 原值，DISTINCT_ABS 绝对值
+ * @param method 去重实现，通常传 DISTINCT_AUTO
+ * @param outCount 输出参数，返回不同值的个数
+ * @return Elemtype* 不同值数组，链表为空或内存分配失败时返回NULL
+ * @note 调用者需使用 free() 释放返回的数组。
+ */
+Elemtype *SL_distinctArray(SL_link *const linkedList, enum distinct mode,
+                           enum distinctMethod method, uint32 *const outCount) {
+  *outCount = 0;
+  if (linkedList == NULL || linkedList->length == 0)
+    return NULL;
+
+  uint32 n = linkedList->length;
+  uint32 *keys = (uint32 *)malloc(sizeof(uint32) * n);
+  Elemtype *out = (Elemtype *)malloc(sizeof(Elemtype) * n);
+  if (!(keys && out)) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    free(keys);
+    free(out);
+    return NULL;
+  }
+
+  // 一次遍历生成键并统计取值范围
+  uint32 minKey = UINT32_MAX;
+  uint32 maxKey = 0;
+  if (linkedList->vector) {
+    const Elemtype *data = SV_DATA(linkedList);
+    for (uint32 i = 0; i < n; i++)
+      keys[i] = SL_distinctKey(data[i], mode);
+  } else {
+    SL_node *cur = linkedList->headIndex;
+    for (uint32 i = 0; i < n; i++, cur = cur->next)
+      keys[i] = SL_distinctKey(cur->data, mode);
+  }
+  for (uint32 i = 0; i < n; i++) {
+    minKey = keys[i] < minKey ? keys[i] : minKey;
+    maxKey = keys[i] > maxKey ? keys[i] : maxKey;
+  }
+
+  uint64 range = (uint64)maxKey - minKey + 1;
+  uint16 dense = range <= (uint64)SL_DISTINCT_BITSET_RATIO * n;
+  if (method == DISTINCT_AUTO)
+    method = dense ? DISTINCT_BITSET
+                   : (n >= SL_DISTINCT_SORT_MIN ? DISTINCT_SORT : DISTINCT_HASH);
+  else if (method == DISTINCT_BITSET && !dense)
+    method = DISTINCT_HASH;
+
+  uint32 count;
+  if (method == DISTINCT_BITSET)
+    count = SL_distinctBitset(keys, n, minKey, range, mode, out);
+  else if (method == DISTINCT_SORT)
+    count = SL_distinctSort(keys, n, mode, out);
+  else
+    count = SL_distinctHash(keys, n, mode, out);
+  free(keys);
+
+  if (count == UINT32_MAX) {
+    free(out);
+    return NULL;
+  }
+
+  Elemtype *shrunk = (Elemtype *)realloc(out, sizeof(Elemtype) * count);
+  *outCount = count;
+  return shrunk ? shrunk : out;
+}
+
+/**
+ * @brief 取出链表中的不同值，返回新链表
+ *
+ * 与 SL_distinctArray(linkedList, mode, DISTINCT_AUTO, ...) 相同，
+ * 结果保存在带私有节点池的新链表中。
+ *
+ * @param linkedList 单向链表指针
+ * @param mode 取值方式：DISTINCT_RAW 原值，DISTINCT_ABS 绝对值
+ * @return SL_link* 新链表（原链表为空时为空链表），内存分配失败返回NULL
+ * @note 返回的链表需使用 SL_freeLinks() 释放。
+ */
+SL_link *SL_distinct(SL_link *const linkedList, enum distinct mode) {
+  if (linkedList == NULL)
+    return NULL;
+  if (linkedList->length == 0)
+    return SL_fromArray(NULL, 0);
+
+  uint32 count = 0;
+  Elemtype *values = SL_distinctArray(linkedList, mode, DISTINCT_AUTO, &count);
+  if (!values)
+    return NULL;
+
+  SL_link *result = SL_fromArray(values, count);
+  free(values);
+  return result;
+}
+
+/** @} */ // 单向链表去重
@@ -0,0 +1,359 @@
+/*
+ * @file sl_file.c
+ * @brief 单向链表二进制保存与内存映射加载实现文件
+ * @author ringtree
+ * @date 2025-10-02
+ * @version 1.0
+ *
+ * 本文件实现了 sl_file.h 中声明的保存与加载操作。
+ * 保存时按 SL_FILE_CHUNK 个元素一块编码后整块 fwrite()，数据区写完后再回写
+ * 文件头中的 payloadBytes。加载时原始格式直接把映射区当作数组交给
+ * SL_appendArray()，差分格式按块解码到临时数组后追加，两者都只扫描一次文件。
+ * POSIX 系统用 mmap() 映射文件，Windows 下退回 fread() 整体读入堆内存。
+ */
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "sl_file.h"
+#include "sl_log.h"
+#include "sl_vector.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 一个变长整数的最大字节数
+ */
+#define SL_FILE_VARINT_MAX 5
+
+/**
+ * @addtogroup 二进制存取
+ * @{
+ */
+
+/**
+ * @brief zigzag 编码：把有符号差值映射为小的无符号数（0, -1, 1, -2 ... → 0, 1, 2, 3 ...）
+ */
+static inline uint32 SL_fileZigzag(const uint32 delta) {
+  return (delta << 1) ^ (uint32)((int32)delta >> 31);
+}
+
+/**
+ * @brief zigzag 解码
+ */
+static inline uint32 SL_fileUnzigzag(const uint32 value) {
+  return (value >> 1) ^ (0u - (value & 1));
+}
+
+/**
+ * @brief 从节点链表中取出至多 max 个元素
+ *
+ * @param cur 当前节点，返回时指向下一个未取出的节点
+ * @return uint32 取出的元素个数
+ */
+static uint32 SL_fileGather(SL_node **const cur, Elemtype *const out,
+                            const uint32 max) {
+  uint32 count = 0;
+  SL_node *node = *cur;
+  for (; node && count < max; node = node->next)
+    out[count++] = node->data;
+  *cur = node;
+  return count;
+}
+
+/**
+ * @brief 把一块元素差分编码为变长整数
+ *
+ * @param prev 前一个元素，返回时更新为本块最后一个元素
+ * @return uint32 写入 out 的字节数
+ */
+static uint32 SL_fileEncode(const Elemtype *const values, const uint32 count,
+                            uint32 *const prev, uint8_t *const out) {
+  uint8_t *p = out;
+  uint32 last = *prev;
+  for (uint32 i = 0; i < count; i++) {
+    uint32 z = SL_fileZigzag((uint32)values[i] - last);
+    last = (uint32)values[i];
+    while (z >= 0x80) {
+      *p++ = (uint8_t)(z | 0x80);
+      z >>= 7;
+    }
+    *p++ = (uint8_t)z;
+  }
+  *prev = last;
+  return (uint32)(p - out);
+}
+
+/**
+ * @brief 把一块变长整数解码为元素
+ *
+ * @param p 当前读取位置
+ * @param end 数据区末尾
+ * @param prev 前一个元素，返回时更新为本块最后一个元素
+ * @return const uint8_t* 下一块的读取位置，数据不完整时返回NULL
+ */
+static const uint8_t *SL_fileDecode(const uint8_t *p, const uint8_t *const end,
+                                    Elemtype *const values, const uint32 count,
+                                    uint32 *const prev) {
+  uint32 last = *prev;
+  for (uint32 i = 0; i < count; i++) {
+    uint32 z = 0;
+    uint32 shift = 0;
+    for (;;) {
+      if (p == end || shift >= 7 * SL_FILE_VARINT_MAX)
+        return NULL;
+      uint8_t byte = *p++;
+      z |= (uint32)(byte & 0x7F) << shift;
+      if (!(byte & 0x80))
+        break;
+      shift += 7;
+    }
+    last += SL_fileUnzigzag(z);
+    values[i] = (Elemtype)last;
+  }
+  *prev = last;
+  return p;
+}
+
+/**
+ * @brief 把链表保存为二进制文件
+ *
+ * @param linkedList 单向链表指针（节点存储或顺序存储均可）
+ * @param path 文件路径，已存在时覆盖
+ * @param format 数据区编码：SL_FILE_RAW 原始数组，SL_FILE_DELTA 差分变长整数
+ * @return uint16 成功返回1，失败返回0
+ */
+uint16 SL_save(SL_link *const linkedList, const char *const path,
+               enum SL_fileFormat format) {
+  if (linkedList == NULL || path == NULL) {
+    SL_log(SL_LOG_ERROR, "错误：链表或文件路径为空");
+    return 0;
+  }
+
+  FILE *file = fopen(path, "wb");
+  if (!file) {
+    SL_log(SL_LOG_ERROR, "错误：无法打开文件 %s", path);
+    return 0;
+  }
+
+  Elemtype *values = (Elemtype *)malloc(sizeof(Elemtype) * SL_FILE_CHUNK);
+  uint8_t *bytes = (uint8_t *)malloc(SL_FILE_VARINT_MAX * SL_FILE_CHUNK);
+  if (!(values && bytes)) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    free(values);
+    free(bytes);
+    fclose(file);
+    return 0;
+  }
+
+  SL_fileHeader header = {SL_FILE_MAGIC, SL_FILE_VERSION, (uint16)format,
+                          linkedList->length, 0, 0};
+  uint16 ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+  SL_node *cur = linkedList->headIndex;
+  uint32 prev = 0;
+  for (uint32 done = 0; ok && done < linkedList->length;) {
+    uint32 count = linkedList->length - done;
+    if (count > SL_FILE_CHUNK)
+      count = SL_FILE_CHUNK;
+
+    const Elemtype *chunk = values;
+    if (linkedList->vector)
+      chunk = SV_DATA(linkedList) + done;
+    else
+      count = SL_fileGather(&cur, values, count);
+
+    if (format == SL_FILE_DELTA) {
+      uint32 size = SL_fileEncode(chunk, count, &prev, bytes);
+      ok = fwrite(bytes, 1, size, file) == size;
+      header.payloadBytes += size;
+    } else {
+      ok = fwrite(chunk, sizeof(Elemtype), count, file) == count;
+      header.payloadBytes += (uint64)count * sizeof(Elemtype);
+    }
+    done += count;
+  }
+
+  // 回写数据区大小
+  if (ok)
+    ok = fseek(file, 0, SEEK_SET) == 0 &&
+         fwrite(&header, sizeof(header), 1, file) == 1;
+  if (fclose(file) != 0)
+    ok = 0;
+  if (!ok)
+    SL_log(SL_LOG_ERROR, "错误：写入文件 %s 失败", path);
+
+  free(values);
+  free(bytes);
+  return ok;
+}
+
+/**
+ * @brief 把整个文件只读映射到内存
+ *
+ * POSIX 系统使用 mmap() 并提示内核顺序读取；Windows 下没有 mmap()，
+ * 退回 fread() 把文件整体读入堆内存。
+ *
+ * @param path 文件路径
+ * @param outSize 输出参数，文件字节数
+ * @return const void* 文件内容；无法打开、短于文件头或映射失败时返回NULL
+ * @note 返回值需使用 SL_fileUnmap() 释放。
+ */
+static const void *SL_fileMap(const char *const path, size_t *const outSize) {
+#ifdef _WIN32
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    SL_log(SL_LOG_ERROR, "错误：无法打开文件 %s", path);
+    return NULL;
+  }
+
+  long length = -1;
+  if (fseek(file, 0, SEEK_END) == 0) {
+    length = ftell(file);
+    rewind(file);
+  }
+  if (length < (long)sizeof(SL_fileHeader)) {
+    SL_log(SL_LOG_ERROR, "错误：文件 %s 格式无效", path);
+    fclose(file);
+    return NULL;
+  }
+
+  size_t size = (size_t)length;
+  void *map = malloc(size);
+  if (!map || fread(map, 1, size, file) != size) {
+    SL_log(SL_LOG_ERROR, "错误：无法读取文件 %s", path);
+    free(map);
+    fclose(file);
+    return NULL;
+  }
+  fclose(file);
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    SL_log(SL_LOG_ERROR, "错误：无法打开文件 %s", path);
+    return NULL;
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 || (uint64)info.st_size < sizeof(SL_fileHeader)) {
+    SL_log(SL_LOG_ERROR, "错误：文件 %s 格式无效", path);
+    close(fd);
+    return NULL;
+  }
+
+  size_t size = (size_t)info.st_size;
+  void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    SL_log(SL_LOG_ERROR, "错误：无法映射文件 %s", path);
+    return NULL;
+  }
+  posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+#endif
+
+  *outSize = size;
+  return map;
+}
+
+/**
+ * @brief 释放 SL_fileMap() 返回的文件内容
+ *
+ * @param map 文件内容
+ * @param size 文件字节数
+ */
+static void SL_fileUnmap(const void *const map, const size_t size) {
+#ifdef _WIN32
+  (void)size;
+  free((void *)map);
+#else
+  munmap((void *)map, size);
+#endif
+}
+
+/**
+ * @brief 通过内存映射加载 SL_save() 保存的文件
+ *
+ * @param path 文件路径
+ * @param mode SL_LOAD_NODES 生成节点链表（私有节点池），
+ *             SL_LOAD_VECTOR 生成顺序存储链表
+ * @return SL_link* 新链表，文件无效或内存分配失败时返回NULL
+ * @note 返回的链表需使用 SL_freeLinks() 释放。
+ */
+SL_link *SL_load(const char *const path, enum SL_loadMode mode) {
+  if (path == NULL) {
+    SL_log(SL_LOG_ERROR, "错误：文件路径为空");
+    return NULL;
+  }
+
+  size_t size = 0;
+  const void *map = SL_fileMap(path, &size);
+  if (!map)
+    return NULL;
+
+  const SL_fileHeader *header = (const SL_fileHeader *)map;
+  const uint8_t *payload = (const uint8_t *)map + sizeof(SL_fileHeader);
+  uint16 valid =
+      header->magic == SL_FILE_MAGIC && header->version == SL_FILE_VERSION &&
+      header->payloadBytes == size - sizeof(SL_fileHeader) &&
+      (header->format == SL_FILE_DELTA ||
+       (header->format == SL_FILE_RAW &&
+        header->payloadBytes == (uint64)header->length * sizeof(Elemtype)));
+  if (!valid) {
+    SL_log(SL_LOG_ERROR, "错误：文件 %s 格式无效", path);
+    SL_fileUnmap(map, size);
+    return NULL;
+  }
+
+  uint32 length = header->length;
+  SL_link *linkedList = mode == SL_LOAD_VECTOR ? SL_inifLinkVector(length)
+                                               : SL_inifLinkPool(NULL);
+  if (!linkedList) {
+    SL_fileUnmap(map, size);
+    return NULL;
+  }
+
+  uint16 ok = 1;
+  if (header->format == SL_FILE_RAW) {
+    ok = length == 0 ||
+         SL_appendArray(linkedList, (const Elemtype *)payload, length) == length;
+  } else {
+    Elemtype *values = (Elemtype *)malloc(sizeof(Elemtype) * SL_FILE_CHUNK);
+    const uint8_t *p = payload;
+    const uint8_t *end = payload + header->payloadBytes;
+    uint32 prev = 0;
+    if (!values) {
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+      ok = 0;
+    }
+    for (uint32 done = 0; ok && done < length;) {
+      uint32 count = length - done;
+      if (count > SL_FILE_CHUNK)
+        count = SL_FILE_CHUNK;
+      p = SL_fileDecode(p, end, values, count, &prev);
+      ok = p && SL_appendArray(linkedList, values, count) == count;
+      done += count;
+    }
+    if (ok && p != end)
+      ok = 0;
+    free(values);
+  }
+  SL_fileUnmap(map, size);
+
+  if (!ok) {
+    SL_log(SL_LOG_ERROR, "错误：文件 %s 数据不完整", path);
+    SL_freeLinks(linkedList);
+    return NULL;
+  }
+  return linkedList;
+}
+
+/** @} */ // 二进制存取
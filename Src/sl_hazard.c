@@ -0,0 +1,221 @@
+/*
+ * @file sl_hazard.c
+ * @brief 风险指针安全内存回收实现文件
+ * @author ringtree
+ * @date 2025-09-24
+ * @version 1.0
+ *
+ * 本文件实现了 sl_hazard.h 中声明的风险指针操作：
+ * - 线程记录通过 CAS 领取，领取过的最大下标记录在 highWater 中，
+ *   扫描时只需检查 [0, highWater) 范围内的记录；
+ * - 待回收节点数达到 2 * SL_HP_SLOTS * highWater + 64 时触发扫描，
+ *   每次扫描至少回收一半，均摊代价O(1)。
+ */
+#include <stdlib.h>
+
+#include "other.h"
+#include "sl_hazard.h"
+#include "sl_log.h"
+
+/**
+ * @addtogroup 风险指针
+ * @{
+ */
+
+/**
+ * @brief 判断指针是否被任一线程登记为风险指针
+ */
+static uint16 SL_hpIsHazard(SL_hpDomain *const domain, const void *const ptr,
+                            const uint32 high) {
+  for (uint32 i = 0; i < high; i++) {
+    for (uint32 s = 0; s < SL_HP_SLOTS; s++) {
+      if (atomic_load(&domain->records[i].hazard[s]) == ptr)
+        return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief 扫描并回收未被登记的待回收节点
+ *
+ * @param domain 风险指针域
+ * @param record 当前线程的记录
+ */
+static void SL_hpScan(SL_hpDomain *const domain, SL_hpRecord *const record) {
+  uint32 high = atomic_load(&domain->highWater);
+  uint32 keep = 0;
+
+  for (uint32 i = 0; i < record->retiredCount; i++) {
+    void *ptr = record->retired[i];
+    if (SL_hpIsHazard(domain, ptr, high))
+      record->retired[keep++] = ptr; // 仍被引用，留待下次扫描
+    else
+      domain->reclaim(ptr);
+  }
+  record->retiredCount = keep;
+}
+
+/**
+ * @brief 创建风险指针域
+ *
+ * @param reclaim 节点回收函数（通常为 free）
+ * @return SL_hpDomain* 新风险指针域，内存分配失败返回NULL
+ */
+SL_hpDomain *SL_inifHpDomain(SL_reclaimFn reclaim) {
+  SL_hpDomain *domain =
+      (SL_hpDomain *)SL_alignedAlloc(sizeof(SL_hpDomain), SL_CACHE_LINE);
+  if (!domain) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  for (uint32 i = 0; i < SL_HP_MAX_THREADS; i++) {
+    SL_hpRecord *record = &domain->records[i];
+    for (uint32 s = 0; s < SL_HP_SLOTS; s++)
+      atomic_init(&record->hazard[s], NULL);
+    atomic_init(&record->active, 0);
+    record->retired = NULL;
+    record->retiredCount = 0;
+    record->retiredCapacity = 0;
+  }
+  atomic_init(&domain->highWater, 0);
+  domain->reclaim = reclaim;
+
+  return domain;
+}
+
+/**
+ * @brief 为当前线程领取一条线程记录
+ *
+ * @param domain 风险指针域
+ * @return SL_hpRecord* 线程记录，已达到 SL_HP_MAX_THREADS 时返回NULL
+ */
+SL_hpRecord *SL_hpAcquire(SL_hpDomain *const domain) {
+  for (uint32 i = 0; i < SL_HP_MAX_THREADS; i++) {
+    int expected = 0;
+    if (atomic_compare_exchange_strong(&domain->records[i].active, &expected,
+                                       1)) {
+      uint32 high = atomic_load(&domain->highWater);
+      while (high < i + 1 &&
+             !atomic_compare_exchange_weak(&domain->highWater, &high, i + 1))
+        ;
+      return &domain->records[i];
+    }
+  }
+
+  SL_log(SL_LOG_ERROR, "错误：访问线程数超过 %d", SL_HP_MAX_THREADS);
+  return NULL;
+}
+
+/**
+ * @brief 归还线程记录
+ *
+ * 清空风险指针并尝试回收一次；仍被引用的待回收节点留在记录中，
+ * 由下一个领取该记录的线程或 SL_freeHpDomain() 继续处理。
+ *
+ * @param domain 风险指针域
+ * @param record 线程记录
+ */
+void SL_hpRelease(SL_hpDomain *const domain, SL_hpRecord *const record) {
+  SL_hpClear(record);
+  SL_hpScan(domain, record);
+  atomic_store(&record->active, 0);
+}
+
+/**
+ * @brief 读取共享指针并登记为风险指针
+ *
+ * 登记后再次读取校验，确保登记时节点尚未被摘除。
+ *
+ * @param record 线程记录
+ * @param slot 风险指针槽位（0 <= slot < SL_HP_SLOTS）
+ * @param source 共享指针地址
+ * @return void* 已受保护的指针值
+ */
+void *SL_hpProtect(SL_hpRecord *const record, const uint32 slot,
+                   _Atomic(void *) *const source) {
+  void *ptr = atomic_load(source);
+  for (;;) {
+    atomic_store(&record->hazard[slot], ptr);
+    void *again = atomic_load(source);
+    if (again == ptr)
+      return ptr;
+    ptr = again;
+  }
+}
+
+/**
+ * @brief 直接登记风险指针（由调用者负责校验）
+ *
+ * @param record 线程记录
+ * @param slot 风险指针槽位
+ * @param ptr 指针值
+ */
+void SL_hpSet(SL_hpRecord *const record, const uint32 slot, void *const ptr) {
+  atomic_store(&record->hazard[slot], ptr);
+}
+
+/**
+ * @brief 清空当前线程的全部风险指针
+ *
+ * @param record 线程记录
+ */
+void SL_hpClear(SL_hpRecord *const record) {
+  for (uint32 s = 0; s < SL_HP_SLOTS; s++)
+    atomic_store_explicit(&record->hazard[s], NULL, memory_order_release);
+}
+
+/**
+ * @brief 延迟回收已从共享结构中摘除的节点
+ *
+ * @param domain 风险指针域
+ * @param record 当前线程的记录
+ * @param ptr 已摘除的节点
+ */
+void SL_hpRetire(SL_hpDomain *const domain, SL_hpRecord *const record,
+                 void *const ptr) {
+  if (record->retiredCount == record->retiredCapacity) {
+    uint32 capacity = record->retiredCapacity ? record->retiredCapacity * 2 : 64;
+    void **grown = (void **)realloc(record->retired, sizeof(void *) * capacity);
+    if (!grown) { // 无法记录时先尝试扫描腾出空间
+      SL_hpScan(domain, record);
+      if (record->retiredCount == record->retiredCapacity) {
+        SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+        return; // 只能泄漏该节点，不能在可能被引用时释放
+      }
+    } else {
+      record->retired = grown;
+      record->retiredCapacity = capacity;
+    }
+  }
+
+  record->retired[record->retiredCount++] = ptr;
+
+  uint32 threshold =
+      2 * SL_HP_SLOTS * atomic_load(&domain->highWater) + 64;
+  if (record->retiredCount >= threshold)
+    SL_hpScan(domain, record);
+}
+
+/**
+ * @brief 释放风险指针域，并回收所有线程记录中剩余的待回收节点
+ *
+ * @param domain 风险指针域，传入NULL时直接返回
+ * @warning 调用时不能再有线程访问对应的无锁结构。
+ */
+void SL_freeHpDomain(SL_hpDomain *domain) {
+  if (domain == NULL)
+    return;
+
+  for (uint32 i = 0; i < SL_HP_MAX_THREADS; i++) {
+    SL_hpRecord *record = &domain->records[i];
+    for (uint32 k = 0; k < record->retiredCount; k++)
+      domain->reclaim(record->retired[k]);
+    free(record->retired);
+  }
+
+  SL_alignedFree(domain);
+}
+
+/** @} */ // 风险指针
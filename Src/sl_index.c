@@ -0,0 +1,253 @@
+/*
+ * @file sl_index.c
+ * @brief 单向链表值哈希索引实现文件
+ * @author ringtree
+ * @date 2025-09-12
+ * @version 1.0
+ *
+ * 本文件实现了 sl_index.h 中声明的哈希索引操作：
+ * - 使用 Fibonacci 哈希与线性探测，负载因子不超过 1/2；
+ * - 删除使用后移法（backward shift），不产生墓碑槽位。
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "sl_index.h"
+#include "sl_log.h"
+
+/**
+ * @addtogroup 单向链表哈希索引
+ * @{
+ */
+
+/**
+ * @brief 计算值的起始槽位
+ */
+static inline uint32 SL_indexHome(const SL_index *const index,
+                                  const Elemtype key) {
+  return (uint32)((uint32)key * 2654435769u) >> index->shift;
+}
+
+/**
+ * @brief 按指定槽位数重建哈希表
+ *
+ * @param index 哈希索引指针
+ * @param capacity 新槽位数（2的幂）
+ * @return uint16 成功返回1，内存分配失败返回0（原表保持不变）
+ */
+static uint16 SL_indexRehash(SL_index *const index, const uint32 capacity) {
+  SL_indexEntry *slots =
+      (SL_indexEntry *)calloc(capacity, sizeof(SL_indexEntry));
+  if (!slots)
+    return 0; // 由调用者报告，SL_indexAdd() 扩容失败时尽量继续使用原表
+
+  SL_indexEntry *old = index->slots;
+  uint32 oldCapacity = index->capacity;
+  uint32 shift = 32;
+  for (uint32 c = capacity; c > 1; c >>= 1)
+    shift--;
+
+  index->slots = slots;
+  index->capacity = capacity;
+  index->shift = shift;
+
+  for (uint32 i = 0; i < oldCapacity; i++) {
+    if (!old[i].count)
+      continue;
+    uint32 slot = SL_indexHome(index, old[i].key);
+    while (slots[slot].count)
+      slot = (slot + 1) & (capacity - 1);
+    slots[slot] = old[i];
+  }
+
+  free(old);
+  return 1;
+}
+
+/**
+ * @brief 查找值所在槽位
+ *
+ * @return uint32 值所在槽位；值不存在时返回探测终止的空槽位
+ */
+static inline uint32 SL_indexProbe(const SL_index *const index,
+                                   const Elemtype key) {
+  uint32 mask = index->capacity - 1;
+  uint32 slot = SL_indexHome(index, key);
+
+  while (index->slots[slot].count && index->slots[slot].key != key)
+    slot = (slot + 1) & mask;
+
+  return slot;
+}
+
+/**
+ * @brief 创建一个空的哈希索引
+ *
+ * @param capacityHint 预计的不同值个数，用于预分配槽位
+ * @return SL_index* 新哈希索引指针，内存分配失败返回NULL
+ */
+SL_index *SL_inifIndex(const uint32 capacityHint) {
+  SL_index *index = (SL_index *)malloc(sizeof(SL_index));
+  if (!index)
+    return NULL; // 由调用者报告
+
+  uint32 capacity = SL_INDEX_MIN_CAPACITY;
+  while (capacity / 2 < capacityHint && capacity < (1u << 31))
+    capacity <<= 1;
+
+  index->slots = NULL;
+  index->capacity = 0;
+  index->size = 0;
+  if (!SL_indexRehash(index, capacity)) {
+    free(index);
+    return NULL;
+  }
+
+  return index;
+}
+
+/**
+ * @brief 记录值出现一次
+ *
+ * @param index 哈希索引指针
+ * @param key 值
+ * @return uint16 成功返回1；扩容失败且原表已无法保留空槽位时返回0，
+ *         此时索引未记录该值，调用者应删除索引
+ * @note 负载因子超过 1/2 时槽位数翻倍；扩容失败（或槽位数已达 2^31）时
+ *       继续使用原表，直到只剩最后一个空槽位。
+ */
+uint16 SL_indexAdd(SL_index *const index, const Elemtype key) {
+  uint32 slot = SL_indexProbe(index, key);
+  if (index->slots[slot].count) {
+    index->slots[slot].count++;
+    return 1;
+  }
+
+  if ((uint64)(index->size + 1) * 2 > index->capacity) {
+    if (index->capacity <= UINT32_MAX / 2 &&
+        SL_indexRehash(index, index->capacity * 2)) {
+      slot = SL_indexProbe(index, key);
+    } else if (index->size + 1 >= index->capacity) {
+      return 0; // 线性探测至少需要一个空槽位作为终止条件
+    }
+  }
+
+  index->slots[slot].key = key;
+  index->slots[slot].count = 1;
+  index->size++;
+  return 1;
+}
+
+/**
+ * @brief 记录值被删除一次
+ *
+ * 出现次数减为0时删除槽位，并把后续同一探测簇中的元素前移填补空位。
+ *
+ * @param index 哈希索引指针
+ * @param key 值（不存在时不做任何操作）
+ */
+void SL_indexRemove(SL_index *const index, const Elemtype key) {
+  uint32 mask = index->capacity - 1;
+  uint32 hole = SL_indexProbe(index, key);
+  if (!index->slots[hole].count || --index->slots[hole].count)
+    return;
+
+  index->size--;
+  for (uint32 next = (hole + 1) & mask; index->slots[next].count;
+       next = (next + 1) & mask) {
+    uint32 home = SL_indexHome(index, index->slots[next].key);
+    // home 不在 (hole, next] 区间内时，元素可以前移到 hole
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      index->slots[hole] = index->slots[next];
+      hole = next;
+    }
+  }
+  index->slots[hole].count = 0;
+}
+
+/**
+ * @brief 查询值出现的次数
+ *
+ * @param index 哈希索引指针
+ * @param key 值
+ * @return uint32 出现次数，时间复杂度期望O(1)
+ */
+uint32 SL_indexCount(const SL_index *const index, const Elemtype key) {
+  return index->slots[SL_indexProbe(index, key)].count;
+}
+
+/**
+ * @brief 清空哈希索引（保留已分配的槽位）
+ *
+ * @param index 哈希索引指针
+ */
+void SL_indexClear(SL_index *const index) {
+  for (uint32 i = 0; i < index->capacity; i++)
+    index->slots[i].count = 0;
+  index->size = 0;
+}
+
+/**
+ * @brief 释放哈希索引
+ *
+ * @param index 哈希索引指针，传入NULL时直接返回
+ */
+void SL_freeIndex(SL_index *index) {
+  if (index == NULL)
+    return;
+
+  free(index->slots);
+  free(index);
+}
+
+/**
+ * @brief 为单向链表建立哈希索引
+ *
+ * 遍历一次链表建立索引，之后由插入、删除操作自动维护。
+ * 链表已有索引时直接返回成功。
+ *
+ * @param linkedList 单向链表指针
+ * @return uint16 成功返回1，失败返回0
+ */
+uint16 SL_indexEnable(SL_link *const linkedList) {
+  if (linkedList == NULL)
+    return 0;
+  if (linkedList->index)
+    return 1;
+  if (linkedList->vector) {
+    SL_log(SL_LOG_ERROR, "错误：顺序存储链表不支持哈希索引");
+    return 0;
+  }
+
+  SL_index *index = SL_inifIndex(linkedList->length);
+  if (!index) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return 0;
+  }
+
+  for (SL_node *cur = linkedList->headIndex; cur; cur = cur->next) {
+    if (!SL_indexAdd(index, cur->data)) {
+      SL_freeIndex(index);
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+      return 0;
+    }
+  }
+
+  linkedList->index = index;
+  return 1;
+}
+
+/**
+ * @brief 删除单向链表的哈希索引
+ *
+ * @param linkedList 单向链表指针
+ */
+void SL_indexDisable(SL_link *const linkedList) {
+  if (linkedList == NULL)
+    return;
+
+  SL_freeIndex(linkedList->index);
+  linkedList->index = NULL;
+}
+
+/** @} */ // 单向链表哈希索引
@@ -0,0 +1,378 @@
+/*
+ * @file sl_intrusive.c
+ * @brief 侵入式单向链表实现文件
+ * @author ringtree
+ * @date 2025-10-04
+ * @version 1.0
+ *
+ * 本文件实现了 sl_intrusive.h 中声明的侵入式链表操作。
+ * 除 IL_inifLink() 分配链表结构体外，所有操作只修改 IL_hook::next 与链表字段，
+ * 不调用 malloc() / free()。
+ */
+#include <stdlib.h>
+
+#include "sl_intrusive.h"
+#include "sl_log.h"
+
+/**
+ * @addtogroup 侵入式单向链表
+ * @{
+ */
+
+/**
+ * @brief 创建空的侵入式链表
+ *
+ * @return IL_link* 链表结构体，内存分配失败返回NULL
+ * @note 使用 IL_freeLinks() 释放；也可以直接在栈上或对象中定义 IL_link
+ *       并用 IL_clear() 初始化。
+ */
+IL_link *IL_inifLink(void) {
+  IL_link *link = (IL_link *)malloc(sizeof(IL_link));
+  if (!link) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+  IL_clear(link);
+  return link;
+}
+
+/**
+ * @brief 清空链表（只重置链表字段，不访问对象）
+ *
+ * @param link 侵入式链表指针
+ */
+void IL_clear(IL_link *const link) {
+  link->headIndex = NULL;
+  link->endIndex = NULL;
+  link->length = 0;
+}
+
+/**
+ * @brief 释放链表结构体（对象由调用者管理，不会被释放）
+ *
+ * @param link 侵入式链表指针，传入NULL时直接返回
+ */
+void IL_freeLinks(IL_link *link) {
+  if (link == NULL)
+    return;
+  free(link);
+}
+
+/**
+ * @brief 把链接字段插入到链表头部
+ *
+ * @param link 侵入式链表指针
+ * @param hook 待插入对象的链接字段（不能已在某条链表中）
+ */
+void IL_insertHead(IL_link *const link, IL_hook *const hook) {
+  hook->next = link->headIndex;
+  link->headIndex = hook;
+  if (!link->endIndex)
+    link->endIndex = hook;
+  link->length++;
+}
+
+/**
+ * @brief 把链接字段追加到链表尾部
+ *
+ * @param link 侵入式链表指针
+ * @param hook 待插入对象的链接字段（不能已在某条链表中）
+ */
+void IL_add(IL_link *const link, IL_hook *const hook) {
+  hook->next = NULL;
+  if (link->endIndex)
+    link->endIndex->next = hook;
+  else
+    link->headIndex = hook;
+  link->endIndex = hook;
+  link->length++;
+}
+
+/**
+ * @brief 把链接字段插入到 prev 之后
+ *
+ * @param link 侵入式链表指针
+ * @param prev 链表中的前驱链接字段，为NULL时插入到头部
+ * @param hook 待插入对象的链接字段
+ */
+void IL_insertAfter(IL_link *const link, IL_hook *const prev,
+                    IL_hook *const hook) {
+  if (prev == NULL) {
+    IL_insertHead(link, hook);
+    return;
+  }
+  hook->next = prev->next;
+  prev->next = hook;
+  if (prev == link->endIndex)
+    link->endIndex = hook;
+  link->length++;
+}
+
+/**
+ * @brief 取下标为 index 的链接字段
+ *
+ * @param link 侵入式链表指针
+ * @param index 下标（从0开始）
+ * @return IL_hook* 链接字段，越界返回NULL
+ */
+IL_hook *IL_getNode(IL_link *const link, const uint32 index) {
+  if (index >= link->length)
+    return NULL;
+  if (index == link->length - 1)
+    return link->endIndex;
+
+  IL_hook *cur = link->headIndex;
+  for (uint32 i = 0; i < index; i++)
+    cur = cur->next;
+  return cur;
+}
+
+/**
+ * @brief 把链接字段插入到下标 index 处
+ *
+ * @param link 侵入式链表指针
+ * @param hook 待插入对象的链接字段
+ * @param index 插入位置，等于链表长度时追加到尾部
+ * @return uint16 成功返回1，下标越界返回0
+ */
+uint16 IL_insert(IL_link *const link, IL_hook *const hook,
+                 const uint32 index) {
+  if (index > link->length) {
+    SL_log(SL_LOG_ERROR, "错误：索引 %u 越界(单向链表长度为 %u)", index,
+           link->length);
+    return 0;
+  }
+  if (index == link->length)
+    IL_add(link, hook);
+  else
+    IL_insertAfter(link, index ? IL_getNode(link, index - 1) : NULL, hook);
+  return 1;
+}
+
+/**
+ * @brief 摘下 prev 的后继链接字段
+ *
+ * @param link 侵入式链表指针
+ * @param prev 前驱链接字段，为NULL时摘下头部
+ * @return IL_hook* 被摘下的链接字段，没有后继时返回NULL
+ */
+IL_hook *IL_deleteAfter(IL_link *const link, IL_hook *const prev) {
+  IL_hook *hook = prev ? prev->next : link->headIndex;
+  if (!hook)
+    return NULL;
+
+  if (prev)
+    prev->next = hook->next;
+  else
+    link->headIndex = hook->next;
+  if (hook == link->endIndex)
+    link->endIndex = prev;
+  hook->next = NULL;
+  link->length--;
+  return hook;
+}
+
+/**
+ * @brief 摘下头部链接字段
+ *
+ * @param link 侵入式链表指针
+ * @return IL_hook* 被摘下的链接字段，链表为空返回NULL
+ */
+IL_hook *IL_delHead(IL_link *const link) { return IL_deleteAfter(link, NULL); }
+
+/**
+ * @brief 摘下尾部链接字段（需要O(n)查找前驱）
+ *
+ * @param link 侵入式链表指针
+ * @return IL_hook* 被摘下的链接字段，链表为空返回NULL
+ */
+IL_hook *IL_delEnd(IL_link *const link) {
+  if (link->length == 0)
+    return NULL;
+  return IL_deleteAfter(link, link->length > 1
+                                  ? IL_getNode(link, link->length - 2)
+                                  : NULL);
+}
+
+/**
+ * @brief 摘下下标为 index 的链接字段
+ *
+ * @param link 侵入式链表指针
+ * @param index 下标（从0开始）
+ * @return IL_hook* 被摘下的链接字段，下标越界返回NULL
+ */
+IL_hook *IL_deleteIndex(IL_link *const link, const uint32 index) {
+  if (index >= link->length) {
+    SL_log(SL_LOG_ERROR, "错误：索引 %u 越界(单向链表长度为 %u)", index,
+           link->length);
+    return NULL;
+  }
+  return IL_deleteAfter(link, index ? IL_getNode(link, index - 1) : NULL);
+}
+
+/**
+ * @brief 从链表中摘下指定的链接字段（需要O(n)查找前驱）
+ *
+ * @param link 侵入式链表指针
+ * @param hook 待摘下的链接字段
+ * @return uint16 成功返回1，hook 不在链表中返回0
+ */
+uint16 IL_unlink(IL_link *const link, IL_hook *const hook) {
+  IL_hook *prev = NULL;
+  for (IL_hook *cur = link->headIndex; cur; prev = cur, cur = cur->next) {
+    if (cur == hook) {
+      IL_deleteAfter(link, prev);
+      return 1;
+    }
+  }
+  SL_log(SL_LOG_ERROR, "未找到目标节点，无法删除");
+  return 0;
+}
+
+/**
+ * @brief 原地反转链表
+ *
+ * @param link 侵入式链表指针
+ */
+void IL_reverse(IL_link *const link) {
+  IL_hook *prev = NULL;
+  IL_hook *cur = link->headIndex;
+  link->endIndex = cur;
+  while (cur) {
+    IL_hook *next = cur->next;
+    cur->next = prev;
+    prev = cur;
+    cur = next;
+  }
+  link->headIndex = prev;
+}
+
+/**
+ * @brief 合并两条有序链（a 中对象原本在 b 之前，相等时先取 a 以保持稳定）
+ */
+static IL_hook *IL_mergeRuns(IL_hook *a, IL_hook *b, IL_compareFn compare,
+                             void *const context, enum sort way) {
+  IL_hook head;
+  IL_hook *tail = &head;
+  while (a && b) {
+    int32 order = compare(b, a, context);
+    if (way == ASC ? order < 0 : order > 0) {
+      tail->next = b;
+      b = b->next;
+    } else {
+      tail->next = a;
+      a = a->next;
+    }
+    tail = tail->next;
+  }
+  tail->next = a ? a : b;
+  return head.next;
+}
+
+/**
+ * @brief 稳定归并排序（自底向上，只修改链接字段，额外空间O(1)）
+ *
+ * @param link 侵入式链表指针
+ * @param compare 对象比较函数
+ * @param context 透传给 compare 的用户上下文
+ * @param way 排序方式：ASC 升序，DESC 降序
+ */
+void IL_sort_Merge(IL_link *const link, IL_compareFn compare,
+                   void *const context, enum sort way) {
+  IL_hook *bins[33] = {NULL}; // bins[i] 为长度 2^i 的有序链
+  IL_hook *cur = link->headIndex;
+  while (cur) {
+    IL_hook *next = cur->next;
+    IL_hook *run = cur;
+    uint32 i = 0;
+    run->next = NULL;
+    for (; bins[i]; i++) {
+      run = IL_mergeRuns(bins[i], run, compare, context, way);
+      bins[i] = NULL;
+    }
+    bins[i] = run;
+    cur = next;
+  }
+
+  IL_hook *result = NULL;
+  for (uint32 i = 0; i < 33; i++) {
+    if (bins[i])
+      result = IL_mergeRuns(bins[i], result, compare, context, way);
+  }
+
+  link->headIndex = result;
+  link->endIndex = result;
+  while (link->endIndex && link->endIndex->next)
+    link->endIndex = link->endIndex->next;
+}
+
+/**
+ * @brief 约瑟夫环：从头部开始报数，每数到第 n 个对象就把它摘下，直到只剩一个
+ *
+ * 与 SL_josephusSurvivor() 相同，报数时维护循环意义下的前驱，O(1)摘下。
+ *
+ * @param link 侵入式链表指针，结束时只剩幸存者
+ * @param n 报数间隔，必须 >= 1
+ * @param eliminated 每摘下一个对象调用一次（按出列顺序），可为NULL
+ * @param context 透传给 eliminated 的用户上下文
+ * @return IL_hook* 幸存者的链接字段，链表为空或 n 为0时返回NULL
+ */
+IL_hook *IL_josephusSurvivor(IL_link *const link, const uint32 n,
+                             IL_visitFn eliminated, void *const context) {
+  if (link == NULL || link->length == 0 || n == 0) {
+    SL_log(SL_LOG_ERROR, "错误：链表为空或报数间隔为0");
+    return NULL;
+  }
+
+  IL_hook *prev = link->endIndex; // 待报数对象的前驱（循环意义下）
+  while (link->length > 1) {
+    for (uint32 steps = (n - 1) % link->length; steps; steps--)
+      prev = prev->next ? prev->next : link->headIndex;
+
+    IL_hook *hook = IL_deleteAfter(link, prev == link->endIndex ? NULL : prev);
+    if (eliminated)
+      eliminated(hook, context);
+  }
+
+  return link->headIndex;
+}
+
+/**
+ * @brief 求两条链表的最长公共后缀
+ *
+ * 先让较长链表前进长度差，使两条链表尾部对齐，再同步比较一次。
+ * compare 为NULL时按链接字段地址比较，即求两条链表共享的尾部（相交点）。
+ *
+ * @param link1 第一条侵入式链表
+ * @param link2 第二条侵入式链表
+ * @param compare 对象比较函数，为NULL时比较地址
+ * @param context 透传给 compare 的用户上下文
+ * @param count 输出参数，公共后缀的长度
+ * @return IL_hook* 公共后缀在 link1 中的第一个链接字段，没有公共后缀返回NULL
+ */
+IL_hook *IL_sameSuffix(IL_link *const link1, IL_link *const link2,
+                       IL_compareFn compare, void *const context,
+                       uint32 *const count) {
+  IL_hook *a = link1->headIndex;
+  IL_hook *b = link2->headIndex;
+  for (uint32 i = link2->length; i < link1->length; i++)
+    a = a->next;
+  for (uint32 i = link1->length; i < link2->length; i++)
+    b = b->next;
+
+  IL_hook *start = NULL;
+  *count = 0;
+  for (; a && b; a = a->next, b = b->next) {
+    if (compare ? compare(a, b, context) == 0 : a == b) {
+      if (!start)
+        start = a;
+      (*count)++;
+    } else {
+      start = NULL;
+      *count = 0;
+    }
+  }
+  return start;
+}
+
+/** @} */ // 侵入式单向链表
@@ -0,0 +1,177 @@
+/*
+ * @file sl_lfqueue.c
+ * @brief 基于 SL_node 的无锁多生产者多消费者队列实现文件
+ * @author ringtree
+ * @date 2025-09-24
+ * @version 1.0
+ *
+ * 本文件实现了 sl_lfqueue.h 中声明的队列操作。风险指针槽位用法：
+ * - 槽位0：当前读取的 head 或 tail 节点；
+ * - 槽位1：出队时 head 的后继节点（读取其 data 前必须受保护）。
+ */
+#include <stdlib.h>
+
+#include "other.h"
+#include "sl_lfqueue.h"
+#include "sl_log.h"
+
+/**
+ * @addtogroup 无锁队列
+ * @{
+ */
+
+/**
+ * @brief 风险指针回收函数（队列节点均由 malloc 分配）
+ */
+static void LQ_reclaim(void *ptr) { free(ptr); }
+
+/**
+ * @brief 创建空的无锁队列
+ *
+ * @return SL_lfQueue* 新队列，内存分配失败返回NULL
+ */
+SL_lfQueue *LQ_inifQueue(void) {
+  SL_lfQueue *queue =
+      (SL_lfQueue *)SL_alignedAlloc(sizeof(SL_lfQueue), SL_CACHE_LINE);
+  SL_node *dummy = (SL_node *)malloc(sizeof(SL_node));
+  SL_hpDomain *hp = SL_inifHpDomain(LQ_reclaim);
+  if (!queue || !dummy || !hp) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    SL_alignedFree(queue);
+    free(dummy);
+    SL_freeHpDomain(hp);
+    return NULL;
+  }
+
+  dummy->data = 0;
+  atomic_init(LQ_NEXT(dummy), NULL);
+  atomic_init(&queue->head, dummy);
+  atomic_init(&queue->tail, dummy);
+  queue->hp = hp;
+
+  return queue;
+}
+
+/**
+ * @brief 为当前线程取得访问队列所需的线程记录
+ *
+ * @param queue 无锁队列
+ * @return SL_hpRecord* 线程记录，线程数超过 SL_HP_MAX_THREADS 时返回NULL
+ */
+SL_hpRecord *LQ_attach(SL_lfQueue *const queue) {
+  return SL_hpAcquire(queue->hp);
+}
+
+/**
+ * @brief 归还线程记录
+ *
+ * @param queue 无锁队列
+ * @param record LQ_attach() 返回的线程记录
+ */
+void LQ_detach(SL_lfQueue *const queue, SL_hpRecord *const record) {
+  SL_hpRelease(queue->hp, record);
+}
+
+/**
+ * @brief 在队尾添加新节点（SL_add 的无锁版本）
+ *
+ * @param queue 无锁队列
+ * @param record 当前线程的记录
+ * @param data 新节点数据
+ * @return uint16 成功返回1，内存分配失败返回0
+ */
+uint16 LQ_add(SL_lfQueue *const queue, SL_hpRecord *const record,
+              const Elemtype data) {
+  SL_node *node = (SL_node *)malloc(sizeof(SL_node));
+  if (!node) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return 0;
+  }
+  node->data = data;
+  atomic_init(LQ_NEXT(node), NULL);
+
+  for (;;) {
+    SL_node *tail = (SL_node *)SL_hpProtect(
+        record, 0, (_Atomic(void *) *)&queue->tail);
+    SL_node *next = atomic_load(LQ_NEXT(tail));
+    if (tail != atomic_load(&queue->tail))
+      continue;
+
+    if (next != NULL) { // tail 落后，帮助推进后重试
+      atomic_compare_exchange_strong(&queue->tail, &tail, next);
+      continue;
+    }
+
+    if (atomic_compare_exchange_weak(LQ_NEXT(tail), &next, node)) {
+      // 推进失败说明其他线程已帮助推进
+      atomic_compare_exchange_strong(&queue->tail, &tail, node);
+      break;
+    }
+  }
+
+  SL_hpSet(record, 0, NULL);
+  return 1;
+}
+
+/**
+ * @brief 删除队首节点（SL_delHead 的无锁版本）
+ *
+ * @param queue 无锁队列
+ * @param record 当前线程的记录
+ * @param outData 输出被删除节点的数据
+ * @return uint16 成功返回1，队列为空返回0
+ */
+uint16 LQ_delHead(SL_lfQueue *const queue, SL_hpRecord *const record,
+                  Elemtype *const outData) {
+  for (;;) {
+    SL_node *head = (SL_node *)SL_hpProtect(
+        record, 0, (_Atomic(void *) *)&queue->head);
+    SL_node *tail = atomic_load(&queue->tail);
+    SL_node *next = atomic_load(LQ_NEXT(head));
+    SL_hpSet(record, 1, next);
+    // head 未变化说明 next 尚未出队，登记的风险指针有效
+    if (head != atomic_load(&queue->head))
+      continue;
+
+    if (next == NULL) {
+      SL_hpClear(record);
+      return 0;
+    }
+
+    if (head == tail) { // tail 落后，帮助推进后重试
+      atomic_compare_exchange_strong(&queue->tail, &tail, next);
+      continue;
+    }
+
+    Elemtype data = next->data;
+    if (atomic_compare_exchange_weak(&queue->head, &head, next)) {
+      SL_hpClear(record);
+      SL_hpRetire(queue->hp, record, head);
+      *outData = data;
+      return 1;
+    }
+  }
+}
+
+/**
+ * @brief 释放队列及其中剩余的节点
+ *
+ * @param queue 无锁队列，传入NULL时直接返回
+ * @warning 调用时所有线程都必须已停止访问该队列。
+ */
+void LQ_freeQueue(SL_lfQueue *queue) {
+  if (queue == NULL)
+    return;
+
+  SL_node *cur = atomic_load(&queue->head);
+  while (cur != NULL) {
+    SL_node *next = atomic_load(LQ_NEXT(cur));
+    free(cur);
+    cur = next;
+  }
+
+  SL_freeHpDomain(queue->hp);
+  SL_alignedFree(queue);
+}
+
+/** @} */ // 无锁队列
@@ -0,0 +1,96 @@
+/*
+ * @file sl_log.c
+ * @brief 单向链表日志钩子实现文件
+ * @author ringtree
+ * @date 2025-10-06
+ * @version 1.0
+ *
+ * 本文件实现了 sl_log.h 中声明的日志接口。
+ * 钩子与上下文应在启动其它线程之前设置；级别可随时修改。
+ */
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "sl_log.h"
+
+/**
+ * @addtogroup 日志钩子
+ * @{
+ */
+
+static SL_logFn SL_logHook = SL_logStdout;      ///< 当前钩子，NULL时不输出
+static void *SL_logContext = NULL;              ///< 钩子的用户上下文
+static _Atomic int32 SL_logLevel = SL_LOG_WARN; ///< 输出的最低级别
+
+/**
+ * @brief 设置日志钩子
+ *
+ * @param hook 日志钩子，传入NULL时丢弃全部消息
+ * @param context 透传给 hook 的用户上下文
+ */
+void SL_setLogHook(SL_logFn hook, void *const context) {
+  SL_logHook = hook;
+  SL_logContext = context;
+}
+
+/**
+ * @brief 设置输出的最低级别（低于该级别的消息被丢弃）
+ *
+ * @param level 最低级别，SL_LOG_OFF 关闭全部输出
+ */
+void SL_setLogLevel(const enum SL_logLevel level) {
+  atomic_store_explicit(&SL_logLevel, (int32)level, memory_order_relaxed);
+}
+
+/**
+ * @brief 获取当前输出的最低级别
+ *
+ * @return enum SL_logLevel 最低级别
+ */
+enum SL_logLevel SL_getLogLevel(void) {
+  return (enum SL_logLevel)atomic_load_explicit(&SL_logLevel,
+                                                memory_order_relaxed);
+}
+
+/**
+ * @brief 默认日志钩子：把消息加换行写到 stdout
+ *
+ * @param level 日志级别（未使用）
+ * @param message 消息
+ * @param context 用户上下文（未使用）
+ */
+void SL_logStdout(const enum SL_logLevel level, const char *const message,
+                  void *const context) {
+  (void)level;
+  (void)context;
+  fputs(message, stdout);
+  fputc('\n', stdout);
+}
+
+/**
+ * @brief 按 printf 格式输出一条日志
+ *
+ * 级别低于当前设置或未设置钩子时直接返回，不格式化消息。
+ *
+ * @param level 日志级别
+ * @param format printf 格式串
+ * @param ... 格式参数
+ */
+void SL_log(const enum SL_logLevel level, const char *const format, ...) {
+  if ((int32)level < atomic_load_explicit(&SL_logLevel, memory_order_relaxed))
+    return;
+  SL_logFn hook = SL_logHook;
+  if (hook == NULL)
+    return;
+
+  char message[SL_LOG_MAX_MESSAGE];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+
+  hook(level, message, SL_logContext);
+}
+
+/** @} */ // 日志钩子
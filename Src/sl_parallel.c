@@ -0,0 +1,671 @@
+/*
+ * @file sl_parallel.c
+ * @brief 单向链表并行分段遍历与归约实现文件
+ * @author ringtree
+ * @date 2025-09-30
+ * @version 1.0
+ *
+ * 本文件实现了 sl_parallel.h 中声明的线程池、分段表与并行归约：
+ * - 每次调用构造一个任务（PL_job），线程池中每个线程执行一次 PL_worker()；
+ * - 线程按原子计数领取工作线程编号，编号 w 初始负责第 w 个段区间；
+ * - 段区间以 (起点 << 32 | 终点) 的形式存放在独立缓存行的原子变量中，
+ *   所有者从起点取段，窃取者从终点取段，两者都通过 CAS 修改同一个字，
+ *   因此每个段恰好被执行一次；
+ * - 节点存储链表按 PL_BLOCK 个元素一批拷贝到栈上数组后交给计算内核，
+ *   顺序存储链表直接把数组片段交给计算内核。
+ */
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sl_hazard.h"
+#include "sl_log.h"
+#include "sl_parallel.h"
+#include "sl_vector.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 节点存储链表每批交给计算内核的元素个数
+ */
+#define PL_BLOCK 256
+
+/**
+ * @addtogroup 并行遍历
+ * @{
+ */
+
+typedef struct PL_job PL_job;
+
+/**
+ * @brief 计算内核：把连续的 count 个元素累加到本段的部分结果 acc 中
+ */
+typedef void (*PL_kernel)(PL_job *const job, void *const acc,
+                          const Elemtype *const block, const uint32 count);
+
+/**
+ * @brief 工作线程的段区间（独占一个缓存行，避免伪共享）
+ */
+typedef struct PL_range {
+  _Alignas(SL_CACHE_LINE) _Atomic(uint64) bounds; ///< 起点 << 32 | 终点
+} PL_range;
+
+/**
+ * @brief 一次并行调用的任务描述
+ */
+struct PL_job {
+  PL_range ranges[PL_MAX_THREADS]; ///< 各工作线程的段区间
+  PL_split *split;                 ///< 分段表
+  enum PL_schedule schedule;       ///< 调度方式
+  uint32 workers;                  ///< 参与的工作线程数
+  atomic_uint nextWorker;          ///< 下一个可领取的工作线程编号
+  atomic_int failed;               ///< 计算内核内存分配失败
+  PL_kernel kernel;                ///< 计算内核
+  uint8_t *accs;                   ///< 各段部分结果（segments * accSize 字节）
+  uint32 accSize;                  ///< 每个部分结果的字节数
+  Elemtype findData;               ///< PL_count() 的目标值
+  PL_predicate predicate;          ///< PL_countIf() / PL_filter() 的谓词
+  PL_mapFn map;                    ///< PL_mapReduce() 的映射函数
+  void *context;                   ///< 用户上下文
+};
+
+/**
+ * @brief PL_filter() 每段的输出缓冲
+ */
+typedef struct PL_buffer {
+  Elemtype *data;  ///< 满足条件的元素
+  uint32 count;    ///< 元素个数
+  uint32 capacity; ///< 缓冲容量
+} PL_buffer;
+
+/**
+ * @brief 获取在线处理器数量
+ */
+static uint32 PL_cpuCount(void) {
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  return cpus > 0 ? (uint32)cpus : 1;
+}
+
+/**
+ * @brief 线程池工作线程入口：等待任务、执行、汇报完成
+ */
+static void *PL_poolThread(void *arg) {
+  PL_pool *pool = (PL_pool *)arg;
+  uint64 seen = 0;
+
+  pthread_mutex_lock(&pool->lock);
+  for (;;) {
+    while (!pool->stop && pool->generation == seen)
+      pthread_cond_wait(&pool->wake, &pool->lock);
+    if (pool->stop)
+      break;
+
+    seen = pool->generation;
+    void (*task)(void *const) = pool->task;
+    void *taskArg = pool->arg;
+    pthread_mutex_unlock(&pool->lock);
+
+    task(taskArg);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->running == 0)
+      pthread_cond_broadcast(&pool->done);
+  }
+  pthread_mutex_unlock(&pool->lock);
+
+  return NULL;
+}
+
+/**
+ * @brief 让线程池中每个线程执行一次 task(arg)，全部完成后返回
+ */
+static void PL_poolRun(PL_pool *const pool, void (*task)(void *const),
+                       void *const arg) {
+  pthread_mutex_lock(&pool->lock);
+  while (pool->running) // 等待其它调用者提交的任务结束
+    pthread_cond_wait(&pool->done, &pool->lock);
+
+  pool->task = task;
+  pool->arg = arg;
+  pool->running = pool->threadCount;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->wake);
+
+  while (pool->running)
+    pthread_cond_wait(&pool->done, &pool->lock);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * @brief 创建线程池
+ *
+ * @param threads 工作线程数，0 表示在线处理器数量，超过 PL_MAX_THREADS 时截断
+ * @return PL_pool* 线程池，内存分配或线程创建全部失败时返回NULL
+ * @note 部分线程创建失败时以已创建的线程继续工作。
+ */
+PL_pool *PL_inifPool(uint32 threads) {
+  if (threads == 0)
+    threads = PL_cpuCount();
+  if (threads > PL_MAX_THREADS)
+    threads = PL_MAX_THREADS;
+
+  PL_pool *pool = (PL_pool *)malloc(sizeof(PL_pool));
+  if (!pool) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->wake, NULL);
+  pthread_cond_init(&pool->done, NULL);
+  pool->generation = 0;
+  pool->running = 0;
+  pool->stop = 0;
+  pool->task = NULL;
+  pool->arg = NULL;
+  pool->threadCount = 0;
+
+  for (uint32 t = 0; t < threads; t++) {
+    if (pthread_create(&pool->threads[t], NULL, PL_poolThread, pool) != 0)
+      break;
+    pool->threadCount++;
+  }
+
+  if (pool->threadCount == 0) {
+    SL_log(SL_LOG_ERROR, "错误：线程池创建线程失败");
+    PL_freePool(pool);
+    return NULL;
+  }
+
+  return pool;
+}
+
+/**
+ * @brief 关闭并释放线程池（等待所有工作线程退出）
+ *
+ * @param pool 线程池，传入NULL时直接返回
+ */
+void PL_freePool(PL_pool *pool) {
+  if (pool == NULL)
+    return;
+
+  pthread_mutex_lock(&pool->lock);
+  pool->stop = 1;
+  pthread_cond_broadcast(&pool->wake);
+  pthread_mutex_unlock(&pool->lock);
+
+  for (uint32 t = 0; t < pool->threadCount; t++)
+    pthread_join(pool->threads[t], NULL);
+
+  pthread_mutex_destroy(&pool->lock);
+  pthread_cond_destroy(&pool->wake);
+  pthread_cond_destroy(&pool->done);
+  free(pool);
+}
+
+/**
+ * @brief 创建分段表并立即分段
+ *
+ * @param link 被分段的链表
+ * @param segments 段数，0 表示在线处理器数量 * PL_SEGMENTS_PER_THREAD
+ * @return PL_split* 分段表，内存分配失败返回NULL
+ * @note 分段表不拥有链表，链表必须在分段表释放之后再释放。
+ */
+PL_split *PL_inifSplit(SL_link *const link, const uint32 segments) {
+  if (link == NULL)
+    return NULL;
+
+  PL_split *split = (PL_split *)malloc(sizeof(PL_split));
+  if (!split) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  split->link = link;
+  split->requested =
+      segments ? segments : PL_cpuCount() * PL_SEGMENTS_PER_THREAD;
+  split->segments = 0;
+  split->version = link->version - 1; // 强制首次分段
+  split->length = 0;
+  split->starts = (SL_node **)malloc(sizeof(SL_node *) * split->requested);
+  split->offsets = (uint32 *)malloc(sizeof(uint32) * (split->requested + 1));
+  if (!(split->starts && split->offsets)) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    PL_freeSplit(split);
+    return NULL;
+  }
+
+  PL_refreshSplit(split);
+  return split;
+}
+
+/**
+ * @brief 链表修改后重新分段
+ *
+ * link->version 未变化时直接返回；否则一次遍历重新记录各段起点，
+ * 各段长度相差不超过1。顺序存储链表只需计算下标。
+ *
+ * @param split 分段表
+ * @return uint16 分段表此前有效返回0，本次重新分段返回1
+ */
+uint16 PL_refreshSplit(PL_split *const split) {
+  SL_link *link = split->link;
+  if (split->version == link->version && split->length == link->length)
+    return 0;
+
+  uint32 length = link->length;
+  uint32 segments = length < split->requested ? length : split->requested;
+  split->offsets[0] = 0;
+  for (uint32 s = 1; s <= segments; s++)
+    split->offsets[s] = (uint32)((uint64)length * s / segments);
+
+  if (!link->vector) {
+    SL_node *cur = link->headIndex;
+    uint32 index = 0;
+    for (uint32 s = 0; s < segments; s++) {
+      for (; index < split->offsets[s]; index++)
+        cur = cur->next;
+      split->starts[s] = cur;
+    }
+  }
+
+  split->segments = segments;
+  split->length = length;
+  split->version = link->version;
+  return 1;
+}
+
+/**
+ * @brief 释放分段表（不释放链表）
+ *
+ * @param split 分段表，传入NULL时直接返回
+ */
+void PL_freeSplit(PL_split *split) {
+  if (split == NULL)
+    return;
+  free(split->starts);
+  free(split->offsets);
+  free(split);
+}
+
+/**
+ * @brief 处理一个段：按批把元素交给计算内核
+ */
+static void PL_runSegment(PL_job *const job, const uint32 segment) {
+  PL_split *split = job->split;
+  void *acc = job->accs + (size_t)segment * job->accSize;
+  uint32 begin = split->offsets[segment];
+  uint32 count = split->offsets[segment + 1] - begin;
+
+  if (split->link->vector) {
+    job->kernel(job, acc, SV_DATA(split->link) + begin, count);
+    return;
+  }
+
+  Elemtype block[PL_BLOCK];
+  SL_node *cur = split->starts[segment];
+  while (count) {
+    uint32 batch = count < PL_BLOCK ? count : PL_BLOCK;
+    for (uint32 i = 0; i < batch; i++, cur = cur->next)
+      block[i] = cur->data;
+    job->kernel(job, acc, block, batch);
+    count -= batch;
+  }
+}
+
+/**
+ * @brief 从段区间起点取一个段（所有者使用）
+ *
+ * @return uint32 段号，区间为空时返回UINT32_MAX
+ */
+static uint32 PL_takeFront(PL_range *const range) {
+  uint64 bounds = atomic_load(&range->bounds);
+  for (;;) {
+    uint32 begin = (uint32)(bounds >> 32);
+    uint32 end = (uint32)bounds;
+    if (begin >= end)
+      return UINT32_MAX;
+    uint64 next = ((uint64)(begin + 1) << 32) | end;
+    if (atomic_compare_exchange_weak(&range->bounds, &bounds, next))
+      return begin;
+  }
+}
+
+/**
+ * @brief 从段区间终点取一个段（窃取者使用）
+ *
+ * @return uint32 段号，区间为空时返回UINT32_MAX
+ */
+static uint32 PL_takeBack(PL_range *const range) {
+  uint64 bounds = atomic_load(&range->bounds);
+  for (;;) {
+    uint32 begin = (uint32)(bounds >> 32);
+    uint32 end = (uint32)bounds;
+    if (begin >= end)
+      return UINT32_MAX;
+    uint64 next = ((uint64)begin << 32) | (end - 1);
+    if (atomic_compare_exchange_weak(&range->bounds, &bounds, next))
+      return end - 1;
+  }
+}
+
+/**
+ * @brief 线程池任务：领取工作线程编号后处理自己的段区间，
+ *        窃取模式下再从其它线程的区间尾部窃取，直到所有区间为空
+ */
+static void PL_worker(void *const arg) {
+  PL_job *job = (PL_job *)arg;
+  uint32 worker = atomic_fetch_add(&job->nextWorker, 1);
+  if (worker >= job->workers)
+    return;
+
+  PL_range *own = &job->ranges[worker];
+  if (job->schedule == PL_STATIC) {
+    uint64 bounds = atomic_load_explicit(&own->bounds, memory_order_relaxed);
+    for (uint32 s = (uint32)(bounds >> 32); s < (uint32)bounds; s++)
+      PL_runSegment(job, s);
+    return;
+  }
+
+  uint32 segment;
+  while ((segment = PL_takeFront(own)) != UINT32_MAX)
+    PL_runSegment(job, segment);
+
+  for (uint16 found = 1; found;) { // 一整轮都没有窃取到时结束
+    found = 0;
+    for (uint32 i = 1; i < job->workers; i++) {
+      PL_range *victim = &job->ranges[(worker + i) % job->workers];
+      while ((segment = PL_takeBack(victim)) != UINT32_MAX) {
+        PL_runSegment(job, segment);
+        found = 1;
+      }
+    }
+  }
+}
+
+/**
+ * @brief 准备并执行一次并行调用
+ *
+ * 刷新分段表、为每段分配部分结果（以 identity 初始化）、
+ * 按调度方式划分段区间后交给线程池。
+ *
+ * @param identity 部分结果初值，为NULL时清零
+ * @return uint16 成功返回1，内存分配失败返回0（job->accs 为NULL）
+ */
+static uint16 PL_execute(PL_pool *const pool, PL_job *const job,
+                         const void *const identity) {
+  PL_refreshSplit(job->split);
+  uint32 segments = job->split->segments;
+
+  job->accs = (uint8_t *)malloc((size_t)job->accSize * (segments ? segments : 1));
+  if (!job->accs) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return 0;
+  }
+  for (uint32 s = 0; s < segments; s++) {
+    if (identity)
+      memcpy(job->accs + (size_t)s * job->accSize, identity, job->accSize);
+    else
+      memset(job->accs + (size_t)s * job->accSize, 0, job->accSize);
+  }
+  if (segments == 0)
+    return 1;
+
+  job->workers = pool->threadCount < segments ? pool->threadCount : segments;
+  atomic_init(&job->nextWorker, 0);
+  atomic_init(&job->failed, 0);
+  for (uint32 w = 0; w < job->workers; w++) {
+    uint64 begin = (uint64)segments * w / job->workers;
+    uint64 end = (uint64)segments * (w + 1) / job->workers;
+    atomic_init(&job->ranges[w].bounds, (begin << 32) | end);
+  }
+
+  PL_poolRun(pool, PL_worker, job);
+  return 1;
+}
+
+/**
+ * @brief PL_count() 的计算内核
+ */
+static void PL_countKernel(PL_job *const job, void *const acc,
+                           const Elemtype *const block, const uint32 count) {
+  uint32 matches = 0;
+  for (uint32 i = 0; i < count; i++)
+    matches += block[i] == job->findData;
+  *(uint32 *)acc += matches;
+}
+
+/**
+ * @brief 并行统计指定值出现的次数（与 SL_count 结果相同）
+ *
+ * @param pool 线程池
+ * @param split 分段表（链表修改后自动重新分段）
+ * @param schedule 调度方式
+ * @param findData 要统计的值
+ * @return uint32 出现次数；内存分配失败返回UINT32_MAX
+ */
+uint32 PL_count(PL_pool *const pool, PL_split *const split,
+                enum PL_schedule schedule, const Elemtype findData) {
+  PL_job job;
+  job.split = split;
+  job.schedule = schedule;
+  job.kernel = PL_countKernel;
+  job.accSize = sizeof(uint32);
+  job.findData = findData;
+  if (!PL_execute(pool, &job, NULL))
+    return UINT32_MAX;
+
+  uint32 total = 0;
+  for (uint32 s = 0; s < split->segments; s++)
+    total += ((uint32 *)job.accs)[s];
+  free(job.accs);
+  return total;
+}
+
+/**
+ * @brief PL_reduce() 的计算内核
+ */
+static void PL_reduceKernel(PL_job *const job, void *const acc,
+                            const Elemtype *const block, const uint32 count) {
+  (void)job;
+  PL_result *result = (PL_result *)acc;
+  int64 sum = 0;
+  Elemtype min = result->min;
+  Elemtype max = result->max;
+  for (uint32 i = 0; i < count; i++) {
+    sum += block[i];
+    min = block[i] < min ? block[i] : min;
+    max = block[i] > max ? block[i] : max;
+  }
+  result->count += count;
+  result->sum += sum;
+  result->min = min;
+  result->max = max;
+}
+
+/**
+ * @brief 并行计算元素个数、总和、最小值与最大值
+ *
+ * @param pool 线程池
+ * @param split 分段表
+ * @param schedule 调度方式
+ * @return PL_result 归约结果；链表为空或内存分配失败时 count 为0
+ */
+PL_result PL_reduce(PL_pool *const pool, PL_split *const split,
+                    enum PL_schedule schedule) {
+  PL_result total = {0, 0, INT32_MAX, INT32_MIN};
+  PL_job job;
+  job.split = split;
+  job.schedule = schedule;
+  job.kernel = PL_reduceKernel;
+  job.accSize = sizeof(PL_result);
+  if (!PL_execute(pool, &job, &total))
+    return total;
+
+  for (uint32 s = 0; s < split->segments; s++) {
+    PL_result *part = (PL_result *)job.accs + s;
+    total.count += part->count;
+    total.sum += part->sum;
+    total.min = part->min < total.min ? part->min : total.min;
+    total.max = part->max > total.max ? part->max : total.max;
+  }
+  free(job.accs);
+  return total;
+}
+
+/**
+ * @brief PL_countIf() 的计算内核
+ */
+static void PL_countIfKernel(PL_job *const job, void *const acc,
+                             const Elemtype *const block, const uint32 count) {
+  uint32 matches = 0;
+  for (uint32 i = 0; i < count; i++)
+    matches += job->predicate(block[i], job->context) != 0;
+  *(uint32 *)acc += matches;
+}
+
+/**
+ * @brief 并行统计满足谓词的元素个数
+ *
+ * @param pool 线程池
+ * @param split 分段表
+ * @param schedule 调度方式（谓词代价不均时建议 PL_STEALING）
+ * @param predicate 谓词，会被多个线程同时调用
+ * @param context 传给谓词的用户上下文
+ * @return uint32 满足条件的元素个数；内存分配失败返回UINT32_MAX
+ */
+uint32 PL_countIf(PL_pool *const pool, PL_split *const split,
+                  enum PL_schedule schedule, PL_predicate predicate,
+                  void *const context) {
+  PL_job job;
+  job.split = split;
+  job.schedule = schedule;
+  job.kernel = PL_countIfKernel;
+  job.accSize = sizeof(uint32);
+  job.predicate = predicate;
+  job.context = context;
+  if (!PL_execute(pool, &job, NULL))
+    return UINT32_MAX;
+
+  uint32 total = 0;
+  for (uint32 s = 0; s < split->segments; s++)
+    total += ((uint32 *)job.accs)[s];
+  free(job.accs);
+  return total;
+}
+
+/**
+ * @brief PL_filter() 的计算内核
+ */
+static void PL_filterKernel(PL_job *const job, void *const acc,
+                            const Elemtype *const block, const uint32 count) {
+  PL_buffer *buffer = (PL_buffer *)acc;
+  for (uint32 i = 0; i < count; i++) {
+    if (!job->predicate(block[i], job->context))
+      continue;
+    if (buffer->count == buffer->capacity) {
+      uint32 capacity = buffer->capacity ? buffer->capacity * 2 : PL_BLOCK;
+      Elemtype *data =
+          (Elemtype *)realloc(buffer->data, sizeof(Elemtype) * capacity);
+      if (!data) {
+        atomic_store(&job->failed, 1);
+        return;
+      }
+      buffer->data = data;
+      buffer->capacity = capacity;
+    }
+    buffer->data[buffer->count++] = block[i];
+  }
+}
+
+/**
+ * @brief 并行筛选满足谓词的元素，按原顺序保存到新链表
+ *
+ * @param pool 线程池
+ * @param split 分段表
+ * @param schedule 调度方式
+ * @param predicate 谓词，会被多个线程同时调用
+ * @param context 传给谓词的用户上下文
+ * @return SL_link* 新链表（带私有节点池），内存分配失败返回NULL
+ * @note 返回的链表需使用 SL_freeLinks() 释放。
+ */
+SL_link *PL_filter(PL_pool *const pool, PL_split *const split,
+                   enum PL_schedule schedule, PL_predicate predicate,
+                   void *const context) {
+  PL_job job;
+  job.split = split;
+  job.schedule = schedule;
+  job.kernel = PL_filterKernel;
+  job.accSize = sizeof(PL_buffer);
+  job.predicate = predicate;
+  job.context = context;
+  if (!PL_execute(pool, &job, NULL))
+    return NULL;
+
+  SL_link *result = atomic_load(&job.failed) ? NULL : SL_inifLinkPool(NULL);
+  for (uint32 s = 0; s < split->segments; s++) {
+    PL_buffer *buffer = (PL_buffer *)job.accs + s;
+    if (result && buffer->count &&
+        SL_appendArray(result, buffer->data, buffer->count) != buffer->count) {
+      SL_freeLinks(result);
+      result = NULL;
+    }
+    free(buffer->data);
+  }
+  free(job.accs);
+
+  if (!result)
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+  return result;
+}
+
+/**
+ * @brief PL_mapReduce() 的计算内核
+ */
+static void PL_mapKernel(PL_job *const job, void *const acc,
+                         const Elemtype *const block, const uint32 count) {
+  for (uint32 i = 0; i < count; i++)
+    job->map(acc, block[i], job->context);
+}
+
+/**
+ * @brief 并行执行用户自定义的 map / reduce
+ *
+ * 每段的部分结果以 acc 的当前内容为初值（因此 acc 传入时必须是归约的单位元），
+ * 各段内对每个元素调用 map，最后按段号顺序调用 combine 合并到 acc。
+ *
+ * @param pool 线程池
+ * @param split 分段表
+ * @param schedule 调度方式
+ * @param map 映射函数，会被多个线程同时调用（每个线程只写自己的部分结果）
+ * @param combine 合并函数，在调用线程中串行执行
+ * @param acc 输入为单位元，输出为归约结果
+ * @param accSize 部分结果的字节数
+ * @param context 传给 map / combine 的用户上下文
+ * @return uint16 成功返回1，内存分配失败返回0
+ */
+uint16 PL_mapReduce(PL_pool *const pool, PL_split *const split,
+                    enum PL_schedule schedule, PL_mapFn map,
+                    PL_combineFn combine, void *const acc,
+                    const uint32 accSize, void *const context) {
+  if (accSize == 0)
+    return 0;
+
+  PL_job job;
+  job.split = split;
+  job.schedule = schedule;
+  job.kernel = PL_mapKernel;
+  job.accSize = accSize;
+  job.map = map;
+  job.context = context;
+  if (!PL_execute(pool, &job, acc))
+    return 0;
+
+  for (uint32 s = 0; s < split->segments; s++)
+    combine(acc, job.accs + (size_t)s * accSize, context);
+  free(job.accs);
+  return 1;
+}
+
+/** @} */ // 并行遍历
@@ -0,0 +1,191 @@
+/*
+ * @file sl_pool.c
+ * @brief 单向链表节点池实现文件
+ * @author ringtree
+ * @date 2025-08-30
+ * @version 1.0
+ *
+ * 本文件实现了 sl_pool.h 中声明的节点池操作：
+ * - 节点优先从空闲链表取出，其次从当前节点块中切分，最后才申请新块；
+ * - 释放节点只是把节点挂回空闲链表，不调用 free()；
+ * - 重置/释放节点池只需逐块 free()，代价为 O(块数)。
+ */
+#include <stdlib.h>
+
+#include "sl_pool.h"
+
+/**
+ * @addtogroup 单向链表节点池
+ * @{
+ */
+
+/**
+ * @brief 申请一个新的节点块并挂到节点池块链表头部
+ *
+ * @param pool 节点池指针
+ * @param capacity 新节点块可容纳的节点数
+ * @return SL_slab* 新节点块指针，内存分配失败返回NULL
+ */
+static SL_slab *SL_poolGrow(SL_pool *const pool, const uint32 capacity) {
+  SL_slab *slab =
+      (SL_slab *)malloc(sizeof(SL_slab) + sizeof(SL_node) * capacity);
+  if (!slab)
+    return NULL; // 由调用者报告，SL_try* 路径不产生输出
+
+  slab->capacity = capacity;
+  slab->used = 0;
+  slab->next = pool->slabs;
+  pool->slabs = slab;
+  pool->slabCount++;
+
+  return slab;
+}
+
+/**
+ * @brief 创建并初始化一个节点池
+ *
+ * 创建时不预先申请节点块，第一次分配节点时才申请。
+ *
+ * @param slabNodes 每个节点块容纳的节点数，传入0时使用 SL_POOL_SLAB_NODES
+ * @return SL_pool* 新节点池指针，内存分配失败返回NULL
+ * @note 共享节点池需调用 SL_freePool() 释放。
+ */
+SL_pool *SL_inifPool(const uint32 slabNodes) {
+  SL_pool *pool = (SL_pool *)malloc(sizeof(SL_pool));
+  if (!pool)
+    return NULL; // 由调用者报告
+
+  pool->slabs = NULL;
+  pool->freeList = NULL;
+  pool->slabNodes = slabNodes ? slabNodes : SL_POOL_SLAB_NODES;
+  pool->slabCount = 0;
+
+  return pool;
+}
+
+/**
+ * @brief 从节点池中取出一个节点
+ *
+ * 优先复用空闲链表中的节点，其次从当前节点块切分，均不可用时申请新块。
+ *
+ * @param pool 节点池指针
+ * @return SL_node* 未初始化的节点指针，内存分配失败返回NULL
+ */
+SL_node *SL_poolAlloc(SL_pool *const pool) {
+  SL_node *node = pool->freeList;
+  if (node) { // 复用回收节点
+    pool->freeList = node->next;
+    return node;
+  }
+
+  SL_slab *slab = pool->slabs;
+  if (!slab || slab->used == slab->capacity) { // 当前块已用完
+    slab = SL_poolGrow(pool, pool->slabNodes);
+    if (!slab)
+      return NULL;
+  }
+
+  return &slab->nodes[slab->used++];
+}
+
+/**
+ * @brief 从节点池中取出一段连续的节点
+ *
+ * 当前节点块剩余空间足够时直接切分；否则单独申请一个恰好容纳 count
+ * 个节点的新块，并把它挂在当前块之后，当前块的剩余空间仍可继续使用。
+ * 返回的节点不经过空闲链表，保证在内存中连续，适合批量建表。
+ *
+ * @param pool 节点池指针
+ * @param count 需要的节点数量（大于0）
+ * @return SL_node* 连续 count 个未初始化节点的首地址，内存分配失败返回NULL
+ */
+SL_node *SL_poolAllocBlock(SL_pool *const pool, const uint32 count) {
+  SL_slab *slab = pool->slabs;
+  if (slab && slab->capacity - slab->used >= count) { // 当前块剩余空间足够
+    SL_node *block = &slab->nodes[slab->used];
+    slab->used += count;
+    return block;
+  }
+
+  SL_slab *current = pool->slabs;
+  slab = SL_poolGrow(pool, count);
+  if (!slab)
+    return NULL;
+  slab->used = count;
+
+  if (current && current->used < current->capacity) {
+    // 新块已用满，挂到当前块之后，保留当前块继续切分
+    pool->slabs = current;
+    slab->next = current->next;
+    current->next = slab;
+  }
+
+  return slab->nodes;
+}
+
+/**
+ * @brief 将节点归还给节点池
+ *
+ * 节点被挂入空闲链表头部，供后续分配复用，时间复杂度O(1)。
+ *
+ * @param pool 节点池指针
+ * @param node 待归还的节点（必须来自该节点池）
+ */
+void SL_poolRelease(SL_pool *const pool, SL_node *const node) {
+  node->next = pool->freeList;
+  pool->freeList = node;
+}
+
+/**
+ * @brief 将一串节点整体归还给节点池
+ *
+ * 节点串整体挂入空闲链表头部，时间复杂度O(1)，与节点数量无关。
+ *
+ * @param pool 节点池指针
+ * @param head 节点串首节点（经 next 串接，均必须来自该节点池）
+ * @param tail 节点串尾节点
+ */
+void SL_poolReleaseChain(SL_pool *const pool, SL_node *const head,
+                         SL_node *const tail) {
+  tail->next = pool->freeList;
+  pool->freeList = head;
+}
+
+/**
+ * @brief 一次性回收节点池中的全部节点
+ *
+ * 逐块释放所有节点块并清空空闲链表，时间复杂度为O(块数)，
+ * 与节点数量无关。节点池本身保留，可继续使用。
+ *
+ * @param pool 节点池指针
+ * @warning 调用后所有从该池分配出去的节点均失效。
+ */
+void SL_poolReset(SL_pool *const pool) {
+  SL_slab *slab = pool->slabs;
+  SL_slab *next = NULL;
+
+  while (slab) {
+    next = slab->next;
+    free(slab);
+    slab = next;
+  }
+
+  pool->slabs = NULL;
+  pool->freeList = NULL;
+  pool->slabCount = 0;
+}
+
+/**
+ * @brief 释放节点池及其所有节点块
+ *
+ * @param pool 节点池指针，传入NULL时直接返回
+ */
+void SL_freePool(SL_pool *pool) {
+  if (pool == NULL)
+    return;
+
+  SL_poolReset(pool);
+  free(pool);
+}
+
+/** @} */ // 单向链表节点池
@@ -0,0 +1,477 @@
+/*
+ * @file sl_simd.c
+ * @brief 单向链表连续快照与向量化扫描实现文件
+ * @author ringtree
+ * @date 2025-09-16
+ * @version 1.0
+ *
+ * 本文件实现了 sl_simd.h 中声明的快照与扫描操作：
+ * - 每种扫描内核提供标量、SSE4.2、AVX2 三个版本；
+ * - 首次调用时按 CPU 能力选择内核表，之后直接通过函数指针调用；
+ * - 直方图统计存在随机写冲突，各平台均使用标量实现。
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "other.h"
+#include "sl_log.h"
+#include "sl_simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SL_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @addtogroup 单向链表向量化扫描
+ * @{
+ */
+
+/**
+ * @brief 快照数据对齐字节数
+ */
+#define SL_SNAPSHOT_ALIGN 64
+
+/**
+ * @brief 扫描内核表
+ */
+typedef struct SL_simdKernels {
+  const char *name; ///< 指令集名称
+  uint32 (*count)(const Elemtype *data, uint32 n, Elemtype value);
+  uint32 (*firstIndex)(const Elemtype *data, uint32 n, Elemtype value);
+  void (*absRange)(const Elemtype *data, uint32 n, uint32 *min, uint32 *max);
+  int64 (*sum)(const Elemtype *data, uint32 n);
+} SL_simdKernels;
+
+/**
+ * @brief 取绝对值（INT32_MIN 的绝对值 2^31 以无符号数表示）
+ */
+static inline uint32 SL_absU32(const Elemtype x) {
+  return x < 0 ? 0u - (uint32)x : (uint32)x;
+}
+
+/* 标量内核 --------------------------------------------------- */
+
+static uint32 SL_countScalar(const Elemtype *data, uint32 n, Elemtype value) {
+  uint32 count = 0;
+  for (uint32 i = 0; i < n; i++)
+    count += (data[i] == value);
+  return count;
+}
+
+static uint32 SL_firstIndexScalar(const Elemtype *data, uint32 n,
+                                  Elemtype value) {
+  for (uint32 i = 0; i < n; i++) {
+    if (data[i] == value)
+      return i;
+  }
+  return UINT32_MAX;
+}
+
+static void SL_absRangeScalar(const Elemtype *data, uint32 n, uint32 *min,
+                              uint32 *max) {
+  uint32 lo = *min, hi = *max;
+  for (uint32 i = 0; i < n; i++) {
+    uint32 a = SL_absU32(data[i]);
+    lo = a < lo ? a : lo;
+    hi = a > hi ? a : hi;
+  }
+  *min = lo;
+  *max = hi;
+}
+
+static int64 SL_sumScalar(const Elemtype *data, uint32 n) {
+  int64 sum = 0;
+  for (uint32 i = 0; i < n; i++)
+    sum += data[i];
+  return sum;
+}
+
+static const SL_simdKernels SL_kernelsScalar = {
+    "scalar", SL_countScalar, SL_firstIndexScalar, SL_absRangeScalar,
+    SL_sumScalar};
+
+#ifdef SL_SIMD_X86
+/* SSE4.2 内核 ------------------------------------------------ */
+
+__attribute__((target("sse4.2"))) static uint32
+SL_countSse(const Elemtype *data, uint32 n, Elemtype value) {
+  __m128i key = _mm_set1_epi32(value);
+  __m128i acc = _mm_setzero_si128();
+  uint32 i = 0;
+
+  for (; i + 4 <= n; i += 4) { // 相等时比较结果为 -1，累减即计数
+    __m128i v = _mm_load_si128((const __m128i *)(data + i));
+    acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(v, key));
+  }
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  return (uint32)_mm_cvtsi128_si32(acc) + SL_countScalar(data + i, n - i, value);
+}
+
+__attribute__((target("sse4.2"))) static uint32
+SL_firstIndexSse(const Elemtype *data, uint32 n, Elemtype value) {
+  __m128i key = _mm_set1_epi32(value);
+  uint32 i = 0;
+
+  for (; i + 4 <= n; i += 4) {
+    __m128i v = _mm_load_si128((const __m128i *)(data + i));
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, key)));
+    if (mask)
+      return i + (uint32)__builtin_ctz((unsigned)mask);
+  }
+
+  uint32 tail = SL_firstIndexScalar(data + i, n - i, value);
+  return tail == UINT32_MAX ? UINT32_MAX : i + tail;
+}
+
+__attribute__((target("sse4.2"))) static void
+SL_absRangeSse(const Elemtype *data, uint32 n, uint32 *min, uint32 *max) {
+  __m128i lo = _mm_set1_epi32((int)*min);
+  __m128i hi = _mm_set1_epi32((int)*max);
+  uint32 i = 0;
+
+  for (; i + 4 <= n; i += 4) {
+    __m128i a = _mm_abs_epi32(_mm_load_si128((const __m128i *)(data + i)));
+    lo = _mm_min_epu32(lo, a);
+    hi = _mm_max_epu32(hi, a);
+  }
+
+  uint32 los[4], his[4];
+  _mm_storeu_si128((__m128i *)los, lo);
+  _mm_storeu_si128((__m128i *)his, hi);
+  for (uint32 k = 0; k < 4; k++) {
+    *min = los[k] < *min ? los[k] : *min;
+    *max = his[k] > *max ? his[k] : *max;
+  }
+  SL_absRangeScalar(data + i, n - i, min, max);
+}
+
+__attribute__((target("sse4.2"))) static int64 SL_sumSse(const Elemtype *data,
+                                                         uint32 n) {
+  __m128i acc = _mm_setzero_si128();
+  uint32 i = 0;
+
+  for (; i + 4 <= n; i += 4) { // 扩展为64位后累加，避免溢出
+    __m128i v = _mm_load_si128((const __m128i *)(data + i));
+    acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(v));
+    acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+  }
+
+  int64 lanes[2];
+  _mm_storeu_si128((__m128i *)lanes, acc);
+  return lanes[0] + lanes[1] + SL_sumScalar(data + i, n - i);
+}
+
+static const SL_simdKernels SL_kernelsSse = {
+    "sse4.2", SL_countSse, SL_firstIndexSse, SL_absRangeSse, SL_sumSse};
+
+/* AVX2 内核 -------------------------------------------------- */
+
+__attribute__((target("avx2"))) static uint32
+SL_countAvx2(const Elemtype *data, uint32 n, Elemtype value) {
+  __m256i key = _mm256_set1_epi32(value);
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+  uint32 i = 0;
+
+  for (; i + 16 <= n; i += 16) {
+    __m256i v0 = _mm256_load_si256((const __m256i *)(data + i));
+    __m256i v1 = _mm256_load_si256((const __m256i *)(data + i + 8));
+    acc0 = _mm256_sub_epi32(acc0, _mm256_cmpeq_epi32(v0, key));
+    acc1 = _mm256_sub_epi32(acc1, _mm256_cmpeq_epi32(v1, key));
+  }
+
+  __m128i acc = _mm_add_epi32(
+      _mm256_castsi256_si128(_mm256_add_epi32(acc0, acc1)),
+      _mm256_extracti128_si256(_mm256_add_epi32(acc0, acc1), 1));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  return (uint32)_mm_cvtsi128_si32(acc) + SL_countScalar(data + i, n - i, value);
+}
+
+__attribute__((target("avx2"))) static uint32
+SL_firstIndexAvx2(const Elemtype *data, uint32 n, Elemtype value) {
+  __m256i key = _mm256_set1_epi32(value);
+  uint32 i = 0;
+
+  for (; i + 32 <= n; i += 32) { // 每次检查32个元素，命中后再细分
+    __m256i e0 = _mm256_cmpeq_epi32(
+        _mm256_load_si256((const __m256i *)(data + i)), key);
+    __m256i e1 = _mm256_cmpeq_epi32(
+        _mm256_load_si256((const __m256i *)(data + i + 8)), key);
+    __m256i e2 = _mm256_cmpeq_epi32(
+        _mm256_load_si256((const __m256i *)(data + i + 16)), key);
+    __m256i e3 = _mm256_cmpeq_epi32(
+        _mm256_load_si256((const __m256i *)(data + i + 24)), key);
+    __m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1),
+                                  _mm256_or_si256(e2, e3));
+    if (!_mm256_testz_si256(any, any))
+      break;
+  }
+  for (; i + 8 <= n; i += 8) {
+    __m256i eq = _mm256_cmpeq_epi32(
+        _mm256_load_si256((const __m256i *)(data + i)), key);
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+    if (mask)
+      return i + (uint32)__builtin_ctz((unsigned)mask);
+  }
+
+  uint32 tail = SL_firstIndexScalar(data + i, n - i, value);
+  return tail == UINT32_MAX ? UINT32_MAX : i + tail;
+}
+
+__attribute__((target("avx2"))) static void
+SL_absRangeAvx2(const Elemtype *data, uint32 n, uint32 *min, uint32 *max) {
+  __m256i lo = _mm256_set1_epi32((int)*min);
+  __m256i hi = _mm256_set1_epi32((int)*max);
+  uint32 i = 0;
+
+  for (; i + 8 <= n; i += 8) {
+    __m256i a =
+        _mm256_abs_epi32(_mm256_load_si256((const __m256i *)(data + i)));
+    lo = _mm256_min_epu32(lo, a);
+    hi = _mm256_max_epu32(hi, a);
+  }
+
+  uint32 los[8], his[8];
+  _mm256_storeu_si256((__m256i *)los, lo);
+  _mm256_storeu_si256((__m256i *)his, hi);
+  for (uint32 k = 0; k < 8; k++) {
+    *min = los[k] < *min ? los[k] : *min;
+    *max = his[k] > *max ? his[k] : *max;
+  }
+  SL_absRangeScalar(data + i, n - i, min, max);
+}
+
+__attribute__((target("avx2"))) static int64 SL_sumAvx2(const Elemtype *data,
+                                                       uint32 n) {
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+  uint32 i = 0;
+
+  for (; i + 8 <= n; i += 8) {
+    __m256i v = _mm256_load_si256((const __m256i *)(data + i));
+    acc0 = _mm256_add_epi64(
+        acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+    acc1 = _mm256_add_epi64(
+        acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+  }
+
+  int64 lanes[4];
+  _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(acc0, acc1));
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+         SL_sumScalar(data + i, n - i);
+}
+
+static const SL_simdKernels SL_kernelsAvx2 = {
+    "avx2", SL_countAvx2, SL_firstIndexAvx2, SL_absRangeAvx2, SL_sumAvx2};
+#endif /* SL_SIMD_X86 */
+
+/**
+ * @brief 获取当前 CPU 可用的扫描内核表
+ *
+ * 首次调用时检测 CPU 能力，之后直接返回缓存结果。
+ * 并发首次调用时各线程得到的结果相同，重复检测无副作用。
+ */
+static const SL_simdKernels *SL_kernels(void) {
+  static const SL_simdKernels *selected = NULL;
+  if (selected)
+    return selected;
+
+#ifdef SL_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    selected = &SL_kernelsAvx2;
+  else if (__builtin_cpu_supports("sse4.2"))
+    selected = &SL_kernelsSse;
+  else
+#endif
+    selected = &SL_kernelsScalar;
+
+  return selected;
+}
+
+/**
+ * @brief 获取运行时选用的指令集名称
+ *
+ * @return const char* "avx2"、"sse4.2" 或 "scalar"
+ */
+const char *SL_simdLevel(void) { return SL_kernels()->name; }
+
+/**
+ * @brief 为单向链表创建连续快照
+ *
+ * 创建时立即生成一次快照。
+ *
+ * @param linkedList 单向链表指针
+ * @return SL_snapshot* 快照指针，内存分配失败返回NULL
+ * @note 快照需在链表释放之前使用 SL_freeSnapshot() 释放。
+ */
+SL_snapshot *SL_inifSnapshot(SL_link *const linkedList) {
+  if (linkedList == NULL)
+    return NULL;
+
+  SL_snapshot *snap = (SL_snapshot *)malloc(sizeof(SL_snapshot));
+  if (!snap) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  snap->link = linkedList;
+  snap->data = NULL;
+  snap->length = 0;
+  snap->capacity = 0;
+  snap->version = 0;
+  snap->valid = 0;
+
+  if (!SL_snapshotRefresh(snap) && !snap->valid) {
+    SL_freeSnapshot(snap);
+    return NULL;
+  }
+
+  return snap;
+}
+
+/**
+ * @brief 按需重建快照
+ *
+ * 链表版本号与快照记录的不一致时，重新遍历链表打包数据。
+ *
+ * @param snap 快照指针
+ * @return uint16 发生重建返回1，快照仍有效或重建失败返回0
+ */
+uint16 SL_snapshotRefresh(SL_snapshot *const snap) {
+  SL_link *linkedList = snap->link;
+  if (snap->valid && snap->version == linkedList->version)
+    return 0;
+
+  if (linkedList->length > snap->capacity) { // 扩容，按 1.5 倍预留
+    uint64 capacity = (uint64)linkedList->length + linkedList->length / 2;
+    if (capacity > UINT32_MAX)
+      capacity = UINT32_MAX;
+    Elemtype *data = (Elemtype *)SL_alignedAlloc(
+        sizeof(Elemtype) * (size_t)capacity, SL_SNAPSHOT_ALIGN);
+    if (!data) {
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+      snap->valid = 0;
+      return 0;
+    }
+    SL_alignedFree(snap->data);
+    snap->data = data;
+    snap->capacity = (uint32)capacity;
+  }
+
+  snap->length = SL_toArray(linkedList, snap->data, snap->capacity);
+  snap->version = linkedList->version;
+  snap->valid = 1;
+  return 1;
+}
+
+/**
+ * @brief 释放快照
+ *
+ * @param snap 快照指针，传入NULL时直接返回
+ */
+void SL_freeSnapshot(SL_snapshot *snap) {
+  if (snap == NULL)
+    return;
+
+  SL_alignedFree(snap->data);
+  free(snap);
+}
+
+/**
+ * @brief 统计指定值出现的次数（对应 SL_count）
+ *
+ * @param snap 快照指针
+ * @param findData 要查找的数据
+ * @return uint32 出现次数
+ */
+uint32 SL_snapCount(SL_snapshot *const snap, const Elemtype findData) {
+  SL_snapshotRefresh(snap);
+  if (!snap->valid)
+    return 0;
+  return SL_kernels()->count(snap->data, snap->length, findData);
+}
+
+/**
+ * @brief 查找指定值第一次出现的索引（对应 SL_getIndex）
+ *
+ * @param snap 快照指针
+ * @param findData 要查找的数据
+ * @return uint32 索引（从0开始计数），未找到返回UINT32_MAX
+ */
+uint32 SL_snapGetIndex(SL_snapshot *const snap, const Elemtype findData) {
+  SL_snapshotRefresh(snap);
+  if (!snap->valid)
+    return UINT32_MAX;
+  return SL_kernels()->firstIndex(snap->data, snap->length, findData);
+}
+
+/**
+ * @brief 计算数据绝对值的最小值与最大值（对应 SL_get_set 的范围统计）
+ *
+ * @param snap 快照指针
+ * @param outMin 输出参数，绝对值最小值
+ * @param outMax 输出参数，绝对值最大值
+ * @return uint16 成功返回1，快照为空返回0
+ * @note INT32_MIN 的绝对值以无符号数 2^31 表示。
+ */
+uint16 SL_snapAbsRange(SL_snapshot *const snap, uint32 *const outMin,
+                       uint32 *const outMax) {
+  SL_snapshotRefresh(snap);
+  if (!snap->valid || snap->length == 0)
+    return 0;
+
+  *outMin = UINT32_MAX;
+  *outMax = 0;
+  SL_kernels()->absRange(snap->data, snap->length, outMin, outMax);
+  return 1;
+}
+
+/**
+ * @brief 计算所有数据之和
+ *
+ * @param snap 快照指针
+ * @return int64 数据之和（64位累加，不会溢出）
+ */
+int64 SL_snapSum(SL_snapshot *const snap) {
+  SL_snapshotRefresh(snap);
+  if (!snap->valid)
+    return 0;
+  return SL_kernels()->sum(snap->data, snap->length);
+}
+
+/**
+ * @brief 统计 [low, low + buckets) 区间内每个值出现的次数
+ *
+ * @param snap 快照指针
+ * @param low 区间下界
+ * @param buckets 区间宽度（桶数）
+ * @param outHist 输出数组，长度为 buckets，函数内先清零
+ * @return uint32 落在区间内的数据个数
+ */
+uint32 SL_snapHistogram(SL_snapshot *const snap, const Elemtype low,
+                        const uint32 buckets, uint32 *const outHist) {
+  SL_snapshotRefresh(snap);
+  memset(outHist, 0, sizeof(uint32) * buckets);
+  if (!snap->valid)
+    return 0;
+
+  uint32 counted = 0;
+  for (uint32 i = 0; i < snap->length; i++) {
+    uint32 slot = (uint32)snap->data[i] - (uint32)low; // 区间外回绕为大数
+    if (slot < buckets) {
+      outHist[slot]++;
+      counted++;
+    }
+  }
+
+  return counted;
+}
+
+/** @} */ // 单向链表向量化扫描
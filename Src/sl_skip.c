@@ -0,0 +1,488 @@
+/*
+ * @file sl_skip.c
+ * @brief 单向链表跳表索引实现文件
+ * @author ringtree
+ * @date 2025-09-26
+ * @version 1.0
+ *
+ * 本文件实现了 sl_skip.h 中声明的跳表索引操作。
+ * 位置从1开始计数：头哨兵位置为0，链表第 i 个节点（下标 i）位置为 i + 1。
+ * 每层最后一个快车道节点的宽度计到位置 length + 1，
+ * 使插入、删除时各层宽度的更新规则一致。
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "sl_log.h"
+#include "sl_skip.h"
+
+/**
+ * @addtogroup 跳表索引
+ * @{
+ */
+
+/**
+ * @brief 生成晋升层数：以 1/4 的概率逐层晋升
+ */
+static uint32 SK_randomLevel(SK_index *const skip) {
+  uint32 x = skip->seed; // xorshift32
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  skip->seed = x;
+
+  uint32 level = 0;
+  while (level < SK_MAX_LEVEL && (x & 3) == 0) {
+    level++;
+    x >>= 2;
+  }
+  return level;
+}
+
+/**
+ * @brief 释放全部快车道节点，并把各层头哨兵恢复为空
+ */
+static void SK_freeLanes(SK_index *const skip) {
+  for (uint32 l = 0; l < SK_MAX_LEVEL; l++) {
+    SK_lane *cur = skip->head[l].next;
+    while (cur) {
+      SK_lane *next = cur->next;
+      free(cur);
+      cur = next;
+    }
+    skip->head[l].node = NULL;
+    skip->head[l].next = NULL;
+    skip->head[l].down = l ? &skip->head[l - 1] : NULL;
+    skip->head[l].width = skip->link->length + 1;
+  }
+  skip->level = 0;
+}
+
+/**
+ * @brief 以O(n)重建全部快车道，同时检查链表是否为升序
+ */
+static void SK_rebuild(SK_index *const skip) {
+  SK_lane *tail[SK_MAX_LEVEL];
+  uint32 tailPos[SK_MAX_LEVEL];
+  uint32 pos = 1;
+
+  SK_freeLanes(skip);
+  for (uint32 l = 0; l < SK_MAX_LEVEL; l++) {
+    tail[l] = &skip->head[l];
+    tailPos[l] = 0;
+  }
+  skip->sorted = 1;
+
+  for (SL_node *cur = skip->link->headIndex; cur; cur = cur->next, pos++) {
+    if (cur->next && cur->next->data < cur->data)
+      skip->sorted = 0;
+
+    uint32 height = SK_randomLevel(skip);
+    SK_lane *below = NULL;
+    for (uint32 l = 0; l < height; l++) {
+      SK_lane *lane = (SK_lane *)malloc(sizeof(SK_lane));
+      if (!lane) { // 塔从下往上建，中途失败时较低的部分仍然有效
+        SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+        height = l;
+        break;
+      }
+      lane->node = cur;
+      lane->next = NULL;
+      lane->down = below;
+      tail[l]->next = lane;
+      tail[l]->width = pos - tailPos[l];
+      tail[l] = lane;
+      tailPos[l] = pos;
+      below = lane;
+    }
+    if (height > skip->level)
+      skip->level = height;
+  }
+
+  for (uint32 l = 0; l < SK_MAX_LEVEL; l++)
+    tail[l]->width = skip->link->length + 1 - tailPos[l];
+  skip->version = skip->link->version;
+}
+
+/**
+ * @brief 按位置逐层下降，记录每层最后一个位置 < target 的快车道节点
+ *
+ * @param skip 跳表索引
+ * @param target 目标位置
+ * @param update 输出每层的前驱快车道节点
+ * @param rank 输出每层前驱快车道节点的位置
+ */
+static void SK_descendPos(SK_index *const skip, const uint32 target,
+                          SK_lane **const update, uint32 *const rank) {
+  uint32 top = skip->level ? skip->level - 1 : 0;
+  for (uint32 l = top + 1; l < SK_MAX_LEVEL; l++) {
+    update[l] = &skip->head[l];
+    rank[l] = 0;
+  }
+
+  SK_lane *lane = &skip->head[top];
+  uint32 pos = 0;
+  for (uint32 l = top + 1; l-- > 0;) {
+    while (lane->next && pos + lane->width < target) {
+      pos += lane->width;
+      lane = lane->next;
+    }
+    update[l] = lane;
+    rank[l] = pos;
+    if (l)
+      lane = lane->down;
+  }
+}
+
+/**
+ * @brief 按值逐层下降，记录每层最后一个数据 < value（upper 时为 <=）的快车道节点
+ */
+static void SK_descendValue(SK_index *const skip, const Elemtype value,
+                            const uint16 upper, SK_lane **const update,
+                            uint32 *const rank) {
+  uint32 top = skip->level ? skip->level - 1 : 0;
+  for (uint32 l = top + 1; l < SK_MAX_LEVEL; l++) {
+    update[l] = &skip->head[l];
+    rank[l] = 0;
+  }
+
+  SK_lane *lane = &skip->head[top];
+  uint32 pos = 0;
+  for (uint32 l = top + 1; l-- > 0;) {
+    while (lane->next && (upper ? lane->next->node->data <= value
+                                : lane->next->node->data < value)) {
+      pos += lane->width;
+      lane = lane->next;
+    }
+    update[l] = lane;
+    rank[l] = pos;
+    if (l)
+      lane = lane->down;
+  }
+}
+
+/**
+ * @brief 从快车道节点出发沿底层节点链前进到指定位置
+ *
+ * @return SL_node* 位置 target 上的节点，target 为0时返回NULL
+ */
+static SL_node *SK_walk(SK_index *const skip, const SK_lane *const lane,
+                        uint32 pos, const uint32 target) {
+  SL_node *cur = lane->node;
+  for (; pos < target; pos++)
+    cur = cur ? cur->next : skip->link->headIndex;
+  return cur;
+}
+
+/**
+ * @brief 为位置 pos 上的新节点建立快车道，并更新各层宽度
+ */
+static void SK_linkLanes(SK_index *const skip, SK_lane **const update,
+                         const uint32 *const rank, SL_node *const node,
+                         const uint32 pos) {
+  uint32 height = SK_randomLevel(skip);
+  SK_lane *below = NULL;
+
+  for (uint32 l = 0; l < SK_MAX_LEVEL; l++) {
+    SK_lane *lane = l < height ? (SK_lane *)malloc(sizeof(SK_lane)) : NULL;
+    if (l < height && !lane) {
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+      height = l;
+    }
+
+    if (lane) {
+      // 原后继快车道节点的位置 rank + width 因插入后移一位
+      lane->node = node;
+      lane->down = below;
+      lane->next = update[l]->next;
+      lane->width = rank[l] + update[l]->width + 1 - pos;
+      update[l]->next = lane;
+      update[l]->width = pos - rank[l];
+      below = lane;
+    } else {
+      update[l]->width++;
+    }
+  }
+
+  if (height > skip->level)
+    skip->level = height;
+}
+
+/**
+ * @brief 摘除底层节点 target 的快车道，并更新各层宽度
+ */
+static void SK_unlinkLanes(SK_index *const skip, SK_lane **const update,
+                           const SL_node *const target) {
+  for (uint32 l = 0; l < SK_MAX_LEVEL; l++) {
+    SK_lane *next = update[l]->next;
+    if (next && next->node == target) {
+      update[l]->width += next->width - 1;
+      update[l]->next = next->next;
+      free(next);
+    } else {
+      update[l]->width--;
+    }
+  }
+
+  while (skip->level && skip->head[skip->level - 1].next == NULL)
+    skip->level--;
+}
+
+/**
+ * @brief 为单向链表创建跳表索引
+ *
+ * @param link 单向链表
+ * @return SK_index* 新索引，内存分配失败返回NULL
+ * @note 索引不持有链表，释放链表前应先调用 SK_freeIndex()。
+ */
+SK_index *SK_inifIndex(SL_link *const link) {
+  if (link == NULL) {
+    SL_log(SL_LOG_ERROR, "Error: linkedList is NULL");
+    return NULL;
+  }
+  if (link->vector) {
+    SL_log(SL_LOG_ERROR, "错误：顺序存储链表不需要跳表索引");
+    return NULL;
+  }
+
+  SK_index *skip = (SK_index *)malloc(sizeof(SK_index));
+  if (!skip) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  skip->link = link;
+  skip->seed = 0x9E3779B9u;
+  for (uint32 l = 0; l < SK_MAX_LEVEL; l++)
+    skip->head[l].next = NULL;
+  SK_rebuild(skip);
+
+  return skip;
+}
+
+/**
+ * @brief 按需重建索引
+ *
+ * 链表版本号与索引记录的不一致（链表被 SK_* 以外的函数修改过）时重建。
+ *
+ * @param skip 跳表索引
+ * @return uint16 发生重建返回1，否则返回0
+ */
+uint16 SK_refresh(SK_index *const skip) {
+  if (skip->version == skip->link->version)
+    return 0;
+  SK_rebuild(skip);
+  return 1;
+}
+
+/**
+ * @brief 按下标获取节点，期望O(log n)
+ *
+ * 可以替代 fast_slow_find()：倒数第 k 个节点即下标 length - k 的节点。
+ *
+ * @param skip 跳表索引
+ * @param index 节点下标（从0开始计数）
+ * @return SL_node* 对应节点，下标越界返回NULL
+ */
+SL_node *SK_getNode(SK_index *const skip, const uint32 index) {
+  SK_refresh(skip);
+  if (index >= skip->link->length) {
+    SL_log(SL_LOG_ERROR, "Error: Index out of range");
+    return NULL;
+  }
+
+  SK_lane *update[SK_MAX_LEVEL];
+  uint32 rank[SK_MAX_LEVEL];
+  SK_descendPos(skip, index + 1, update, rank);
+  return SK_walk(skip, update[0], rank[0], index + 1);
+}
+
+/**
+ * @brief 按下标获取数据，期望O(log n)
+ *
+ * @param skip 跳表索引
+ * @param index 节点下标（从0开始计数）
+ * @return Elemtype 节点数据，下标越界返回UINT32_MAX
+ */
+Elemtype SK_getData(SK_index *const skip, const uint32 index) {
+  SL_node *node = SK_getNode(skip, index);
+  return node ? node->data : (Elemtype)UINT32_MAX;
+}
+
+/**
+ * @brief 查找数据第一次出现的下标（SL_getIndex 的跳表版本）
+ *
+ * @param skip 跳表索引
+ * @param findData 要查找的数据
+ * @return uint32 第一个匹配节点的下标，未找到返回UINT32_MAX
+ * @note 链表为升序时期望O(log n)，否则调用 SL_getIndex() 线性查找。
+ */
+uint32 SK_getIndex(SK_index *const skip, const Elemtype findData) {
+  SK_refresh(skip);
+  if (!skip->sorted)
+    return SL_getIndex(skip->link, findData);
+
+  SK_lane *update[SK_MAX_LEVEL];
+  uint32 rank[SK_MAX_LEVEL];
+  SK_descendValue(skip, findData, 0, update, rank);
+
+  // 底层继续前进到最后一个 < findData 的节点
+  SL_node *prev = update[0]->node;
+  uint32 pos = rank[0];
+  SL_node *cur = prev ? prev->next : skip->link->headIndex;
+  while (cur && cur->data < findData) {
+    cur = cur->next;
+    pos++;
+  }
+
+  return cur && cur->data == findData ? pos : UINT32_MAX;
+}
+
+/**
+ * @brief 在指定下标插入新节点（SL_insert 的跳表版本），期望O(log n)
+ *
+ * 与 SL_insert() 不同，index 等于链表长度时插入到末尾。
+ *
+ * @param skip 跳表索引
+ * @param inputData 要插入的数据
+ * @param index 插入位置的下标（0 <= index <= length）
+ * @return uint16 插入成功返回1，下标越界或内存分配失败返回0
+ */
+uint16 SK_insert(SK_index *const skip, const Elemtype inputData,
+                 const uint32 index) {
+  SK_refresh(skip);
+  if (index > skip->link->length) {
+    SL_log(SL_LOG_ERROR, "Error: Index out of range");
+    return 0;
+  }
+
+  SK_lane *update[SK_MAX_LEVEL];
+  uint32 rank[SK_MAX_LEVEL];
+  SK_descendPos(skip, index + 1, update, rank);
+  SL_node *prev = SK_walk(skip, update[0], rank[0], index);
+
+  SL_node *node = SL_insertAfter(skip->link, prev, inputData);
+  if (!node)
+    return 0;
+  if (skip->sorted && ((prev && prev->data > inputData) ||
+                       (node->next && node->next->data < inputData)))
+    skip->sorted = 0;
+
+  SK_linkLanes(skip, update, rank, node, index + 1);
+  skip->version = skip->link->version;
+  return 1;
+}
+
+/**
+ * @brief 在升序链表中按序插入新节点，期望O(log n)
+ *
+ * 相同数据插入到已有数据之后（保持稳定）。
+ *
+ * @param skip 跳表索引
+ * @param inputData 要插入的数据
+ * @return uint32 新节点的下标；链表不是升序或内存分配失败时返回UINT32_MAX
+ */
+uint32 SK_insertSorted(SK_index *const skip, const Elemtype inputData) {
+  SK_refresh(skip);
+  if (!skip->sorted) {
+    SL_log(SL_LOG_ERROR, "错误：链表不是升序，无法按序插入");
+    return UINT32_MAX;
+  }
+
+  SK_lane *update[SK_MAX_LEVEL];
+  uint32 rank[SK_MAX_LEVEL];
+  SK_descendValue(skip, inputData, 1, update, rank);
+
+  SL_node *prev = update[0]->node;
+  uint32 pos = rank[0];
+  SL_node *cur = prev ? prev->next : skip->link->headIndex;
+  while (cur && cur->data <= inputData) {
+    prev = cur;
+    cur = cur->next;
+    pos++;
+  }
+
+  SL_node *node = SL_insertAfter(skip->link, prev, inputData);
+  if (!node)
+    return UINT32_MAX;
+
+  SK_linkLanes(skip, update, rank, node, pos + 1);
+  skip->version = skip->link->version;
+  return pos;
+}
+
+/**
+ * @brief 删除指定下标的节点（SL_deleteIndex 的跳表版本），期望O(log n)
+ *
+ * @param skip 跳表索引
+ * @param index 要删除节点的下标
+ * @return Elemtype 被删除节点的数据，下标越界返回UINT32_MAX
+ */
+Elemtype SK_deleteIndex(SK_index *const skip, const uint32 index) {
+  SK_refresh(skip);
+  if (index >= skip->link->length) {
+    SL_log(SL_LOG_ERROR, "Error: Index out of range");
+    return UINT32_MAX;
+  }
+
+  SK_lane *update[SK_MAX_LEVEL];
+  uint32 rank[SK_MAX_LEVEL];
+  SK_descendPos(skip, index + 1, update, rank);
+  SL_node *prev = SK_walk(skip, update[0], rank[0], index);
+
+  SK_unlinkLanes(skip, update, prev ? prev->next : skip->link->headIndex);
+  Elemtype outData = SL_deleteAfter(skip->link, prev);
+  skip->version = skip->link->version;
+  return outData;
+}
+
+/**
+ * @brief 删除数据第一次出现的节点（SL_deleteData 的跳表版本）
+ *
+ * @param skip 跳表索引
+ * @param targetData 要删除的数据
+ * @return uint16 删除成功返回1，未找到返回0
+ * @note 链表为升序时期望O(log n)，否则先线性查找下标。
+ */
+uint16 SK_deleteData(SK_index *const skip, const Elemtype targetData) {
+  SK_refresh(skip);
+  if (!skip->sorted) {
+    uint32 index = SL_getIndex(skip->link, targetData);
+    if (index == UINT32_MAX)
+      return 0;
+    SK_deleteIndex(skip, index);
+    return 1;
+  }
+
+  SK_lane *update[SK_MAX_LEVEL];
+  uint32 rank[SK_MAX_LEVEL];
+  SK_descendValue(skip, targetData, 0, update, rank);
+
+  SL_node *prev = update[0]->node;
+  SL_node *cur = prev ? prev->next : skip->link->headIndex;
+  while (cur && cur->data < targetData) {
+    prev = cur;
+    cur = cur->next;
+  }
+  if (!cur || cur->data != targetData)
+    return 0;
+
+  SK_unlinkLanes(skip, update, cur);
+  SL_deleteAfter(skip->link, prev);
+  skip->version = skip->link->version;
+  return 1;
+}
+
+/**
+ * @brief 释放跳表索引（不释放被索引的链表）
+ *
+ * @param skip 跳表索引，传入NULL时直接返回
+ */
+void SK_freeIndex(SK_index *skip) {
+  if (skip == NULL)
+    return;
+  SK_freeLanes(skip);
+  free(skip);
+}
+
+/** @} */ // 跳表索引
@@ -0,0 +1,336 @@
+/*
+ * @file sl_stats.c
+ * @brief 单向链表操作统计实现文件
+ * @author ringtree
+ * @date 2025-10-05
+ * @version 1.0
+ *
+ * 本文件实现了 sl_stats.h 中声明的统计接口。
+ * 调用过程中的节点数、分配数先累加在调用者栈上的 SL_statScope 中，
+ * 调用结束时才以 relaxed 原子加法合并到全局计数器，每次调用只有一次合并。
+ * 未定义 SL_STATS 时只保留接口，快照全部为0。
+ */
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "sl_log.h"
+#include "sl_stats.h"
+
+#if defined(SL_STATS) && defined(SL_STATS_RDTSC) &&                            \
+    (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define SL_STATS_USE_RDTSC 1
+#endif
+
+/**
+ * @addtogroup 操作统计
+ * @{
+ */
+
+/**
+ * @brief 操作名称，按 enum SL_statOp 索引
+ */
+static const char *const SL_statNames[SL_OP_MAX] = {
+    "SL_insertHead",     "SL_add",          "SL_insert",
+    "SL_insertAfter",    "SL_appendArray",  "SL_count",
+    "SL_find",           "SL_getIndex",     "SL_josephus",
+    "SL_sort_Insertion", "SL_sort_Merge",   "SL_sort_Radix",
+    "SL_reverse",        "SL_delHead",      "SL_delEnd",
+    "SL_deleteNode",     "SL_deleteIndex",  "SL_deleteData",
+    "SL_deleteBatch",    "SL_traverseLink", "SL_toArray",
+    "SL_freeNodes",
+};
+
+/**
+ * @brief 获取操作名称
+ *
+ * @param op 操作
+ * @return const char* 操作名称，op 无效时返回 "unknown"
+ */
+const char *SL_statsOpName(enum SL_statOp op) {
+  if ((uint32)op >= SL_OP_MAX)
+    return "unknown";
+  return SL_statNames[op];
+}
+
+#ifdef SL_STATS
+
+/**
+ * @brief 单个操作的全局计数器
+ */
+typedef struct SL_opCounters {
+  _Atomic uint64 calls;
+  _Atomic uint64 nodes;
+  _Atomic uint64 allocs;
+  _Atomic uint64 frees;
+  _Atomic uint64 totalTime;
+  _Atomic uint64 histogram[SL_STATS_BUCKETS];
+} SL_opCounters;
+
+static SL_opCounters SL_statCounters[SL_OP_MAX];
+
+_Thread_local SL_statScope *SL_statCurrent = NULL;
+
+/**
+ * @brief 读取当前时间（纳秒或周期）
+ */
+static inline uint64 SL_statNow(void) {
+#ifdef SL_STATS_USE_RDTSC
+  return (uint64)__rdtsc();
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64)ts.tv_sec * 1000000000ull + (uint64)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief 开始一次调用；已有外层调用时本次不单独统计
+ *
+ * @param scope 调用者栈上的统计记录
+ * @param op 操作
+ */
+void SL_statEnter(SL_statScope *const scope, const enum SL_statOp op) {
+  if (SL_statCurrent) {
+    scope->op = -1;
+    return;
+  }
+  scope->op = (int32)op;
+  scope->nodes = 0;
+  scope->allocs = 0;
+  scope->frees = 0;
+  SL_statCurrent = scope;
+  scope->start = SL_statNow();
+}
+
+/**
+ * @brief 结束一次调用，合并到全局计数器（由 cleanup 属性在函数返回时调用）
+ *
+ * @param scope 调用者栈上的统计记录
+ */
+void SL_statLeave(SL_statScope *const scope) {
+  if (scope->op < 0)
+    return;
+
+  uint64 elapsed = SL_statNow() - scope->start;
+  uint32 bucket = elapsed ? 63 - (uint32)__builtin_clzll(elapsed) : 0;
+  if (bucket >= SL_STATS_BUCKETS)
+    bucket = SL_STATS_BUCKETS - 1;
+
+  SL_opCounters *counters = &SL_statCounters[scope->op];
+  atomic_fetch_add_explicit(&counters->calls, 1, memory_order_relaxed);
+  atomic_fetch_add_explicit(&counters->nodes, scope->nodes,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&counters->allocs, scope->allocs,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&counters->frees, scope->frees,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&counters->totalTime, elapsed,
+                            memory_order_relaxed);
+  atomic_fetch_add_explicit(&counters->histogram[bucket], 1,
+                            memory_order_relaxed);
+  SL_statCurrent = NULL;
+}
+
+#endif /* SL_STATS */
+
+/**
+ * @brief 读取全部操作的统计快照
+ *
+ * 各计数器分别读取，并发调用时快照内的计数之间可能相差正在进行的几次调用。
+ *
+ * @param out 输出快照
+ */
+void SL_statsSnapshot(SL_stats *const out) {
+  memset(out, 0, sizeof(SL_stats));
+#ifdef SL_STATS
+  out->enabled = 1;
+  for (uint32 op = 0; op < SL_OP_MAX; op++) {
+    SL_opCounters *src = &SL_statCounters[op];
+    SL_opStats *dst = &out->ops[op];
+    dst->calls = atomic_load_explicit(&src->calls, memory_order_relaxed);
+    dst->nodes = atomic_load_explicit(&src->nodes, memory_order_relaxed);
+    dst->allocs = atomic_load_explicit(&src->allocs, memory_order_relaxed);
+    dst->frees = atomic_load_explicit(&src->frees, memory_order_relaxed);
+    dst->totalTime =
+        atomic_load_explicit(&src->totalTime, memory_order_relaxed);
+    for (uint32 b = 0; b < SL_STATS_BUCKETS; b++)
+      dst->histogram[b] =
+          atomic_load_explicit(&src->histogram[b], memory_order_relaxed);
+  }
+#endif
+}
+
+/**
+ * @brief 清零全部计数器
+ */
+void SL_statsReset(void) {
+#ifdef SL_STATS
+  for (uint32 op = 0; op < SL_OP_MAX; op++) {
+    SL_opCounters *counters = &SL_statCounters[op];
+    atomic_store_explicit(&counters->calls, 0, memory_order_relaxed);
+    atomic_store_explicit(&counters->nodes, 0, memory_order_relaxed);
+    atomic_store_explicit(&counters->allocs, 0, memory_order_relaxed);
+    atomic_store_explicit(&counters->frees, 0, memory_order_relaxed);
+    atomic_store_explicit(&counters->totalTime, 0, memory_order_relaxed);
+    for (uint32 b = 0; b < SL_STATS_BUCKETS; b++)
+      atomic_store_explicit(&counters->histogram[b], 0, memory_order_relaxed);
+  }
+#endif
+}
+
+/**
+ * @brief 以表格形式输出统计（只输出调用次数非0的操作）
+ *
+ * 每行依次为：调用次数、平均访问节点数、分配数、释放数、平均耗时，
+ * 以及耗时直方图中非空桶的下界与次数（"2^k:次数"）。
+ *
+ * @param out 输出文件（如 stderr）
+ */
+void SL_statsDump(FILE *const out) {
+  SL_stats stats;
+  SL_statsSnapshot(&stats);
+  if (!stats.enabled) {
+    fprintf(out, "统计未启用（编译时未定义 SL_STATS）\n");
+    return;
+  }
+
+#ifdef SL_STATS_USE_RDTSC
+  const char *unit = "cycles";
+#else
+  const char *unit = "ns";
+#endif
+  fprintf(out, "%-18s %12s %12s %12s %12s %10s(%s)  histogram\n", "op",
+          "calls", "nodes/call", "allocs", "frees", "avg", unit);
+  for (uint32 op = 0; op < SL_OP_MAX; op++) {
+    const SL_opStats *s = &stats.ops[op];
+    if (!s->calls)
+      continue;
+    fprintf(out, "%-18s %12llu %12.1f %12llu %12llu %14.1f ",
+            SL_statNames[op], (unsigned long long)s->calls,
+            (d64)s->nodes / s->calls, (unsigned long long)s->allocs,
+            (unsigned long long)s->frees, (d64)s->totalTime / s->calls);
+    for (uint32 b = 0; b < SL_STATS_BUCKETS; b++) {
+      if (s->histogram[b])
+        fprintf(out, " 2^%u:%llu", b, (unsigned long long)s->histogram[b]);
+    }
+    fprintf(out, "\n");
+  }
+  fflush(out);
+}
+
+#ifdef SL_STATS
+
+/**
+ * @brief 定期转储线程的状态
+ */
+static struct {
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+  uint16 running;
+  uint16 stop;
+  FILE *out;
+  uint32 intervalMs;
+} SL_statDumper = {.lock = PTHREAD_MUTEX_INITIALIZER,
+                   .wake = PTHREAD_COND_INITIALIZER};
+
+/**
+ * @brief 定期转储线程：每隔 intervalMs 毫秒调用一次 SL_statsDump()
+ */
+static void *SL_statDumpLoop(void *arg) {
+  (void)arg;
+  pthread_mutex_lock(&SL_statDumper.lock);
+  while (!SL_statDumper.stop) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    uint64 ns = (uint64)deadline.tv_nsec +
+                (uint64)SL_statDumper.intervalMs * 1000000ull;
+    deadline.tv_sec += (time_t)(ns / 1000000000ull);
+    deadline.tv_nsec = (long)(ns % 1000000000ull);
+
+    while (!SL_statDumper.stop &&
+           pthread_cond_timedwait(&SL_statDumper.wake, &SL_statDumper.lock,
+                                  &deadline) == 0)
+      ; // 被提前唤醒但未要求停止时继续等待到期
+    if (SL_statDumper.stop)
+      break;
+
+    pthread_mutex_unlock(&SL_statDumper.lock);
+    SL_statsDump(SL_statDumper.out);
+    pthread_mutex_lock(&SL_statDumper.lock);
+  }
+  pthread_mutex_unlock(&SL_statDumper.lock);
+  return NULL;
+}
+
+#endif /* SL_STATS */
+
+/**
+ * @brief 启动后台线程定期输出统计
+ *
+ * @param out 输出文件（如 stderr）
+ * @param intervalMs 输出间隔（毫秒），必须大于0
+ * @return uint16 成功返回1；未启用统计、参数无效、已在运行或线程创建失败返回0
+ */
+uint16 SL_statsStartDump(FILE *const out, const uint32 intervalMs) {
+#ifndef SL_STATS
+  (void)out;
+  (void)intervalMs;
+  SL_log(SL_LOG_WARN, "统计未启用（编译时未定义 SL_STATS）");
+  return 0;
+#else
+  if (out == NULL || intervalMs == 0) {
+    SL_log(SL_LOG_ERROR, "错误：输出文件为空或间隔为0");
+    return 0;
+  }
+
+  pthread_mutex_lock(&SL_statDumper.lock);
+  if (SL_statDumper.running) {
+    pthread_mutex_unlock(&SL_statDumper.lock);
+    SL_log(SL_LOG_ERROR, "错误：定期转储已在运行");
+    return 0;
+  }
+  SL_statDumper.out = out;
+  SL_statDumper.intervalMs = intervalMs;
+  SL_statDumper.stop = 0;
+  SL_statDumper.running =
+      pthread_create(&SL_statDumper.thread, NULL, SL_statDumpLoop, NULL) == 0;
+  uint16 started = SL_statDumper.running;
+  pthread_mutex_unlock(&SL_statDumper.lock);
+
+  if (!started)
+    SL_log(SL_LOG_ERROR, "错误：无法创建转储线程");
+  return started;
+#endif
+}
+
+/**
+ * @brief 停止定期输出（未启动时直接返回）
+ */
+void SL_statsStopDump(void) {
+#ifdef SL_STATS
+  pthread_mutex_lock(&SL_statDumper.lock);
+  if (!SL_statDumper.running) {
+    pthread_mutex_unlock(&SL_statDumper.lock);
+    return;
+  }
+  SL_statDumper.stop = 1;
+  pthread_cond_signal(&SL_statDumper.wake);
+  pthread_mutex_unlock(&SL_statDumper.lock);
+
+  pthread_join(SL_statDumper.thread, NULL);
+  pthread_mutex_lock(&SL_statDumper.lock);
+  SL_statDumper.running = 0;
+  pthread_mutex_unlock(&SL_statDumper.lock);
+#endif
+}
+
+/** @} */ // 操作统计
@@ -0,0 +1,534 @@
+/*
+ * @file sl_unrolled.c
+ * @brief 展开链表实现文件
+ * @author ringtree
+ * @date 2025-09-05
+ * @version 1.0
+ *
+ * 本文件实现了 sl_unrolled.h 中声明的展开链表操作：
+ * - 插入时若目标节点块已满，则对半拆分为两个节点块；
+ * - 删除后若节点块不足半满且能与后继块合并，则合并两个节点块；
+ * - 查找、计数等扫描操作在块内按数组顺序访问，缓存友好。
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "other.h"
+#include "sl_log.h"
+#include "sl_unrolled.h"
+
+/**
+ * @addtogroup 展开链表模块
+ * @{
+ */
+
+/**
+ * @brief 创建一个空的节点块（按缓存行对齐）
+ *
+ * @return UL_block* 新节点块指针，内存分配失败返回NULL
+ */
+static UL_block *UL_inifBlock(void) {
+  UL_block *block = (UL_block *)SL_alignedAlloc(sizeof(UL_block), UL_BLOCK_BYTES);
+  if (!block) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  block->next = NULL;
+  block->count = 0;
+
+  return block;
+}
+
+/**
+ * @brief 定位第 index 个数据所在的节点块
+ *
+ * @param list 展开链表指针
+ * @param index 数据索引（需保证 index < length）
+ * @param outPrev 输出参数，返回目标块的前驱块（目标为首块时为NULL）
+ * @param outOffset 输出参数，返回数据在目标块内的偏移
+ * @return UL_block* 目标节点块
+ */
+static UL_block *UL_locate(SL_unrolled *const list, uint32 index,
+                           UL_block **outPrev, uint32 *outOffset) {
+  UL_block *prev = NULL;
+  UL_block *cur = list->headIndex;
+
+  while (index >= cur->count) {
+    index -= cur->count;
+    prev = cur;
+    cur = cur->next;
+  }
+
+  if (outPrev)
+    *outPrev = prev;
+  *outOffset = index;
+  return cur;
+}
+
+/**
+ * @brief 在节点块的指定偏移处插入数据，块满时先对半拆分
+ *
+ * @param list 展开链表指针
+ * @param block 目标节点块
+ * @param offset 块内插入偏移（0 <= offset <= count）
+ * @param inputData 要插入的数据
+ */
+static void UL_insertAt(SL_unrolled *const list, UL_block *block,
+                        uint32 offset, const Elemtype inputData) {
+  if (block->count == UL_BLOCK_CAP) { // 块已满，拆分
+    UL_block *half = UL_inifBlock();
+    if (!half)
+      return;
+
+    uint32 keep = UL_BLOCK_CAP / 2;
+    half->count = block->count - keep;
+    memcpy(half->data, block->data + keep, sizeof(Elemtype) * half->count);
+    block->count = keep;
+
+    half->next = block->next;
+    block->next = half;
+    if (list->endIndex == block)
+      list->endIndex = half;
+    list->blocks++;
+
+    if (offset > keep) { // 插入位置落在后半块
+      block = half;
+      offset -= keep;
+    }
+  }
+
+  memmove(block->data + offset + 1, block->data + offset,
+          sizeof(Elemtype) * (block->count - offset));
+  block->data[offset] = inputData;
+  block->count++;
+  list->length++;
+}
+
+/**
+ * @brief 删除节点块指定偏移处的数据，并按需回收或合并节点块
+ *
+ * @param list 展开链表指针
+ * @param prev 目标块的前驱块（目标为首块时为NULL）
+ * @param block 目标节点块
+ * @param offset 块内删除偏移
+ * @return Elemtype 被删除的数据
+ */
+static Elemtype UL_removeAt(SL_unrolled *const list, UL_block *const prev,
+                            UL_block *const block, const uint32 offset) {
+  Elemtype outData = block->data[offset];
+
+  memmove(block->data + offset, block->data + offset + 1,
+          sizeof(Elemtype) * (block->count - offset - 1));
+  block->count--;
+  list->length--;
+
+  if (block->count == 0) { // 空块直接回收
+    if (prev)
+      prev->next = block->next;
+    else
+      list->headIndex = block->next;
+    if (list->endIndex == block)
+      list->endIndex = prev;
+    SL_alignedFree(block);
+    list->blocks--;
+  } else if (block->count < UL_BLOCK_CAP / 2 && block->next &&
+             block->count + block->next->count <= UL_BLOCK_CAP) {
+    // 不足半满且可与后继块合并
+    UL_block *next = block->next;
+    memcpy(block->data + block->count, next->data,
+           sizeof(Elemtype) * next->count);
+    block->count += next->count;
+    block->next = next->next;
+    if (list->endIndex == next)
+      list->endIndex = block;
+    SL_alignedFree(next);
+    list->blocks--;
+  }
+
+  return outData;
+}
+
+/**
+ * @brief 创建并初始化一个空的展开链表
+ *
+ * @return SL_unrolled* 新展开链表指针，内存分配失败返回NULL
+ * @note 需使用 UL_freeLinks() 释放。
+ */
+SL_unrolled *UL_inifLink(void) {
+  SL_unrolled *list = (SL_unrolled *)malloc(sizeof(SL_unrolled));
+  if (!list) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  list->headIndex = NULL;
+  list->endIndex = NULL;
+  list->length = 0;
+  list->blocks = 0;
+
+  return list;
+}
+
+/**
+ * @brief 在展开链表头部插入数据
+ *
+ * 首块未满时在块内前移插入，首块已满时在前面新建一个节点块。
+ *
+ * @param list 展开链表指针
+ * @param inputData 要插入的数据
+ */
+void UL_insertHead(SL_unrolled *const list, const Elemtype inputData) {
+  if (list->headIndex == NULL || list->headIndex->count == UL_BLOCK_CAP) {
+    UL_block *block = UL_inifBlock();
+    if (!block)
+      return;
+    block->next = list->headIndex;
+    list->headIndex = block;
+    if (list->endIndex == NULL)
+      list->endIndex = block;
+    list->blocks++;
+  }
+
+  UL_insertAt(list, list->headIndex, 0, inputData);
+}
+
+/**
+ * @brief 在展开链表尾部追加数据
+ *
+ * 末尾块未满时直接写入，已满时在末尾新建一个节点块，时间复杂度O(1)。
+ *
+ * @param list 展开链表指针
+ * @param inputData 要追加的数据
+ */
+void UL_add(SL_unrolled *const list, const Elemtype inputData) {
+  UL_block *block = list->endIndex;
+
+  if (block == NULL || block->count == UL_BLOCK_CAP) {
+    block = UL_inifBlock();
+    if (!block)
+      return;
+    if (list->endIndex)
+      list->endIndex->next = block;
+    else
+      list->headIndex = block;
+    list->endIndex = block;
+    list->blocks++;
+  }
+
+  block->data[block->count++] = inputData;
+  list->length++;
+}
+
+/**
+ * @brief 在展开链表的指定位置插入数据
+ *
+ * 索引为0时等同于 UL_insertHead()；索引大于等于长度时经 SL_log()
+ * 报告错误并返回，与 SL_insert() 的约定一致。
+ *
+ * @param list 展开链表指针
+ * @param inputData 要插入的数据
+ * @param index 插入位置的索引（从0开始计数）
+ */
+void UL_insert(SL_unrolled *const list, const Elemtype inputData,
+               const uint32 index) {
+  if (!index) {
+    UL_insertHead(list, inputData);
+    return;
+  } else if (index >= list->length) {
+    SL_log(SL_LOG_ERROR, "Error: Index out of range");
+    return;
+  }
+
+  uint32 offset = 0;
+  UL_block *block = UL_locate(list, index, NULL, &offset);
+  UL_insertAt(list, block, offset, inputData);
+}
+
+/**
+ * @brief 计算指定值在展开链表中出现的次数
+ *
+ * @param list 展开链表指针
+ * @param findData 要查找的数据
+ * @return uint32 出现次数
+ */
+uint32 UL_count(SL_unrolled *const list, const Elemtype findData) {
+  if (list == NULL)
+    return 0;
+
+  uint32 count = 0;
+  for (UL_block *block = list->headIndex; block; block = block->next) {
+    for (uint32 i = 0; i < block->count; i++)
+      count += (block->data[i] == findData);
+  }
+
+  return count;
+}
+
+/**
+ * @brief 查找指定数据第一次出现的索引
+ *
+ * @param list 展开链表指针
+ * @param findData 要查找的数据
+ * @return uint32 索引（从0开始计数），未找到返回UINT32_MAX
+ */
+uint32 UL_getIndex(SL_unrolled *const list, const Elemtype findData) {
+  if (list == NULL)
+    return UINT32_MAX;
+
+  uint32 base = 0;
+  for (UL_block *block = list->headIndex; block; block = block->next) {
+    for (uint32 i = 0; i < block->count; i++) {
+      if (block->data[i] == findData)
+        return base + i;
+    }
+    base += block->count;
+  }
+
+  return UINT32_MAX;
+}
+
+/**
+ * @brief 获取指定索引处的数据
+ *
+ * 按块跳过，时间复杂度为O(块数)。
+ *
+ * @param list 展开链表指针
+ * @param index 数据索引（从0开始计数）
+ * @return Elemtype 数据；索引越界返回UINT32_MAX
+ */
+Elemtype UL_getData(SL_unrolled *const list, const uint32 index) {
+  if (list == NULL || index >= list->length) {
+    SL_log(SL_LOG_ERROR, "错误：索引 %u 越界", index);
+    return UINT32_MAX;
+  }
+
+  uint32 offset = 0;
+  UL_block *block = UL_locate(list, index, NULL, &offset);
+  return block->data[offset];
+}
+
+/**
+ * @brief 删除指定索引处的数据
+ *
+ * @param list 展开链表指针
+ * @param index 待删除数据的索引（从0开始计数）
+ * @return Elemtype 被删除的数据；若失败（链表为空、索引越界）返回UINT32_MAX
+ */
+Elemtype UL_deleteIndex(SL_unrolled *const list, const uint32 index) {
+  if (list->headIndex == NULL || list->length == 0) {
+    SL_log(SL_LOG_ERROR, "展开链表为空，无法删除索引 %u 的数据", index);
+    return UINT32_MAX;
+  }
+  if (index >= list->length) {
+    SL_log(SL_LOG_ERROR, "错误：索引 %u 越界(展开链表长度为 %u)", index,
+           list->length);
+    return UINT32_MAX;
+  }
+
+  UL_block *prev = NULL;
+  uint32 offset = 0;
+  UL_block *block = UL_locate(list, index, &prev, &offset);
+  return UL_removeAt(list, prev, block, offset);
+}
+
+/**
+ * @brief 删除展开链表中指定数据的目标匹配项
+ *
+ * 与 SL_deleteData() 的约定一致：
+ * - deleteCount = 0：删除所有匹配项，一次遍历完成块内压缩；
+ * - deleteCount > 0：删除第 deleteCount 个匹配项（从1开始计数）。
+ *
+ * @param list 展开链表指针
+ * @param targetData 待删除的目标数据值
+ * @param deleteCount 删除模式
+ * @return Elemtype 被删除的数据；未找到匹配项返回UINT32_MAX
+ */
+Elemtype UL_deleteData(SL_unrolled *const list, const Elemtype targetData,
+                       uint32 deleteCount) {
+  if (list->headIndex == NULL || list->length == 0) {
+    SL_log(SL_LOG_ERROR, "展开链表为空，无法删除数据 %d", targetData);
+    return UINT32_MAX;
+  }
+
+  UL_block *prev = NULL;
+  UL_block *block = list->headIndex;
+  uint32 matchIndex = 0;
+
+  if (deleteCount > 0) { // 删除第 deleteCount 个匹配项
+    for (; block; prev = block, block = block->next) {
+      for (uint32 i = 0; i < block->count; i++) {
+        if (block->data[i] == targetData && ++matchIndex == deleteCount)
+          return UL_removeAt(list, prev, block, i);
+      }
+    }
+    SL_log(SL_LOG_ERROR, "错误：未找到第 %u 个数据为 %d 的节点", deleteCount,
+           targetData);
+    return UINT32_MAX;
+  }
+
+  // 删除所有匹配项：块内原地压缩，空块回收
+  while (block) {
+    uint32 keep = 0;
+    for (uint32 i = 0; i < block->count; i++) {
+      if (block->data[i] != targetData)
+        block->data[keep++] = block->data[i];
+    }
+    matchIndex += block->count - keep;
+    list->length -= block->count - keep;
+    block->count = keep;
+
+    UL_block *next = block->next;
+    if (keep == 0) {
+      if (prev)
+        prev->next = next;
+      else
+        list->headIndex = next;
+      if (list->endIndex == block)
+        list->endIndex = prev;
+      SL_alignedFree(block);
+      list->blocks--;
+    } else {
+      prev = block;
+    }
+    block = next;
+  }
+
+  if (matchIndex == 0) {
+    SL_log(SL_LOG_ERROR, "错误：展开链表中未找到数据为 %d 的节点", targetData);
+    return UINT32_MAX;
+  }
+  return targetData;
+}
+
+/**
+ * @brief 反转展开链表
+ *
+ * 先反转节点块链，再反转每个块内的数据。
+ *
+ * @param list 展开链表指针
+ * @return uint16 执行成功返回1，链表为空或只有一个数据返回0
+ */
+uint16 UL_reverse(SL_unrolled *const list) {
+  if (list == NULL || list->length <= 1)
+    return 0;
+
+  UL_block *pre = NULL;
+  UL_block *cur = list->headIndex;
+  list->endIndex = cur;
+
+  while (cur) {
+    UL_block *sub = cur->next;
+    for (uint32 i = 0, j = cur->count - 1; i < j; i++, j--) {
+      Elemtype temp = cur->data[i];
+      cur->data[i] = cur->data[j];
+      cur->data[j] = temp;
+    }
+    cur->next = pre;
+    pre = cur;
+    cur = sub;
+  }
+  list->headIndex = pre;
+
+  return 1;
+}
+
+/**
+ * @brief 升序比较函数（供 qsort 使用）
+ */
+static int UL_cmpAsc(const void *a, const void *b) {
+  Elemtype x = *(const Elemtype *)a;
+  Elemtype y = *(const Elemtype *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief 降序比较函数（供 qsort 使用）
+ */
+static int UL_cmpDesc(const void *a, const void *b) {
+  return UL_cmpAsc(b, a);
+}
+
+/**
+ * @brief 对展开链表进行排序（支持升序 / 降序）
+ *
+ * 将数据拷贝到连续数组中排序后按原块结构写回，时间复杂度O(n log n)。
+ *
+ * @param list 展开链表指针
+ * @param way 排序方式：ASC（升序）或 DESC（降序）
+ * @note 内部临时分配 length 个 Elemtype 的数组，分配失败时不排序。
+ */
+void UL_sort(SL_unrolled *const list, enum sort way) {
+  if (list == NULL || list->length <= 1)
+    return;
+
+  Elemtype *array = (Elemtype *)malloc(sizeof(Elemtype) * list->length);
+  if (!array) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return;
+  }
+
+  uint32 n = 0;
+  for (UL_block *block = list->headIndex; block; block = block->next) {
+    memcpy(array + n, block->data, sizeof(Elemtype) * block->count);
+    n += block->count;
+  }
+
+  qsort(array, n, sizeof(Elemtype), way ? UL_cmpDesc : UL_cmpAsc);
+
+  n = 0;
+  for (UL_block *block = list->headIndex; block; block = block->next) {
+    memcpy(block->data, array + n, sizeof(Elemtype) * block->count);
+    n += block->count;
+  }
+
+  free(array);
+}
+
+/**
+ * @brief 遍历展开链表并打印所有数据
+ *
+ * 输出格式与 SL_traverseLink() 一致：数据之间用制表符分隔，每20个数据换行。
+ *
+ * @param list 展开链表指针
+ * @return uint32 展开链表的当前长度
+ */
+uint32 UL_traverseLink(SL_unrolled *const list) {
+  uint16 number = 0;
+
+  for (UL_block *block = list->headIndex; block; block = block->next) {
+    for (uint32 i = 0; i < block->count; i++, number++) {
+      if (number == 20) {
+        number = 0;
+        printf("\n");
+      }
+      printf("%d\t", block->data[i]);
+    }
+  }
+  printf("\n");
+
+  return list->length;
+}
+
+/**
+ * @brief 释放展开链表的所有节点块及链表结构体本身
+ *
+ * @param list 展开链表指针，传入NULL时直接返回
+ */
+void UL_freeLinks(SL_unrolled *list) {
+  if (list == NULL)
+    return;
+
+  UL_block *block = list->headIndex;
+  while (block) {
+    UL_block *next = block->next;
+    SL_alignedFree(block);
+    block = next;
+  }
+
+  free(list);
+}
+
+/** @} */ // 展开链表模块
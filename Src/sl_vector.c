@@ -0,0 +1,370 @@
+/*
+ * @file sl_vector.c
+ * @brief 单向链表的顺序存储（连续数组）后端实现文件
+ * @author ringtree
+ * @date 2025-09-27
+ * @version 1.0
+ *
+ * 本文件实现了 sl_vector.h 中声明的 SV_* 函数。
+ * 所有修改操作同 data_struct.c 一样递增 linkedList->version，
+ * 使快照等依赖版本号的模块能发现变化。
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sl_log.h"
+#include "sl_vector.h"
+
+/* define ----------------------------------------------------- */
+/**
+ * @brief 基数排序每轮处理的位数（与 SL_sort_Radix 相同：11 + 11 + 10）
+ */
+#define SV_RADIX_BITS 11
+#define SV_RADIX_BUCKETS (1u << SV_RADIX_BITS)
+#define SV_RADIX_PASSES 3
+
+/**
+ * @addtogroup 顺序存储后端
+ * @{
+ */
+
+/**
+ * @brief 创建连续数组存储
+ *
+ * @param capacity 初始容量，小于 SV_MIN_CAPACITY 时取 SV_MIN_CAPACITY
+ * @return SL_vector* 新存储，内存分配失败返回NULL
+ */
+SL_vector *SV_inifVector(const uint32 capacity) {
+  SL_vector *vector = (SL_vector *)malloc(sizeof(SL_vector));
+  if (!vector)
+    return NULL; // 由调用者报告
+
+  vector->capacity = capacity < SV_MIN_CAPACITY ? SV_MIN_CAPACITY : capacity;
+  vector->start = 0;
+  vector->data = (Elemtype *)malloc(sizeof(Elemtype) * vector->capacity);
+  if (!vector->data) {
+    free(vector);
+    return NULL;
+  }
+
+  return vector;
+}
+
+/**
+ * @brief 释放连续数组存储
+ *
+ * @param vector 存储指针，传入NULL时直接返回
+ */
+void SV_freeVector(SL_vector *vector) {
+  if (vector == NULL)
+    return;
+  free(vector->data);
+  free(vector);
+}
+
+/**
+ * @brief 保证数组前部至少有 front 个、后部至少有 back 个空位
+ *
+ * 空位不足时：占用超过容量一半则容量翻倍，否则原地整理。
+ * 需要前部空位时把数据放在中间，否则靠前放置，
+ * 保证头部插入与尾部追加都是均摊O(1)。
+ *
+ * @return uint16 成功返回1，内存分配失败或容量超出上限返回0
+ * @note 不产生输出，由调用者报告（SL_try* 路径返回 SL_ERR_NO_MEMORY）。
+ */
+static uint16 SV_reserve(SL_link *const linkedList, const uint32 front,
+                         const uint32 back) {
+  SL_vector *vector = linkedList->vector;
+  uint32 length = linkedList->length;
+  if (vector->start >= front &&
+      vector->capacity - vector->start - length >= back)
+    return 1;
+
+  uint64 need = (uint64)length + front + back;
+  uint64 capacity = vector->capacity;
+  if (need * 2 > capacity)
+    capacity = need * 2;
+  if (capacity > UINT32_MAX)
+    capacity = UINT32_MAX;
+  if (need > capacity)
+    return 0; // 容量超出上限
+
+  if (capacity != vector->capacity) {
+    Elemtype *data =
+        (Elemtype *)realloc(vector->data, sizeof(Elemtype) * (size_t)capacity);
+    if (!data)
+      return 0;
+    vector->data = data;
+    vector->capacity = (uint32)capacity;
+  }
+
+  uint32 start = front ? (uint32)((capacity - need) / 2) + front : 0;
+  memmove(vector->data + start, vector->data + vector->start,
+          sizeof(Elemtype) * length);
+  vector->start = start;
+  return 1;
+}
+
+/**
+ * @brief 在指定下标插入数据（0 <= index <= length）
+ *
+ * 下标位于前半段时移动前半段数据，否则移动后半段数据。
+ *
+ * @return uint16 成功返回1，内存分配失败返回0
+ */
+uint16 SV_insert(SL_link *const linkedList, const Elemtype inputData,
+                 const uint32 index) {
+  uint32 length = linkedList->length;
+  uint16 front = index < length / 2;
+  if (!SV_reserve(linkedList, front, !front))
+    return 0;
+
+  SL_vector *vector = linkedList->vector;
+  if (front) { // 前半段整体前移一位
+    vector->start--;
+    memmove(SV_DATA(linkedList), SV_DATA(linkedList) + 1,
+            sizeof(Elemtype) * index);
+  } else { // 后半段整体后移一位
+    memmove(SV_DATA(linkedList) + index + 1, SV_DATA(linkedList) + index,
+            sizeof(Elemtype) * (length - index));
+  }
+
+  SV_DATA(linkedList)[index] = inputData;
+  linkedList->length++;
+  linkedList->version++;
+  return 1;
+}
+
+/**
+ * @brief 在末尾批量追加数据
+ *
+ * @return uint32 实际追加的元素个数
+ */
+uint32 SV_appendArray(SL_link *const linkedList, const Elemtype *const array,
+                      const uint32 count) {
+  if (count == 0 || !SV_reserve(linkedList, 0, count))
+    return 0;
+
+  memcpy(SV_DATA(linkedList) + linkedList->length, array,
+         sizeof(Elemtype) * count);
+  linkedList->length += count;
+  linkedList->version++;
+  return count;
+}
+
+/**
+ * @brief 统计数据出现次数
+ */
+uint32 SV_count(SL_link *const linkedList, const Elemtype findData) {
+  const Elemtype *data = SV_DATA(linkedList);
+  uint32 count = 0;
+  for (uint32 i = 0; i < linkedList->length; i++)
+    count += data[i] == findData;
+  return count;
+}
+
+/**
+ * @brief 查找数据第一次出现的下标，未找到返回UINT32_MAX
+ */
+uint32 SV_getIndex(SL_link *const linkedList, const Elemtype findData) {
+  const Elemtype *data = SV_DATA(linkedList);
+  for (uint32 i = 0; i < linkedList->length; i++) {
+    if (data[i] == findData)
+      return i;
+  }
+  return UINT32_MAX;
+}
+
+/**
+ * @brief 删除指定下标的数据（调用者保证下标有效）
+ *
+ * 下标位于前半段时移动前半段数据，否则移动后半段数据，
+ * 因此删除头部、尾部数据均为O(1)。
+ *
+ * @return Elemtype 被删除的数据
+ */
+Elemtype SV_deleteIndex(SL_link *const linkedList, const uint32 index) {
+  Elemtype *data = SV_DATA(linkedList);
+  Elemtype outData = data[index];
+  uint32 length = linkedList->length;
+
+  if (index < length / 2) {
+    memmove(data + 1, data, sizeof(Elemtype) * index);
+    linkedList->vector->start++;
+  } else {
+    memmove(data + index, data + index + 1,
+            sizeof(Elemtype) * (length - index - 1));
+  }
+
+  linkedList->length--;
+  if (linkedList->length == 0)
+    linkedList->vector->start = 0;
+  linkedList->version++;
+  return outData;
+}
+
+/**
+ * @brief 删除匹配的数据
+ *
+ * @param deleteCount 0：删除全部匹配项；>0：删除第 deleteCount 个匹配项
+ * @return uint32 删除的元素个数
+ */
+uint32 SV_deleteData(SL_link *const linkedList, const Elemtype targetData,
+                     const uint32 deleteCount) {
+  Elemtype *data = SV_DATA(linkedList);
+  uint32 length = linkedList->length;
+
+  if (deleteCount > 0) {
+    uint32 match = 0;
+    for (uint32 i = 0; i < length; i++) {
+      if (data[i] == targetData && ++match == deleteCount) {
+        SV_deleteIndex(linkedList, i);
+        return 1;
+      }
+    }
+    return 0;
+  }
+
+  uint32 keep = 0; // 单次压缩
+  for (uint32 i = 0; i < length; i++) {
+    if (data[i] != targetData)
+      data[keep++] = data[i];
+  }
+  linkedList->length = keep;
+  if (keep != length)
+    linkedList->version++;
+  return length - keep;
+}
+
+/**
+ * @brief 原地反转
+ */
+void SV_reverse(SL_link *const linkedList) {
+  if (linkedList->length <= 1)
+    return;
+  Elemtype *data = SV_DATA(linkedList);
+  for (uint32 i = 0, j = linkedList->length - 1; i < j; i++, j--) {
+    Elemtype temp = data[i];
+    data[i] = data[j];
+    data[j] = temp;
+  }
+  linkedList->version++;
+}
+
+/**
+ * @brief 插入排序
+ */
+void SV_sortInsertion(SL_link *const linkedList, enum sort way) {
+  Elemtype *data = SV_DATA(linkedList);
+  for (uint32 i = 1; i < linkedList->length; i++) {
+    Elemtype key = data[i];
+    uint32 j = i;
+    while (j > 0 && (way == ASC ? data[j - 1] > key : data[j - 1] < key)) {
+      data[j] = data[j - 1];
+      j--;
+    }
+    data[j] = key;
+  }
+  linkedList->version++;
+}
+
+/**
+ * @brief 自底向上归并排序（借助与数据等长的临时数组）
+ */
+void SV_sortMerge(SL_link *const linkedList, enum sort way) {
+  uint32 n = linkedList->length;
+  Elemtype *src = SV_DATA(linkedList);
+  Elemtype *buffer = (Elemtype *)malloc(sizeof(Elemtype) * (n ? n : 1));
+  if (!buffer) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return;
+  }
+
+  Elemtype *dst = buffer;
+  for (uint32 width = 1; width < n; width *= 2) {
+    for (uint32 low = 0; low < n; low += 2 * width) {
+      uint32 mid = low + width < n ? low + width : n;
+      uint32 high = mid + width < n ? mid + width : n;
+      uint32 i = low, j = mid, k = low;
+      while (i < mid && j < high) {
+        uint16 takeRight = way == ASC ? src[j] < src[i] : src[j] > src[i];
+        dst[k++] = takeRight ? src[j++] : src[i++];
+      }
+      while (i < mid)
+        dst[k++] = src[i++];
+      while (j < high)
+        dst[k++] = src[j++];
+    }
+    Elemtype *temp = src;
+    src = dst;
+    dst = temp;
+    if (width > n / 2) // 防止 width *= 2 溢出
+      break;
+  }
+
+  if (src != SV_DATA(linkedList))
+    memcpy(SV_DATA(linkedList), src, sizeof(Elemtype) * n);
+  free(buffer);
+  linkedList->version++;
+}
+
+/**
+ * @brief LSD 基数排序，所有键在某一轮取值相同时跳过该轮
+ */
+void SV_sortRadix(SL_link *const linkedList, enum sort way) {
+  uint32 n = linkedList->length;
+  if (n <= 1)
+    return;
+  Elemtype *data = SV_DATA(linkedList);
+  uint32 *keys = (uint32 *)malloc(sizeof(uint32) * 2 * (n ? n : 1));
+  if (!keys) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return;
+  }
+
+  // 翻转符号位使有符号数按无符号顺序排列，降序时再取反
+  uint32 flip = way == ASC ? 0x80000000u : 0x7FFFFFFFu;
+  uint32 *src = keys, *dst = keys + n;
+  for (uint32 i = 0; i < n; i++)
+    src[i] = (uint32)data[i] ^ flip;
+
+  uint32 counts[SV_RADIX_BUCKETS];
+  for (uint32 pass = 0; pass < SV_RADIX_PASSES; pass++) {
+    uint32 shift = pass * SV_RADIX_BITS;
+    memset(counts, 0, sizeof(counts));
+    for (uint32 i = 0; i < n; i++)
+      counts[(src[i] >> shift) & (SV_RADIX_BUCKETS - 1)]++;
+    if (counts[(src[0] >> shift) & (SV_RADIX_BUCKETS - 1)] == n)
+      continue;
+
+    uint32 sum = 0;
+    for (uint32 b = 0; b < SV_RADIX_BUCKETS; b++) {
+      uint32 c = counts[b];
+      counts[b] = sum;
+      sum += c;
+    }
+    for (uint32 i = 0; i < n; i++)
+      dst[counts[(src[i] >> shift) & (SV_RADIX_BUCKETS - 1)]++] = src[i];
+
+    uint32 *temp = src;
+    src = dst;
+    dst = temp;
+  }
+
+  for (uint32 i = 0; i < n; i++)
+    data[i] = (Elemtype)(src[i] ^ flip);
+  free(keys);
+  linkedList->version++;
+}
+
+/**
+ * @brief 清空数据（保留容量）
+ */
+void SV_clear(SL_link *const linkedList) {
+  linkedList->length = 0;
+  linkedList->vector->start = 0;
+  linkedList->version++;
+}
+
+/** @} */ // 顺序存储后端
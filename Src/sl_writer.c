@@ -0,0 +1,354 @@
+/*
+ * @file sl_writer.c
+ * @brief 单向链表缓冲文本输出实现文件
+ * @author ringtree
+ * @date 2025-10-01
+ * @version 1.0
+ *
+ * 本文件实现了 sl_writer.h 中声明的缓冲输出器。
+ * 每写一个元素前只检查一次剩余空间（数字、分隔符、换行符的最大长度之和），
+ * 空间不足时刷新缓冲区，因此内层循环只有整数转换与少量字节拷贝。
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sl_log.h"
+#include "sl_vector.h"
+#include "sl_writer.h"
+
+/**
+ * @addtogroup 缓冲输出
+ * @{
+ */
+
+/**
+ * @brief 00 ~ 99 的两位十进制字符表
+ */
+static const char SW_digitPairs[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/**
+ * @brief 默认输出格式（与 SL_traverseLink 相同）
+ */
+static const SW_format SW_defaultFormat = {"\t", "\n", 20};
+
+/**
+ * @brief 创建输出器的公共部分
+ */
+static SW_writer *SW_inifCommon(char *buffer, uint32 capacity, FILE *file,
+                                int fd) {
+  SW_writer *writer = (SW_writer *)malloc(sizeof(SW_writer));
+  if (!writer) {
+    SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+    return NULL;
+  }
+
+  writer->ownBuffer = 0;
+  if (buffer == NULL) {
+    if (capacity == 0)
+      capacity = SW_DEFAULT_CAPACITY;
+    buffer = (char *)malloc(capacity);
+    if (!buffer) {
+      SL_log(SL_LOG_ERROR, "内存分配失败 可能内存不足");
+      free(writer);
+      return NULL;
+    }
+    writer->ownBuffer = 1;
+  }
+
+  writer->buffer = buffer;
+  writer->capacity = capacity;
+  writer->used = 0;
+  writer->file = file;
+  writer->fd = fd;
+  writer->error = 0;
+  writer->written = 0;
+  return writer;
+}
+
+/**
+ * @brief 创建写入调用者缓冲区的输出器
+ *
+ * 缓冲区写满后停止写入并置 error，已写入的内容为 buffer[0, used)。
+ *
+ * @param buffer 调用者提供的缓冲区
+ * @param capacity 缓冲区大小（字节）
+ * @return SW_writer* 输出器，参数无效或内存分配失败时返回NULL
+ * @note 输出器不会在缓冲区末尾写入 '\0'。
+ */
+SW_writer *SW_inifWriter(char *const buffer, const uint32 capacity) {
+  if (buffer == NULL || capacity == 0) {
+    SL_log(SL_LOG_ERROR, "错误：输出缓冲区为空");
+    return NULL;
+  }
+  return SW_inifCommon(buffer, capacity, NULL, -1);
+}
+
+/**
+ * @brief 创建写入 FILE* 的输出器
+ *
+ * @param file 输出文件（如 stdout），由调用者关闭
+ * @param capacity 内部缓冲区大小，0 表示 SW_DEFAULT_CAPACITY
+ * @return SW_writer* 输出器，内存分配失败返回NULL
+ */
+SW_writer *SW_inifWriterFile(FILE *const file, const uint32 capacity) {
+  if (file == NULL) {
+    SL_log(SL_LOG_ERROR, "错误：输出文件为空");
+    return NULL;
+  }
+  return SW_inifCommon(NULL, capacity, file, -1);
+}
+
+/**
+ * @brief 创建写入文件描述符的输出器（绕过 stdio）
+ *
+ * @param fd 文件描述符，由调用者关闭
+ * @param capacity 内部缓冲区大小，0 表示 SW_DEFAULT_CAPACITY
+ * @return SW_writer* 输出器，内存分配失败返回NULL
+ */
+SW_writer *SW_inifWriterFd(const int fd, const uint32 capacity) {
+  if (fd < 0) {
+    SL_log(SL_LOG_ERROR, "错误：无效的文件描述符");
+    return NULL;
+  }
+  return SW_inifCommon(NULL, capacity, NULL, fd);
+}
+
+/**
+ * @brief 把缓冲区内容交给输出目标
+ *
+ * 内存缓冲区输出器没有输出目标，直接返回。
+ *
+ * @param writer 输出器
+ * @return uint16 成功返回1，写入失败或此前已出错返回0
+ */
+uint16 SW_flush(SW_writer *const writer) {
+  if (writer->error)
+    return 0;
+  if (writer->file == NULL && writer->fd < 0)
+    return 1;
+
+  uint32 done = 0;
+  if (writer->file) {
+    done = (uint32)fwrite(writer->buffer, 1, writer->used, writer->file);
+  } else {
+    while (done < writer->used) {
+      ssize_t n = write(writer->fd, writer->buffer + done, writer->used - done);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0)
+        break;
+      done += (uint32)n;
+    }
+  }
+
+  writer->written += done;
+  if (done != writer->used) {
+    SL_log(SL_LOG_ERROR, "错误：输出写入失败");
+    writer->error = 1;
+    return 0;
+  }
+  writer->used = 0;
+  return 1;
+}
+
+/**
+ * @brief 保证缓冲区至少还有 need 字节，不足时先刷新
+ *
+ * @return uint16 空间足够返回1，否则置 error 并返回0
+ */
+static inline uint16 SW_reserve(SW_writer *const writer, const uint32 need) {
+  if (writer->capacity - writer->used >= need)
+    return 1;
+  if (SW_flush(writer) && writer->capacity - writer->used >= need)
+    return 1;
+
+  writer->error = 1;
+  return 0;
+}
+
+/**
+ * @brief 十进制位数
+ */
+static inline uint32 SW_digitCount(const uint32 v) {
+  if (v < 100000)
+    return v < 100 ? (v < 10 ? 1 : 2)
+                   : (v < 1000 ? 3 : (v < 10000 ? 4 : 5));
+  if (v < 10000000)
+    return v < 1000000 ? 6 : 7;
+  return v < 100000000 ? 8 : (v < 1000000000 ? 9 : 10);
+}
+
+/**
+ * @brief 把整数转换为十进制文本，先求位数再从低位起每次写两位
+ *
+ * @param out 输出位置（至少 SW_MAX_DIGITS 字节）
+ * @param value 整数
+ * @return uint32 写入的字符数
+ */
+static inline uint32 SW_formatInt(char *out, const Elemtype value) {
+  uint32 v = (uint32)value;
+  uint32 sign = 0;
+  if (value < 0) {
+    v = 0u - v;
+    *out++ = '-';
+    sign = 1;
+  }
+
+  uint32 length = SW_digitCount(v);
+  char *p = out + length;
+  while (v >= 100) {
+    uint32 pair = v % 100;
+    v /= 100;
+    p -= 2;
+    memcpy(p, SW_digitPairs + pair * 2, 2);
+  }
+  if (v >= 10)
+    memcpy(p - 2, SW_digitPairs + v * 2, 2);
+  else
+    p[-1] = (char)('0' + v);
+  return length + sign;
+}
+
+/**
+ * @brief 逐元素写入时的格式状态
+ */
+typedef struct SW_state {
+  const SW_format *format; ///< 输出格式
+  uint32 separatorLength;  ///< 分隔符长度
+  uint32 newlineLength;    ///< 换行符长度
+  uint32 need;             ///< 每个元素最多占用的字节数
+  uint32 column;           ///< 当前行已写的元素个数
+} SW_state;
+
+/**
+ * @brief 初始化格式状态
+ */
+static inline void SW_inifState(SW_state *const state,
+                                const SW_format *format) {
+  state->format = format ? format : &SW_defaultFormat;
+  state->separatorLength = (uint32)strlen(state->format->separator);
+  state->newlineLength = (uint32)strlen(state->format->newline);
+  state->need =
+      SW_MAX_DIGITS + state->separatorLength + state->newlineLength;
+  state->column = 0;
+}
+
+/**
+ * @brief 写入一个元素及其后的分隔符（满一行且不是最后一个元素时再写换行符）
+ *
+ * @return uint16 成功返回1，缓冲区空间不足返回0
+ */
+static inline uint16 SW_put(SW_writer *const writer, SW_state *const state,
+                            const Elemtype value, const uint16 last) {
+  if (!SW_reserve(writer, state->need))
+    return 0;
+
+  char *out = writer->buffer + writer->used;
+  out += SW_formatInt(out, value);
+  if (state->separatorLength == 1) {
+    *out++ = state->format->separator[0];
+  } else {
+    memcpy(out, state->format->separator, state->separatorLength);
+    out += state->separatorLength;
+  }
+  if (state->format->rowWidth && ++state->column == state->format->rowWidth &&
+      !last) {
+    memcpy(out, state->format->newline, state->newlineLength);
+    out += state->newlineLength;
+    state->column = 0;
+  }
+
+  writer->used = (uint32)(out - writer->buffer);
+  return 1;
+}
+
+/**
+ * @brief 写入结尾的换行符
+ */
+static inline void SW_finish(SW_writer *const writer,
+                             const SW_state *const state) {
+  if (SW_reserve(writer, state->newlineLength)) {
+    memcpy(writer->buffer + writer->used, state->format->newline,
+           state->newlineLength);
+    writer->used += state->newlineLength;
+  }
+}
+
+/**
+ * @brief 按格式写入数组
+ *
+ * @param writer 输出器
+ * @param array 数据数组
+ * @param count 元素个数
+ * @param format 输出格式，为NULL时使用默认格式
+ * @return uint32 成功写入的元素个数（内存缓冲区写满时小于 count）
+ * @note 数据可能仍留在缓冲区中，需要调用 SW_flush() 或 SW_freeWriter()。
+ */
+uint32 SW_writeArray(SW_writer *const writer, const Elemtype *const array,
+                     const uint32 count, const SW_format *format) {
+  SW_state state;
+  SW_inifState(&state, format);
+
+  uint32 i = 0;
+  for (; i < count; i++) {
+    if (!SW_put(writer, &state, array[i], i + 1 == count))
+      return i;
+  }
+
+  SW_finish(writer, &state);
+  return i;
+}
+
+/**
+ * @brief 按格式写入链表（节点存储或顺序存储）
+ *
+ * @param writer 输出器
+ * @param linkedList 单向链表
+ * @param format 输出格式，为NULL时使用默认格式
+ * @return uint32 成功写入的元素个数
+ * @note 数据可能仍留在缓冲区中，需要调用 SW_flush() 或 SW_freeWriter()。
+ */
+uint32 SW_writeLink(SW_writer *const writer, SL_link *const linkedList,
+                    const SW_format *format) {
+  if (linkedList->vector)
+    return SW_writeArray(writer, SV_DATA(linkedList), linkedList->length,
+                         format);
+
+  SW_state state;
+  SW_inifState(&state, format);
+
+  uint32 count = 0;
+  for (SL_node *cur = linkedList->headIndex; cur; cur = cur->next, count++) {
+    if (!SW_put(writer, &state, cur->data, cur->next == NULL))
+      return count;
+  }
+
+  SW_finish(writer, &state);
+  return count;
+}
+
+/**
+ * @brief 刷新并释放输出器（不关闭 FILE* / 文件描述符，不释放调用者缓冲区）
+ *
+ * @param writer 输出器，传入NULL时直接返回
+ */
+void SW_freeWriter(SW_writer *writer) {
+  if (writer == NULL)
+    return;
+
+  SW_flush(writer);
+  if (writer->ownBuffer)
+    free(writer->buffer);
+  free(writer);
+}
+
+/** @} */ // 缓冲输出